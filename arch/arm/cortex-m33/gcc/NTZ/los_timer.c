@@ -92,14 +92,13 @@ STATIC UINT64 SysTickReload(UINT64 nextResponseTime)
 
 STATIC UINT64 SysTickCycleGet(UINT32 *period)
 {
+    /* LOS_SysCycleGet retries when the counter is reloaded between the two reads */
     UINT32 hwCycle = 0;
-    UINT32 intSave = LOS_IntLock();
     UINT32 val = SysTick->VAL;
     *period = SysTick->LOAD;
     if (val != 0) {
         hwCycle = *period - val;
     }
-    LOS_IntRestore(intSave);
     return (UINT64)hwCycle;
 }
 
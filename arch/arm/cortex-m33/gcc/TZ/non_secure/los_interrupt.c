@@ -33,6 +33,7 @@
 #include "securec.h"
 #include "los_context.h"
 #include "los_arch_interrupt.h"
+#include "los_hwi_vector.h"
 #include "los_debug.h"
 #include "los_hook.h"
 #include "los_task.h"
@@ -255,7 +256,7 @@ LITE_OS_SEC_TEXT VOID HalInterrupt(VOID)
  Description : create hardware interrupt
  Input       : hwiNum   --- hwi num to create
                hwiPrio  --- priority of the hwi
-               hwiMode  --- unused
+               hwiMode  --- LOS_HWI_MODE_DIRECT to install the handler in the vector table
                hwiHandler --- hwi handler
                irqParam --- param of the hwi handler
  Output      : None
@@ -267,7 +268,6 @@ LITE_OS_SEC_TEXT_INIT UINT32 ArchHwiCreate(HWI_HANDLE_T hwiNum,
                                            HWI_PROC_FUNC hwiHandler,
                                            HwiIrqParam *irqParam)
 {
-    (VOID)hwiMode;
     UINT32 intSave;
 
     if (hwiHandler == NULL) {
@@ -287,16 +287,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 ArchHwiCreate(HWI_HANDLE_T hwiNum,
     }
 
     intSave = LOS_IntLock();
-#if (LOSCFG_PLATFORM_HWI_WITH_ARG == 1)
-    if (irqParam != NULL) {
-        OsSetVector(hwiNum, hwiHandler, irqParam->pDevId);
-    } else {
-        OsSetVector(hwiNum, hwiHandler, NULL);
-    }
-#else
-    (VOID)irqParam;
-    OsSetVector(hwiNum, hwiHandler);
-#endif
+    OsHwiVectorInstall(&g_hwiForm[hwiNum + OS_SYS_VECTOR_CNT], hwiNum, hwiMode, hwiHandler, irqParam);
     HwiUnmask((IRQn_Type)hwiNum);
     HwiSetPriority((IRQn_Type)hwiNum, hwiPrio);
 
@@ -78,8 +78,13 @@ extern VOID __stack_chk_fail(VOID);
 UINT32 ArchIsIntActive(VOID);
 #define OS_INT_ACTIVE    (ArchIsIntActive())
 #define OS_INT_INACTIVE  (!(OS_INT_ACTIVE))
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+#define LOS_HwiCreate OsHwiCreate
+#define LOS_HwiDelete OsHwiDelete
+#else
 #define LOS_HwiCreate ArchHwiCreate
 #define LOS_HwiDelete ArchHwiDelete
+#endif
 #define LOS_HwiTrigger ArchIntTrigger
 #define LOS_HwiEnable ArchIntEnable
 #define LOS_HwiDisable ArchIntDisable
@@ -88,10 +93,17 @@ UINT32 ArchIsIntActive(VOID);
 #define LOS_HwiCurIrqNum ArchIntCurIrqNum
 
 UINT32 ArchIntLock(VOID);
-#define LOS_IntLock ArchIntLock
-
 VOID ArchIntRestore(UINT32 intSave);
+#if (LOSCFG_KERNEL_IRQSTAT == 1)
+/* Measure how long interrupts stay masked, see los_irqstat.h */
+UINT32 OsIrqStatIntLock(VOID);
+VOID OsIrqStatIntRestore(UINT32 intSave);
+#define LOS_IntLock OsIrqStatIntLock
+#define LOS_IntRestore OsIrqStatIntRestore
+#else
+#define LOS_IntLock ArchIntLock
 #define LOS_IntRestore ArchIntRestore
+#endif
 
 UINT32 ArchIntUnLock(VOID);
 #define LOS_IntUnLock ArchIntUnLock
@@ -141,7 +153,8 @@ UINT32 ArchHwiDelete(HWI_HANDLE_T hwiNum, HwiIrqParam *irqParam);
  *
  * @param  hwiNum   [IN] Type#HWI_HANDLE_T: hardware interrupt number. The value range applicable for a Cortex-A7 platform is [32,95].
  * @param  hwiPrio  [IN] Type#HWI_PRIOR_T: hardware interrupt priority. Ignore this parameter temporarily.
- * @param  mode     [IN] Type#HWI_MODE_T: hardware interrupt mode. Ignore this parameter temporarily.
+ * @param  mode     [IN] Type#HWI_MODE_T: hardware interrupt mode. #LOS_HWI_MODE_DIRECT is honoured by the Cortex-M
+ *                                         ports, other bits are ignored temporarily.
  * @param  handler  [IN] Type#HWI_PROC_FUNC: interrupt handler used when a hardware interrupt is triggered.
  * @param  irqParam [IN] Type#HwiIrqParam: input parameter of the interrupt
  *                                         handler used when a hardware interrupt is triggered.
@@ -161,6 +174,113 @@ UINT32 ArchHwiCreate(HWI_HANDLE_T hwiNum,
                      HWI_PROC_FUNC handler,
                      HwiIrqParam *irqParam);
 
+/**
+ * @ingroup  los_interrupt
+ * Interrupt mode flag: install the handler straight into the vector table, skipping the common interrupt entry with
+ * its hooks and pre/post handlers. The handler must be defined with LOS_HWI_DIRECT_HANDLER. Ports without a direct
+ * path run it through the common entry instead.
+ */
+#define LOS_HWI_MODE_DIRECT 0x4000
+
+extern UINT32 g_intCount;
+
+/*
+ * A nested interrupt always restores the counter before returning, so the plain read-modify-write cannot lose an
+ * update on a single core and the counter needs no lock.
+ */
+STATIC INLINE VOID ArchIntDirectEnter(VOID)
+{
+    g_intCount++;
+}
+
+/*
+ * A reschedule requested by the handler is only pended, the switch is taken once the outermost interrupt returns.
+ */
+STATIC INLINE VOID ArchIntDirectExit(VOID)
+{
+    g_intCount--;
+}
+
+/**
+ * @ingroup  los_interrupt
+ * Define a handler for #LOS_HWI_MODE_DIRECT. The body runs in the interrupt context with OS_INT_ACTIVE set, e.g.
+ *
+ * LOS_HWI_DIRECT_HANDLER(AdcIrqHandler)
+ * {
+ *     ...
+ * }
+ */
+#define LOS_HWI_DIRECT_HANDLER(name)        \
+    STATIC INLINE VOID name##Body(VOID);    \
+    VOID name(VOID)                         \
+    {                                       \
+        ArchIntDirectEnter();               \
+        name##Body();                       \
+        ArchIntDirectExit();                \
+    }                                       \
+    STATIC INLINE VOID name##Body(VOID)
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+/**
+ * @ingroup  los_interrupt
+ * Interrupt mode flag: run the handler in the threaded interrupt work queue instead of the interrupt context.
+ * The interrupt stays disabled from the time it fires until the handler returns.
+ */
+#define LOS_HWI_MODE_THREADED 0x8000
+
+/**
+ * @ingroup  los_interrupt
+ * @brief Create a hardware interrupt, optionally with a threaded handler.
+ *
+ * @par Description:
+ * This API is the same as ArchHwiCreate, except that when #LOS_HWI_MODE_THREADED is set in mode the handler is
+ * called from the threaded interrupt work queue task, with the interrupt disabled until it returns.
+ *
+ * @attention
+ * <ul>
+ * <li>Threaded handlers require LOSCFG_PLATFORM_HWI_WITH_ARG, the handler is passed irqParam->pDevId.</li>
+ * <li>#LOS_HWI_MODE_THREADED cannot be combined with #LOS_HWI_MODE_DIRECT.</li>
+ * <li>At most LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT interrupts can be threaded.</li>
+ * </ul>
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_HWI_MODE_INVALID     #LOS_HWI_MODE_THREADED is combined with #LOS_HWI_MODE_DIRECT.
+ * @retval #LOS_ERRNO_WORKQUEUE_HWI_UNSUPPORTED      Threaded handlers are not supported by this configuration.
+ * @retval #LOS_ERRNO_WORKQUEUE_HWI_UNAVAILABLE      No threaded interrupt is available.
+ * @retval Others same as ArchHwiCreate.
+ * @par Dependency:
+ * <ul><li>los_interrupt.h: the header file that contains the API declaration.</li></ul>
+ * @see ArchHwiCreate
+ */
+UINT32 OsHwiCreate(HWI_HANDLE_T hwiNum,
+                   HWI_PRIOR_T hwiPrio,
+                   HWI_MODE_T mode,
+                   HWI_PROC_FUNC handler,
+                   HwiIrqParam *irqParam);
+
+/**
+ * @ingroup  los_interrupt
+ * @brief Delete a hardware interrupt created by OsHwiCreate.
+ *
+ * @par Description:
+ * This API is the same as ArchHwiDelete, and also releases the threaded handler of the interrupt, if any.
+ *
+ * @attention
+ * <ul>
+ * <li>If the threaded handler is pending or running, the API blocks until it returns, so that the caller can free
+ * the handler context afterwards. A threaded handler deleting its own interrupt does not wait.</li>
+ * <li>A threaded interrupt cannot be deleted in the interrupt context or while the task scheduling is locked.</li>
+ * </ul>
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_IN_INTERRUPT         A threaded interrupt is deleted in the interrupt context.
+ * @retval #LOS_ERRNO_WORKQUEUE_PEND_IN_LOCK         A threaded interrupt is deleted with the task scheduling locked.
+ * @retval Others same as ArchHwiDelete.
+ * @par Dependency:
+ * <ul><li>los_interrupt.h: the header file that contains the API declaration.</li></ul>
+ * @see ArchHwiDelete
+ */
+UINT32 OsHwiDelete(HWI_HANDLE_T hwiNum, HwiIrqParam *irqParam);
+#endif
+
 STATIC INLINE UINT32 ArchIntTrigger(HWI_HANDLE_T hwiNum)
 {
     if (g_archHwiOps.triggerIrq == NULL) {
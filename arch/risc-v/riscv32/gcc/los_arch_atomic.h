@@ -41,6 +41,9 @@ extern "C" {
 #endif /* __cplusplus */
 #endif /* __cplusplus */
 
+/* The atomic operations of this port are made atomic by masking interrupts */
+#define ARCH_ATOMIC_INT_LOCK    1
+
 STATIC INLINE INT32 ArchAtomicRead(const Atomic *v)
 {
     INT32 val;
@@ -29,7 +29,7 @@
  * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "los_cpup.h"
+#include "los_cpup_pri.h"
 #include "securec.h"
 #include "los_memory.h"
 #include "los_debug.h"
@@ -158,6 +158,14 @@ LITE_OS_SEC_TEXT_MINOR VOID OsTskCycleEndStart(VOID)
 
         g_cpup[taskID].allTime += (cpuCycle - g_cpup[taskID].startTime);
         g_cpup[taskID].startTime = 0;
+
+        /* A task that yielded is still ready, but it gave up the processor on its own */
+        if ((g_losTask.runTask->taskStatus & (OS_TASK_STATUS_READY | OS_TASK_FLAG_YIELD)) == OS_TASK_STATUS_READY) {
+            g_cpup[taskID].involuntarySwitch++;
+        } else {
+            g_cpup[taskID].voluntarySwitch++;
+        }
+        g_losTask.runTask->taskStatus &= ~OS_TASK_FLAG_YIELD;
     }
 
     taskID = g_losTask.newTask->taskID;
@@ -513,4 +521,151 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_CpupUsageMonitor(CPUP_TYPE_E type, CPUP_MODE_E
     return LOS_OK;
 }
 
+STATIC UINT32 OsCpupTaskCheck(UINT32 taskID)
+{
+    if (g_cpupInitFlg == 0) {
+        return LOS_ERRNO_CPUP_NO_INIT;
+    }
+    if (OS_TSK_GET_INDEX(taskID) >= g_taskMaxNum) {
+        return LOS_ERRNO_CPUP_TSK_ID_INVALID;
+    }
+    if (g_cpup[taskID].cpupID != taskID) {
+        return LOS_ERRNO_CPUP_THREAD_NO_CREATED;
+    }
+    if ((g_cpup[taskID].status & OS_TASK_STATUS_UNUSED) || (g_cpup[taskID].status == 0)) {
+        return LOS_ERRNO_CPUP_THREAD_NO_CREATED;
+    }
+    return LOS_OK;
+}
+
+/*****************************************************************************
+Function   : LOS_TaskCpuTimeGet
+Description: get running time of certain task
+Input      : taskID : task ID
+Output     : cycles : running time in cycles
+Return     : LOS_OK on success, or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskCpuTimeGet(UINT32 taskID, UINT64 *cycles)
+{
+    UINT32 intSave;
+    UINT32 ret;
+
+    if (cycles == NULL) {
+        return LOS_ERRNO_CPUP_TASK_PTR_NULL;
+    }
+
+    ret = OsCpupTaskCheck(taskID);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    intSave = LOS_IntLock();
+    OsTskCycleEnd();
+    *cycles = g_cpup[taskID].allTime;
+    OsTskCycleStart();
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+Function   : LOS_SysCpuTimeGet
+Description: get running time of all tasks except the idle task
+Output     : cycles : running time in cycles
+Return     : LOS_OK on success, or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_SysCpuTimeGet(UINT64 *cycles)
+{
+    UINT64 cpuCycleAll = 0;
+    UINT16 loopNum;
+    UINT32 intSave;
+
+    if (g_cpupInitFlg == 0) {
+        return LOS_ERRNO_CPUP_NO_INIT;
+    }
+
+    if (cycles == NULL) {
+        return LOS_ERRNO_CPUP_TASK_PTR_NULL;
+    }
+
+    intSave = LOS_IntLock();
+    OsTskCycleEnd();
+
+    for (loopNum = 0; loopNum < g_taskMaxNum; loopNum++) {
+        if ((g_cpup[loopNum].status & OS_TASK_STATUS_UNUSED) ||
+            (g_cpup[loopNum].status == 0) || (loopNum == g_idleTaskID)) {
+            continue;
+        }
+        cpuCycleAll += g_cpup[loopNum].allTime;
+    }
+
+    OsTskCycleStart();
+    LOS_IntRestore(intSave);
+
+    *cycles = cpuCycleAll;
+    return LOS_OK;
+}
+
+STATIC UINT32 OsTaskStackUsedGet(UINT32 taskID)
+{
+    LosTaskCB *taskCB = OS_TCB_FROM_TID(taskID);
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+    return taskCB->topOfStack + taskCB->stackSize - taskCB->stackLowest;
+#else
+    return taskCB->topOfStack + taskCB->stackSize - (UINT32)(UINTPTR)taskCB->stackPointer;
+#endif
+}
+
+/*****************************************************************************
+Function   : OsTaskRusageGet
+Description: get running time, context switches and stack usage of certain task
+Input      : taskID    : task ID
+             stackScan : scan the stack for the water line instead of using the cheap estimate
+Output     : usage : resource usage of the task
+Return     : LOS_OK on success, or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 OsTaskRusageGet(UINT32 taskID, CPUP_RUSAGE_S *usage, BOOL stackScan)
+{
+    UINT32 intSave;
+    UINT32 ret;
+
+    if (usage == NULL) {
+        return LOS_ERRNO_CPUP_TASK_PTR_NULL;
+    }
+
+    ret = OsCpupTaskCheck(taskID);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    intSave = LOS_IntLock();
+    OsTskCycleEnd();
+    usage->cpuTime = g_cpup[taskID].allTime;
+    usage->voluntarySwitch = g_cpup[taskID].voluntarySwitch;
+    usage->involuntarySwitch = g_cpup[taskID].involuntarySwitch;
+    if (!stackScan) {
+        usage->stackPeakUsed = OsTaskStackUsedGet(taskID);
+    }
+    OsTskCycleStart();
+    LOS_IntRestore(intSave);
+
+    if (stackScan) {
+        usage->stackPeakUsed = OsGetTaskWaterLine(taskID);
+    }
+    return LOS_OK;
+}
+
+/*****************************************************************************
+Function   : LOS_TaskRusageGet
+Description: get running time, context switches and peak stack usage of certain task
+Input      : taskID : task ID
+Output     : usage : resource usage of the task
+Return     : LOS_OK on success, or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskRusageGet(UINT32 taskID, CPUP_RUSAGE_S *usage)
+{
+    return OsTaskRusageGet(taskID, usage, TRUE);
+}
+
 #endif /* LOSCFG_BASE_CORE_CPUP */
@@ -135,6 +135,8 @@ typedef struct {
     UINT64 allTime;                                       /**< Total running time */
     UINT64 startTime;                                     /**< Time before a task is invoked */
     UINT64 historyTime[OS_CPUP_HISTORY_RECORD_NUM];       /**< Historical running time */
+    UINT32 voluntarySwitch;                               /**< Switches away while blocked, delayed or suspended */
+    UINT32 involuntarySwitch;                             /**< Switches away while still ready */
 } OsCpupCB;
 
 extern OsCpupCB    *g_cpup;
@@ -207,6 +209,17 @@ typedef enum {
     CPUP_LESS_THAN_1S,   /* cpu occupancy rate less than 1s, if the input mode is none of them, it will be this. */
 } CPUP_MODE_E;
 
+/**
+ * @ingroup los_cpup
+ * Resource usage of a task.
+ */
+typedef struct tagCpupRusage {
+    UINT64 cpuTime;             /**< Total running time, in cycles */
+    UINT32 voluntarySwitch;     /**< Switches away while blocked, delayed, suspended or yielded */
+    UINT32 involuntarySwitch;   /**< Switches away while preempted */
+    UINT32 stackPeakUsed;       /**< Peak stack usage, in bytes */
+} CPUP_RUSAGE_S;
+
 /**
  * @ingroup los_cpup
  * @brief Obtain the current CPU usage.
@@ -357,6 +370,83 @@ extern UINT32 LOS_AllTaskCpuUsage(CPUP_INFO_S *cpupInfo, UINT16 mode);
  */
 extern UINT32 LOS_CpupUsageMonitor(CPUP_TYPE_E type, CPUP_MODE_E mode, UINT32 taskID);
 
+/**
+ * @ingroup los_cpup
+ * @brief Obtain the running time of certain task.
+ *
+ * @par Description:
+ * This API is used to obtain the total running time of certain task, including the part of
+ * its current time slice when it is the running task.
+ * @attention
+ * <ul>
+ * <li>This API can be called only after the CPU usage is initialized. Otherwise, error codes will be returned.</li>
+ * </ul>
+ *
+ * @param taskID   [IN] UINT32 Task ID.
+ * @param cycles   [OUT] UINT64 * Running time of the task, in cycles.
+ *
+ * @retval #OS_ERRNO_CPUP_NO_INIT                  0x02001e02: The CPU usage is not initialized.
+ * @retval #OS_ERRNO_CPUP_TASK_PTR_NULL            0x02001e01: The input pointer is NULL.
+ * @retval #OS_ERRNO_CPUP_TSK_ID_INVALID           0x02001e05: The target task ID is invalid.
+ * @retval #OS_ERRNO_CPUP_THREAD_NO_CREATED        0x02001e04: The target thread is not created.
+ * @retval #LOS_OK                                 The running time is successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SysCpuTimeGet
+ */
+extern UINT32 LOS_TaskCpuTimeGet(UINT32 taskID, UINT64 *cycles);
+
+/**
+ * @ingroup los_cpup
+ * @brief Obtain the running time of all tasks except the idle task.
+ *
+ * @par Description:
+ * This API is used to obtain the time the system spent running tasks, which is the CPU time of the
+ * whole application since all tasks share one address space.
+ * @attention
+ * <ul>
+ * <li>This API can be called only after the CPU usage is initialized. Otherwise, error codes will be returned.</li>
+ * <li>Time of deleted tasks is not included.</li>
+ * </ul>
+ *
+ * @param cycles   [OUT] UINT64 * Running time of all tasks except the idle task, in cycles.
+ *
+ * @retval #OS_ERRNO_CPUP_NO_INIT                  0x02001e02: The CPU usage is not initialized.
+ * @retval #OS_ERRNO_CPUP_TASK_PTR_NULL            0x02001e01: The input pointer is NULL.
+ * @retval #LOS_OK                                 The running time is successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskCpuTimeGet
+ */
+extern UINT32 LOS_SysCpuTimeGet(UINT64 *cycles);
+
+/**
+ * @ingroup los_cpup
+ * @brief Obtain the resource usage of certain task.
+ *
+ * @par Description:
+ * This API is used to obtain the running time, the context switch counts and the peak stack usage
+ * of certain task.
+ * @attention
+ * <ul>
+ * <li>This API can be called only after the CPU usage is initialized. Otherwise, error codes will be returned.</li>
+ * <li>Context switches are counted only when LOSCFG_BASE_CORE_TSK_MONITOR is enabled.</li>
+ * </ul>
+ *
+ * @param taskID   [IN] UINT32 Task ID.
+ * @param usage    [OUT] CPUP_RUSAGE_S * Resource usage of the task.
+ *
+ * @retval #OS_ERRNO_CPUP_NO_INIT                  0x02001e02: The CPU usage is not initialized.
+ * @retval #OS_ERRNO_CPUP_TASK_PTR_NULL            0x02001e01: The input pointer is NULL.
+ * @retval #OS_ERRNO_CPUP_TSK_ID_INVALID           0x02001e05: The target task ID is invalid.
+ * @retval #OS_ERRNO_CPUP_THREAD_NO_CREATED        0x02001e04: The target thread is not created.
+ * @retval #LOS_OK                                 The resource usage is successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskCpuTimeGet
+ */
+extern UINT32 LOS_TaskRusageGet(UINT32 taskID, CPUP_RUSAGE_S *usage);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
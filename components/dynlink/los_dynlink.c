@@ -40,6 +40,9 @@
 #include "los_task.h"
 #include "los_debug.h"
 #include "los_mux.h"
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+#include "los_init.h"
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -928,6 +931,16 @@ INT32 LOS_DynlinkInit(VOID)
     return LOS_OK;
 }
 
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+/* Shared objects are loaded from the file system, so the link table can be set up after LOS_Start. */
+STATIC UINT32 OsDynlinkModuleInit(VOID)
+{
+    return (LOS_DynlinkInit() == LOS_OK) ? LOS_OK : LOS_NOK;
+}
+
+LOS_MODULE_INIT_DEFERRED(dynlink, OsDynlinkModuleInit, LOS_INIT_LEVEL_COMPONENT);
+#endif
+
 #endif /* LOSCFG_DYNLINK */
 
 #ifdef __cplusplus
@@ -187,6 +187,9 @@ INT32 LOS_SoUnload(VOID *handle);
  *
  * @param VOID.
  *
+ * @note With LOSCFG_KERNEL_MODULE_INIT, it is run by the deferred initialization task, call LOS_ModuleInitWait
+ * before loading the first shared library.
+ *
  * @return Return LOS_NOK if error. Return LOS_OK if success.
  */
 INT32 LOS_DynlinkInit(VOID);
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_irqstat.h"
+#include "securec.h"
+#include "los_interrupt.h"
+#include "los_hook.h"
+#include "los_tick.h"
+#include "los_debug.h"
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+#include "los_task.h"
+#include "los_backtrace.h"
+#endif
+
+#define OS_IRQSTAT_NEST_MAX             8
+#define OS_IRQSTAT_CYCLE_TO_US(cycle)   ((UINT32)(OS_SYS_CYCLE_TO_NS(cycle, g_sysClock) / OS_SYS_NS_PER_US))
+
+typedef struct {
+    UINT64 start;
+    UINT64 nested;      /* Cycles spent in the interrupts that preempted this one */
+} IrqStatFrame;
+
+STATIC LOS_IRQSTAT_S g_irqStat[LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT];
+STATIC IrqStatFrame g_irqStatFrame[OS_IRQSTAT_NEST_MAX];
+STATIC UINT32 g_irqStatNest;
+
+STATIC LOS_IRQSTAT_S g_irqStatMask;
+STATIC UINT64 g_irqStatMaskStart;
+STATIC BOOL g_irqStatStarted = FALSE;
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+#define OS_IRQSTAT_LR_SKIP_IRQ          0   /* OsIrqStatIntRestore is called by the section itself */
+#define OS_IRQSTAT_LR_SKIP_SCHED        1   /* OsIrqStatSchedUnlock is called through LOS_TaskUnlock */
+
+STATIC LOS_IRQSTAT_CRITICAL_S g_irqStatCritical[LOS_IRQSTAT_CRITICAL_TYPE_NUM][LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM];
+STATIC UINT32 g_irqStatCriticalNum[LOS_IRQSTAT_CRITICAL_TYPE_NUM];
+STATIC UINT32 g_irqStatCriticalThreshold = OS_NULL_INT;
+STATIC UINT64 g_irqStatSchedStart;
+STATIC UINTPTR g_irqStatSchedLR;
+STATIC UINTPTR g_irqStatMaskLR;
+
+STATIC INLINE BOOL OsIrqStatCriticalKeep(UINT32 type, UINT32 cycles)
+{
+    UINT32 num = g_irqStatCriticalNum[type];
+
+    return (num < LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM) || (cycles > g_irqStatCritical[type][num - 1].cycles);
+}
+
+/* The sections that are neither kept nor above the threshold only cost these compares */
+STATIC INLINE BOOL OsIrqStatCriticalWanted(UINT32 type, UINT32 cycles)
+{
+    return OsIrqStatCriticalKeep(type, cycles) || (cycles > g_irqStatCriticalThreshold);
+}
+
+/* Called with interrupts masked, the table may have changed since OsIrqStatCriticalWanted was checked */
+STATIC VOID OsIrqStatCriticalRecord(UINT32 type, UINT32 cycles, const UINTPTR *lr)
+{
+    LOS_IRQSTAT_CRITICAL_S *table = g_irqStatCritical[type];
+    UINT32 index;
+
+    if (OsIrqStatCriticalKeep(type, cycles)) {
+        index = g_irqStatCriticalNum[type];
+        if (index < LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM) {
+            g_irqStatCriticalNum[type]++;
+        } else {
+            index--;
+        }
+
+        while ((index > 0) && (table[index - 1].cycles < cycles)) {
+            table[index] = table[index - 1];
+            index--;
+        }
+
+        table[index].cycles = cycles;
+        table[index].taskID = OS_INT_ACTIVE ? LOS_IRQSTAT_CRITICAL_IN_IRQ : g_losTask.runTask->taskID;
+        (VOID)memcpy_s(table[index].lr, sizeof(table[index].lr), lr, sizeof(table[index].lr));
+    }
+
+    if (cycles > g_irqStatCriticalThreshold) {
+        OsHookCall(LOS_HOOK_TYPE_CRITICAL_SECTION, type, cycles, lr[0]);
+    }
+}
+
+STATIC INLINE UINT32 OsIrqStatCriticalCycles(UINT64 start)
+{
+    UINT64 cycles = LOS_SysCycleGet() - start;
+
+    return (cycles > OS_NULL_INT) ? OS_NULL_INT : (UINT32)cycles;
+}
+
+/*
+ * Called once the section has closed and interrupts are enabled again, so walking the stack does not lengthen any
+ * masked window. The stack is that of the closing function, the first address is replaced by the call site captured
+ * when the section opened.
+ */
+STATIC VOID OsIrqStatCriticalCommit(UINT32 type, UINT32 cycles, UINTPTR openLR, UINTPTR *lr)
+{
+    UINT32 intSave;
+
+    lr[0] = openLR;
+    intSave = ArchIntLock();
+    OsIrqStatCriticalRecord(type, cycles, lr);
+    ArchIntRestore(intSave);
+}
+
+/* Called by LOS_TaskLock with interrupts masked when the lock count leaves 0, lr is the caller of LOS_TaskLock */
+LITE_OS_SEC_TEXT VOID OsIrqStatSchedLock(UINTPTR lr)
+{
+    g_irqStatSchedStart = g_irqStatStarted ? LOS_SysCycleGet() : 0;
+    g_irqStatSchedLR = lr;
+}
+
+/*
+ * Called by LOS_TaskUnlock with interrupts masked when the lock count drops to 0, in place of LOS_IntRestore. The
+ * section is timed before intSave is restored and its stack is recorded after.
+ */
+LITE_OS_SEC_TEXT VOID OsIrqStatSchedUnlock(UINT32 intSave)
+{
+    UINTPTR lr[LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH] = {0};
+    UINTPTR openLR = 0;
+    UINT32 cycles = 0;
+
+    if (g_irqStatSchedStart != 0) {
+        cycles = OsIrqStatCriticalCycles(g_irqStatSchedStart);
+        openLR = g_irqStatSchedLR;
+        g_irqStatSchedStart = 0;
+    }
+    LOS_IntRestore(intSave);
+
+    if ((openLR != 0) && OsIrqStatCriticalWanted(LOS_IRQSTAT_CRITICAL_SCHED, cycles)) {
+        LOS_RecordLR(lr, LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH, OS_IRQSTAT_LR_SKIP_SCHED, 0);
+        OsIrqStatCriticalCommit(LOS_IRQSTAT_CRITICAL_SCHED, cycles, openLR, lr);
+    }
+}
+#endif
+
+STATIC INLINE VOID OsIrqStatRecord(LOS_IRQSTAT_S *stat, UINT64 cycles)
+{
+    UINT32 index = 0;
+    UINT64 scaled = cycles >> LOS_IRQSTAT_HIST_SHIFT;
+
+    if (scaled != 0) {
+        index = (scaled > OS_NULL_INT) ? LOS_IRQSTAT_HIST_NUM : (32 - CLZ((UINT32)scaled)); /* 32, bits of UINT32 */
+        if (index >= LOS_IRQSTAT_HIST_NUM) {
+            index = LOS_IRQSTAT_HIST_NUM - 1;
+        }
+    }
+
+    stat->count++;
+    stat->totalCycles += cycles;
+    if (cycles > stat->maxCycles) {
+        stat->maxCycles = (cycles > OS_NULL_INT) ? OS_NULL_INT : (UINT32)cycles;
+    }
+    stat->hist[index]++;
+}
+
+/*
+ * The interrupt hooks nest with the interrupts themselves, so the frame stack needs no lock: a preempting
+ * interrupt pops its own frame before the preempted one resumes.
+ */
+STATIC VOID OsIrqStatIsrEnter(UINT32 hwiIndex)
+{
+    UINT32 nest = g_irqStatNest++;
+
+    (VOID)hwiIndex;
+    if (nest < OS_IRQSTAT_NEST_MAX) {
+        g_irqStatFrame[nest].nested = 0;
+        g_irqStatFrame[nest].start = LOS_SysCycleGet();
+    }
+}
+
+STATIC VOID OsIrqStatIsrExit(UINT32 hwiIndex)
+{
+    UINT32 nest;
+    UINT64 cycles;
+
+    if (g_irqStatNest == 0) {
+        return; /* The hooks were registered while this interrupt was running */
+    }
+
+    nest = --g_irqStatNest;
+    if (nest >= OS_IRQSTAT_NEST_MAX) {
+        return;
+    }
+
+    cycles = LOS_SysCycleGet() - g_irqStatFrame[nest].start;
+    if (nest > 0) {
+        g_irqStatFrame[nest - 1].nested += cycles;
+    }
+
+    if (hwiIndex < LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT) {
+        OsIrqStatRecord(&g_irqStat[hwiIndex], cycles - g_irqStatFrame[nest].nested);
+    }
+}
+
+/*
+ * Called with interrupts masked. ArchIntLock does not change a masked state, so it returns the state an inner section
+ * would save, and intSave differs from it only when interrupts were enabled as the section opened. Unlike a nesting
+ * counter this needs no matching restore, so a section that is never closed, such as the one ArchStartSchedule
+ * opens, does not stop the later ones from being timed.
+ */
+STATIC INLINE BOOL OsIrqStatIntOutermost(UINT32 intSave)
+{
+    return (intSave != ArchIntLock());
+}
+
+/*
+ * Only the outermost section is timed. The LOS_IntLock sections inside LOS_SysCycleGet open with interrupts
+ * already masked, so they do not recurse.
+ */
+LITE_OS_SEC_TEXT UINT32 OsIrqStatIntLock(VOID)
+{
+    UINT32 intSave = ArchIntLock();
+
+    if (OsIrqStatIntOutermost(intSave)) {
+        g_irqStatMaskStart = g_irqStatStarted ? LOS_SysCycleGet() : 0;
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+        g_irqStatMaskLR = (UINTPTR)__builtin_return_address(0);
+#endif
+    }
+    return intSave;
+}
+
+LITE_OS_SEC_TEXT VOID OsIrqStatIntRestore(UINT32 intSave)
+{
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+    UINTPTR lr[LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH] = {0};
+    UINTPTR openLR = 0;
+    UINT32 cycles = 0;
+#endif
+
+    if ((g_irqStatMaskStart != 0) && OsIrqStatIntOutermost(intSave)) {
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+        cycles = OsIrqStatCriticalCycles(g_irqStatMaskStart);
+        openLR = g_irqStatMaskLR;
+        OsIrqStatRecord(&g_irqStatMask, cycles);
+#else
+        OsIrqStatRecord(&g_irqStatMask, LOS_SysCycleGet() - g_irqStatMaskStart);
+#endif
+        g_irqStatMaskStart = 0;
+    }
+    ArchIntRestore(intSave);
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+    if ((openLR != 0) && OsIrqStatCriticalWanted(LOS_IRQSTAT_CRITICAL_IRQ, cycles)) {
+        LOS_RecordLR(lr, LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH, OS_IRQSTAT_LR_SKIP_IRQ, 0);
+        OsIrqStatCriticalCommit(LOS_IRQSTAT_CRITICAL_IRQ, cycles, openLR, lr);
+    }
+#endif
+}
+
+UINT32 LOS_IrqStatGet(UINT32 hwiIndex, LOS_IRQSTAT_S *stat)
+{
+    UINT32 intSave;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_IRQSTAT_PTR_NULL;
+    }
+
+    if (hwiIndex >= LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT) {
+        return LOS_ERRNO_IRQSTAT_INDEX_INVALID;
+    }
+
+    intSave = ArchIntLock();
+    *stat = g_irqStat[hwiIndex];
+    ArchIntRestore(intSave);
+    return LOS_OK;
+}
+
+UINT32 LOS_IrqStatMaskGet(LOS_IRQSTAT_S *stat)
+{
+    UINT32 intSave;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_IRQSTAT_PTR_NULL;
+    }
+
+    intSave = ArchIntLock();
+    *stat = g_irqStatMask;
+    ArchIntRestore(intSave);
+    return LOS_OK;
+}
+
+VOID LOS_IrqStatReset(VOID)
+{
+    UINT32 intSave = ArchIntLock();
+    (VOID)memset_s(g_irqStat, sizeof(g_irqStat), 0, sizeof(g_irqStat));
+    (VOID)memset_s(&g_irqStatMask, sizeof(g_irqStatMask), 0, sizeof(g_irqStatMask));
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+    (VOID)memset_s(g_irqStatCritical, sizeof(g_irqStatCritical), 0, sizeof(g_irqStatCritical));
+    (VOID)memset_s(g_irqStatCriticalNum, sizeof(g_irqStatCriticalNum), 0, sizeof(g_irqStatCriticalNum));
+#endif
+    ArchIntRestore(intSave);
+}
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+UINT32 LOS_IrqStatCriticalGet(UINT32 type, LOS_IRQSTAT_CRITICAL_S *table, UINT32 *num)
+{
+    UINT32 intSave;
+    UINT32 count;
+
+    if ((table == NULL) || (num == NULL)) {
+        return LOS_ERRNO_IRQSTAT_PTR_NULL;
+    }
+
+    if (type >= LOS_IRQSTAT_CRITICAL_TYPE_NUM) {
+        return LOS_ERRNO_IRQSTAT_TYPE_INVALID;
+    }
+
+    intSave = ArchIntLock();
+    count = (*num < g_irqStatCriticalNum[type]) ? *num : g_irqStatCriticalNum[type];
+    if (count != 0) {
+        (VOID)memcpy_s(table, count * sizeof(LOS_IRQSTAT_CRITICAL_S), g_irqStatCritical[type],
+                       count * sizeof(LOS_IRQSTAT_CRITICAL_S));
+    }
+    ArchIntRestore(intSave);
+
+    *num = count;
+    return LOS_OK;
+}
+
+VOID LOS_IrqStatCriticalThresholdSet(UINT32 us)
+{
+    UINT64 cycles = ((UINT64)us * g_sysClock) / OS_SYS_US_PER_SECOND;
+
+    g_irqStatCriticalThreshold = (cycles > OS_NULL_INT) ? OS_NULL_INT : (UINT32)cycles;
+}
+
+STATIC VOID OsIrqStatCriticalShow(UINT32 type, const CHAR *name)
+{
+    LOS_IRQSTAT_CRITICAL_S table[LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM];
+    UINT32 num = LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM;
+    UINT32 index;
+    UINT32 depth;
+
+    (VOID)LOS_IrqStatCriticalGet(type, table, &num);
+    for (index = 0; index < num; index++) {
+        PRINTK("%-6s%-10u", name, OS_IRQSTAT_CYCLE_TO_US(table[index].cycles));
+        if (table[index].taskID == LOS_IRQSTAT_CRITICAL_IN_IRQ) {
+            PRINTK("%-6s", "irq");
+        } else {
+            PRINTK("%-6u", table[index].taskID);
+        }
+        for (depth = 0; (depth < LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH) && (table[index].lr[depth] != 0); depth++) {
+            PRINTK(" 0x%x", table[index].lr[depth]);
+        }
+        PRINTK("\n");
+    }
+}
+#endif
+
+STATIC VOID OsIrqStatShowOne(const CHAR *name, UINT32 index, const LOS_IRQSTAT_S *stat)
+{
+    UINT32 bucket;
+
+    PRINTK("%-6s%-6u%-12u%-14llu%-12u%-12u\n", name, index, stat->count,
+           OS_SYS_CYCLE_TO_NS(stat->totalCycles, g_sysClock) / OS_SYS_NS_PER_US,
+           OS_IRQSTAT_CYCLE_TO_US(stat->maxCycles), OS_IRQSTAT_CYCLE_TO_US(stat->totalCycles / stat->count));
+    PRINTK("      hist:");
+    for (bucket = 0; bucket < LOS_IRQSTAT_HIST_NUM; bucket++) {
+        PRINTK(" %u", stat->hist[bucket]);
+    }
+    PRINTK("\n");
+}
+
+VOID LOS_IrqStatShow(VOID)
+{
+    UINT32 index;
+    LOS_IRQSTAT_S stat;
+
+    PRINTK("\n%-6s%-6s%-12s%-14s%-12s%-12s\n", "Type", "Index", "Count", "Total(us)", "Max(us)", "Avg(us)");
+    for (index = 0; index < LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT; index++) {
+        (VOID)LOS_IrqStatGet(index, &stat);
+        if (stat.count != 0) {
+            OsIrqStatShowOne("irq", index, &stat);
+        }
+    }
+
+    (VOID)LOS_IrqStatMaskGet(&stat);
+    if (stat.count != 0) {
+        OsIrqStatShowOne("mask", 0, &stat);
+    }
+    PRINTK("hist: log2 buckets of duration, the first bucket counts below %u cycles\n",
+           1U << LOS_IRQSTAT_HIST_SHIFT);
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+    PRINTK("\n%-6s%-10s%-6s%s\n", "Type", "Time(us)", "Task", "Call stack");
+    OsIrqStatCriticalShow(LOS_IRQSTAT_CRITICAL_IRQ, "mask");
+    OsIrqStatCriticalShow(LOS_IRQSTAT_CRITICAL_SCHED, "lock");
+#endif
+}
+
+UINT32 OsIrqStatInit(VOID)
+{
+    UINT32 ret;
+
+    ret = LOS_HookReg(LOS_HOOK_TYPE_ISR_ENTER, OsIrqStatIsrEnter);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    ret = LOS_HookReg(LOS_HOOK_TYPE_ISR_EXIT, OsIrqStatIsrExit);
+    if (ret != LOS_OK) {
+        (VOID)LOS_HookUnReg(LOS_HOOK_TYPE_ISR_ENTER, OsIrqStatIsrEnter);
+        return ret;
+    }
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+    LOS_IrqStatCriticalThresholdSet(LOSCFG_KERNEL_IRQSTAT_CRITICAL_THRESHOLD_US);
+#endif
+    g_irqStatStarted = TRUE;
+    return LOS_OK;
+}
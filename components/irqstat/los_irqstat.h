@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_irqstat Interrupt statistics
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_IRQSTAT_H
+#define _LOS_IRQSTAT_H
+
+#include "los_config.h"
+#include "los_compiler.h"
+#include "los_error.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_irqstat
+ * Interrupt statistics error code: The passed-in pointer is NULL.
+ *
+ * Value: 0x02002300
+ *
+ */
+#define LOS_ERRNO_IRQSTAT_PTR_NULL              LOS_ERRNO_OS_ERROR(LOS_MOD_IRQSTAT, 0x00)
+
+/**
+ * @ingroup los_irqstat
+ * Interrupt statistics error code: The interrupt index is not below LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT.
+ *
+ * Value: 0x02002301
+ *
+ */
+#define LOS_ERRNO_IRQSTAT_INDEX_INVALID         LOS_ERRNO_OS_ERROR(LOS_MOD_IRQSTAT, 0x01)
+
+/**
+ * @ingroup los_irqstat
+ * Interrupt statistics error code: The critical section type is invalid.
+ *
+ * Value: 0x02002302
+ *
+ */
+#define LOS_ERRNO_IRQSTAT_TYPE_INVALID          LOS_ERRNO_OS_ERROR(LOS_MOD_IRQSTAT, 0x02)
+
+/**
+ * @ingroup los_irqstat
+ * Number of duration histogram buckets. Bucket 0 counts durations below 2^LOS_IRQSTAT_HIST_SHIFT cycles, bucket n
+ * counts durations in [2^(LOS_IRQSTAT_HIST_SHIFT + n - 1), 2^(LOS_IRQSTAT_HIST_SHIFT + n)) cycles, and the last
+ * bucket also counts everything longer.
+ */
+#define LOS_IRQSTAT_HIST_NUM                    16
+#define LOS_IRQSTAT_HIST_SHIFT                  4
+
+/**
+ * @ingroup los_irqstat
+ * Statistics of an interrupt, or of the interrupt masked sections
+ */
+typedef struct {
+    UINT32 count;                           /**< Number of interrupts or masked sections */
+    UINT32 maxCycles;                       /**< Longest duration */
+    UINT64 totalCycles;                     /**< Sum of the durations */
+    UINT32 hist[LOS_IRQSTAT_HIST_NUM];      /**< log2 duration histogram */
+} LOS_IRQSTAT_S;
+
+/**
+ * @ingroup los_irqstat
+ * @brief Obtain the statistics of an interrupt.
+ *
+ * @par Description:
+ * This API is used to obtain how often an interrupt fired and how long its handler ran. The duration excludes the
+ * time spent in the interrupts that preempted it.
+ *
+ * @param  hwiIndex     [IN] Interrupt index passed to the interrupt hooks, see LOS_HwiCurIrqNum.
+ * @param  stat         [OUT] Statistics of the interrupt.
+ *
+ * @retval #LOS_ERRNO_IRQSTAT_PTR_NULL         The stat is NULL.
+ * @retval #LOS_ERRNO_IRQSTAT_INDEX_INVALID    Invalid interrupt index.
+ * @retval #LOS_OK                             The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_irqstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_IrqStatMaskGet
+ */
+extern UINT32 LOS_IrqStatGet(UINT32 hwiIndex, LOS_IRQSTAT_S *stat);
+
+/**
+ * @ingroup los_irqstat
+ * @brief Obtain the statistics of the interrupt masked sections.
+ *
+ * @par Description:
+ * This API is used to obtain how often and how long the outermost LOS_IntLock sections kept interrupts masked.
+ *
+ * @param  stat         [OUT] Statistics of the masked sections.
+ *
+ * @retval #LOS_ERRNO_IRQSTAT_PTR_NULL         The stat is NULL.
+ * @retval #LOS_OK                             The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_irqstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_IrqStatGet
+ */
+extern UINT32 LOS_IrqStatMaskGet(LOS_IRQSTAT_S *stat);
+
+/**
+ * @ingroup los_irqstat
+ * @brief Clear all interrupt statistics.
+ */
+extern VOID LOS_IrqStatReset(VOID);
+
+/**
+ * @ingroup los_irqstat
+ * @brief Print the statistics of the interrupts that fired, of the masked sections and the longest critical sections.
+ */
+extern VOID LOS_IrqStatShow(VOID);
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+/**
+ * @ingroup los_irqstat
+ * Critical section type: interrupts masked by LOS_IntLock.
+ */
+#define LOS_IRQSTAT_CRITICAL_IRQ                0
+
+/**
+ * @ingroup los_irqstat
+ * Critical section type: scheduling held off by LOS_TaskLock.
+ */
+#define LOS_IRQSTAT_CRITICAL_SCHED              1
+
+#define LOS_IRQSTAT_CRITICAL_TYPE_NUM           2
+
+/**
+ * @ingroup los_irqstat
+ * Task ID recorded for the critical sections closed in interrupt context.
+ */
+#define LOS_IRQSTAT_CRITICAL_IN_IRQ             0xFFFFFFFF
+
+/**
+ * @ingroup los_irqstat
+ * One of the longest critical sections
+ */
+typedef struct {
+    UINT32 cycles;                                          /**< Duration of the section */
+    UINT32 taskID;                                          /**< Running task, or LOS_IRQSTAT_CRITICAL_IN_IRQ */
+    UINTPTR lr[LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH];    /**< Call site that opened the section, then the
+                                                                 callers of the function that closed it, zero
+                                                                 terminated if shorter */
+} LOS_IRQSTAT_CRITICAL_S;
+
+/**
+ * @ingroup los_irqstat
+ * @brief Obtain the longest critical sections of a type.
+ *
+ * @par Description:
+ * This API is used to obtain the longest outermost critical sections, longest first. The call site is captured when
+ * the section opens. The rest of the stack is recorded after the section has closed, so it shows the callers of the
+ * opener as long as the lock and unlock calls are in the same function.
+ *
+ * @attention
+ * <ul>
+ * <li>The stack is walked with interrupts enabled again, so recording it does not lengthen the measured sections.</li>
+ * </ul>
+ *
+ * @param  type         [IN] LOS_IRQSTAT_CRITICAL_IRQ or LOS_IRQSTAT_CRITICAL_SCHED.
+ * @param  table        [OUT] Buffer for the sections.
+ * @param  num          [IN/OUT] Number of entries of the table on input, number of sections obtained on output.
+ *
+ * @retval #LOS_ERRNO_IRQSTAT_PTR_NULL         The table or the num is NULL.
+ * @retval #LOS_ERRNO_IRQSTAT_TYPE_INVALID     Invalid critical section type.
+ * @retval #LOS_OK                             The sections are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_irqstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_IrqStatCriticalThresholdSet
+ */
+extern UINT32 LOS_IrqStatCriticalGet(UINT32 type, LOS_IRQSTAT_CRITICAL_S *table, UINT32 *num);
+
+/**
+ * @ingroup los_irqstat
+ * @brief Set the duration above which a critical section fires LOS_HOOK_TYPE_CRITICAL_SECTION.
+ *
+ * @par Description:
+ * The hook gets the section type, its duration in cycles and the call site, and is converted to the
+ * SYS_CRITICAL_SECTION trace event. The default is LOSCFG_KERNEL_IRQSTAT_CRITICAL_THRESHOLD_US.
+ *
+ * @param  us           [IN] Threshold in microseconds.
+ *
+ * @par Dependency:
+ * <ul><li>los_irqstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_IrqStatCriticalGet
+ */
+extern VOID LOS_IrqStatCriticalThresholdSet(UINT32 us);
+
+extern VOID OsIrqStatSchedLock(UINTPTR lr);
+extern VOID OsIrqStatSchedUnlock(UINT32 intSave);
+#endif
+
+extern UINT32 OsIrqStatInit(VOID);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_IRQSTAT_H */
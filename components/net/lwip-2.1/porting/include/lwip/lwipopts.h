@@ -230,6 +230,32 @@
 // use PBUF_RAM instead of PBUF_POOL in udp_input
 #define USE_PBUF_RAM_UDP_INPUT          1
 
+// mboxes that can be posted from interrupts, and the messages each one buffers (a power of 2)
+#ifndef LWIP_SYS_MBOX_ISR_NUM
+#define LWIP_SYS_MBOX_ISR_NUM           2
+#endif
+#ifndef LWIP_SYS_MBOX_ISR_SIZE
+#define LWIP_SYS_MBOX_ISR_SIZE          32
+#endif
+
+// packets a netif can hold for tcpip_thread through driverif_input_batch
+#ifndef DRIVERIF_RX_BATCH_MAX
+#define DRIVERIF_RX_BATCH_MAX           64
+#endif
+
+// zero-copy drivers: segments of a frame passed to drv_send_sg, transmit completions a netif holds
+// for tcpip_thread, and alignment of the DMA buffers (the cache line size)
+#ifndef DRIVERIF_TX_SG_MAX
+#define DRIVERIF_TX_SG_MAX              8
+#endif
+#ifndef DRIVERIF_TX_DONE_MAX
+#define DRIVERIF_TX_DONE_MAX            16
+#endif
+#ifndef DRIVERIF_DMA_ALIGN
+#define DRIVERIF_DMA_ALIGN              32
+#endif
+#define LWIP_SUPPORT_CUSTOM_PBUF        1
+
 #ifdef LOSCFG_FS_VFS
 #include "vfs_config.h"
 #define LWIP_SOCKET_OFFSET              CONFIG_NFILE_DESCRIPTORS
@@ -43,12 +43,23 @@
                                             LWIP_NETIF_CLIENT_DATA_INDEX_DHCPS
 #endif
 
+struct driverif_sg;
+
 #define linkoutput      linkoutput; \
                         void (*drv_send)(struct netif *netif, struct pbuf *p); \
                         u8_t (*drv_set_hwaddr)(struct netif *netif, u8_t *addr, u8_t len); \
                         void (*drv_config)(struct netif *netif, u32_t config_flags, u8_t setBit); \
                         char full_name[IFNAMSIZ]; \
-                        u16_t link_layer_type
+                        u16_t link_layer_type; \
+                        u16_t rx_batch_len; \
+                        u8_t rx_batch_posted; \
+                        struct pbuf *rx_batch_head; \
+                        struct pbuf *rx_batch_tail; \
+                        struct tcpip_callback_msg *rx_batch_msg; \
+                        err_t (*drv_send_sg)(struct netif *netif, const struct driverif_sg *sg, u16_t count, \
+                                             struct pbuf *p); \
+                        u8_t tx_done_len; \
+                        struct pbuf *tx_done[DRIVERIF_TX_DONE_MAX]
 #include_next <lwip/netif.h>
 #undef linkoutput
 #if LWIP_DHCPS
@@ -72,6 +83,27 @@ extern "C" {
 
 err_t driverif_init(struct netif *netif);
 void driverif_input(struct netif *netif, struct pbuf *p);
+err_t driverif_input_batch(struct netif *netif, struct pbuf *pkts);
+
+/* One segment of a frame passed to drv_send_sg, the DMA engine reads len bytes at payload */
+struct driverif_sg {
+    void *payload;
+    u16_t len;
+};
+
+/* Receive buffers of a zero-copy driver, carved from a DMA-capable memory region */
+struct driverif_dma_pool {
+    void *box;          /* membox laid over the region */
+    u16_t buf_size;     /* bytes the DMA engine may write into each buffer */
+};
+
+/* Where the DMA engine writes the frame received into a pbuf from driverif_rx_buf_alloc */
+#define DRIVERIF_RX_DMA_ADDR(p) ((u8_t *)(p)->payload + ETH_PAD_SIZE)
+
+err_t driverif_dma_pool_init(struct driverif_dma_pool *pool, void *region, u32_t size, u16_t buf_size);
+struct pbuf *driverif_rx_buf_alloc(struct driverif_dma_pool *pool);
+void driverif_rx_buf_complete(struct pbuf *p, u16_t len);
+err_t driverif_tx_complete(struct netif *netif, struct pbuf *p);
 
 #define netif_get_name(netif) ((netif)->full_name)
 
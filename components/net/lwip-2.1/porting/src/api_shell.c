@@ -533,7 +533,7 @@ u32_t OsShellPing(int argc, const char **argv)
     u32_t interval = 1000; /* default ping interval */
     u32_t data_len = 48; /* default data length */
     ip4_addr_t dst_ipaddr;
-    TSK_INIT_PARAM_S stPingTask;
+    TSK_INIT_PARAM_S stPingTask = {0};
     u32_t *parg = NULL;
 
     if ((argc < 1) || (argv == NULL)) {
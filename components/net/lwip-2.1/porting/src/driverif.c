@@ -35,6 +35,11 @@
 #include <lwip/etharp.h>
 #include <lwip/sockets.h>
 #include <lwip/ethip6.h>
+#include <lwip/tcpip.h>
+#include <lwip/ip.h>
+#include <netif/ethernet.h>
+#include <los_interrupt.h>
+#include <los_membox.h>
 
 #define LWIP_NETIF_HOSTNAME_DEFAULT         "default"
 #define LINK_SPEED_OF_YOUR_NETIF_IN_BPS     100000000 // 100Mbps
@@ -53,6 +58,17 @@
 #define LWIP_NETIF_IFINDEX_MAX_EX 255
 #endif
 
+#define DRIVERIF_DMA_ALIGN_UP(addr) (((UINTPTR)(addr) + DRIVERIF_DMA_ALIGN - 1) & ~((UINTPTR)DRIVERIF_DMA_ALIGN - 1))
+
+/*
+ * A block of a DMA pool starts with the pbuf describing it, the DMA buffer follows at the next
+ * DRIVERIF_DMA_ALIGN boundary, ETH_PAD_SIZE bytes after the pbuf payload.
+ */
+struct driverif_dma_buf {
+    struct pbuf_custom pc;
+    struct driverif_dma_pool *pool;
+};
+
 LWIP_STATIC void driverif_get_ifname_prefix(struct netif *netif, char *prefix, int prefixLen)
 {
     if (prefix == NULL || netif == NULL) {
@@ -106,6 +122,42 @@ LWIP_STATIC void driverif_init_ifname(struct netif *netif)
     netif->full_name[0] = '\0';
 }
 
+/*
+ * Hand the pbufs of a frame to a scatter-gather driver without linearizing them. The driver keeps a
+ * reference on the frame until it calls driverif_tx_complete(). Frames with more segments than
+ * DRIVERIF_TX_SG_MAX are copied into a single pbuf first.
+ */
+LWIP_STATIC err_t driverif_output_sg(struct netif *netif, struct pbuf *p)
+{
+    struct driverif_sg sg[DRIVERIF_TX_SG_MAX];
+    struct pbuf *q = NULL;
+    u16_t count = 0;
+    err_t ret;
+
+    if (pbuf_clen(p) > DRIVERIF_TX_SG_MAX) {
+        p = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+        if (p == NULL) {
+            return ERR_MEM;
+        }
+    } else {
+        pbuf_ref(p);
+    }
+
+    for (q = p; q != NULL; q = q->next) {
+        if (q->len != 0) {
+            sg[count].payload = q->payload;
+            sg[count].len = q->len;
+            count++;
+        }
+    }
+
+    ret = netif->drv_send_sg(netif, sg, count, p);
+    if (ret != ERR_OK) {
+        (void)pbuf_free(p);
+    }
+    return ret;
+}
+
 /*
  * This function should do the actual transmission of the packet. The packet is
  * contained in the pbuf that is passed to the function. This pbuf
@@ -139,7 +191,13 @@ LWIP_STATIC err_t driverif_output(struct netif *netif, struct pbuf *p)
     (void)pbuf_header(p, -ETH_PAD_SIZE); /* drop the padding word */
 #endif
 
-    netif->drv_send(netif, p);
+    if (netif->drv_send_sg != NULL) {
+        if (driverif_output_sg(netif, p) != ERR_OK) {
+            LINK_STATS_INC(link.drop);
+        }
+    } else {
+        netif->drv_send(netif, p);
+    }
 
 #if ETH_PAD_SIZE
     (void)pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
@@ -150,7 +208,7 @@ LWIP_STATIC err_t driverif_output(struct netif *netif, struct pbuf *p)
     return ERR_OK;
 }
 
-void driverif_input_proc(struct netif *netif, struct pbuf *p)
+LWIP_STATIC void driverif_input_type_proc(struct netif *netif, struct pbuf *p, netif_input_fn input)
 {
     u16_t ethhdr_type;
     struct eth_hdr *ethhdr = NULL;
@@ -169,8 +227,8 @@ void driverif_input_proc(struct netif *netif, struct pbuf *p)
 #endif /* ETHARP_SUPPORT_VLAN */
             LWIP_DEBUGF(DRIVERIF_DEBUG, ("driverif_input : received packet of type %"U16_F"\n", ethhdr_type));
             /* full packet send to tcpip_thread to process */
-            if (netif->input != NULL) {
-                ret = netif->input(p, netif);
+            if (input != NULL) {
+                ret = input(p, netif);
             }
 
             if (ret != ERR_OK) {
@@ -197,18 +255,12 @@ void driverif_input_proc(struct netif *netif, struct pbuf *p)
     }
 }
 
-/*
- * This function should be called by network driver to pass the input packet to LwIP.
- * Before calling this API, driver has to keep the packet in pbuf structure. Driver has to
- * call pbuf_alloc() with type as PBUF_RAM to create pbuf structure. Then driver
- * has to pass the pbuf structure to this API. This will add the pbuf into the TCPIP thread.
- * Once this packet is processed by TCPIP thread, pbuf will be freed. Driver is not required to
- * free the pbuf.
- *
- * @param netif the lwip network interface structure for this driverif
- * @param p packet in pbuf structure format
- */
-void driverif_input(struct netif *netif, struct pbuf *p)
+void driverif_input_proc(struct netif *netif, struct pbuf *p)
+{
+    driverif_input_type_proc(netif, p, netif->input);
+}
+
+LWIP_STATIC void driverif_input_pkt(struct netif *netif, struct pbuf *p, netif_input_fn input)
 {
 #if PF_PKT_SUPPORT
 #if  (DRIVERIF_DEBUG & LWIP_DBG_OFF)
@@ -218,8 +270,6 @@ void driverif_input(struct netif *netif, struct pbuf *p)
     err_t ret = ERR_VAL;
 #endif
 
-    LWIP_ERROR("driverif_input : invalid arguments", ((netif != NULL) && (p != NULL)), return);
-
     LWIP_DEBUGF(DRIVERIF_DEBUG, ("driverif_input : going to receive input packet. netif 0x%p, pbuf 0x%p, \
         packet_length %"U16_F"\n", (void *)netif, (void *)p, p->tot_len));
 
@@ -237,12 +287,12 @@ void driverif_input(struct netif *netif, struct pbuf *p)
     ethhdr = (struct eth_hdr *)p->payload;
     ethhdr_type = ntohs(ethhdr->type);
     LWIP_DEBUGF(DRIVERIF_DEBUG, ("driverif_input : received packet of type %"U16_F" netif->input=%p\n", \
-        ethhdr_type, netif->input));
+        ethhdr_type, input));
 #endif
 
     /* full packet send to tcpip_thread to process */
-    if (netif->input) {
-        ret = netif->input(p, netif);
+    if (input) {
+        ret = input(p, netif);
     }
     if (ret != ERR_OK) {
         LWIP_DEBUGF(DRIVERIF_DEBUG, ("driverif_input: IP input error\n"));
@@ -257,12 +307,283 @@ void driverif_input(struct netif *netif, struct pbuf *p)
     }
 
 #else
-    driverif_input_proc(netif, p);
+    driverif_input_type_proc(netif, p, input);
 #endif
 
     LWIP_DEBUGF(DRIVERIF_DEBUG, ("driverif_input : received packet is processed\n"));
 }
 
+/*
+ * This function should be called by network driver to pass the input packet to LwIP.
+ * Before calling this API, driver has to keep the packet in pbuf structure. Driver has to
+ * call pbuf_alloc() with type as PBUF_RAM to create pbuf structure, or receive the packet into
+ * a buffer from driverif_rx_buf_alloc() without copying. Then driver
+ * has to pass the pbuf structure to this API. This will add the pbuf into the TCPIP thread.
+ * Once this packet is processed by TCPIP thread, pbuf will be freed. Driver is not required to
+ * free the pbuf.
+ *
+ * @param netif the lwip network interface structure for this driverif
+ * @param p packet in pbuf structure format
+ */
+void driverif_input(struct netif *netif, struct pbuf *p)
+{
+    LWIP_ERROR("driverif_input : invalid arguments", ((netif != NULL) && (p != NULL)), return);
+
+    driverif_input_pkt(netif, p, netif->input);
+}
+
+/* Runs in tcpip_thread, so packets are handed to the stack directly instead of through netif->input */
+LWIP_STATIC err_t driverif_input_local(struct pbuf *p, struct netif *netif)
+{
+#if LWIP_ETHERNET
+    if (netif->flags & (NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET)) {
+        return ethernet_input(p, netif);
+    }
+#endif
+    return ip_input(p, netif);
+}
+
+LWIP_STATIC void driverif_batch_proc(void *ctx)
+{
+    struct netif *netif = (struct netif *)ctx;
+    struct pbuf *tx_done[DRIVERIF_TX_DONE_MAX];
+    struct pbuf *pkts = NULL;
+    struct pbuf *p = NULL;
+    struct pbuf *q = NULL;
+    u8_t tx_done_len;
+    UINT32 intSave;
+
+    intSave = LOS_IntLock();
+    pkts = netif->rx_batch_head;
+    netif->rx_batch_head = NULL;
+    netif->rx_batch_tail = NULL;
+    netif->rx_batch_len = 0;
+    tx_done_len = netif->tx_done_len;
+    for (u8_t i = 0; i < tx_done_len; i++) {
+        tx_done[i] = netif->tx_done[i];
+    }
+    netif->tx_done_len = 0;
+    netif->rx_batch_posted = 0;
+    LOS_IntRestore(intSave);
+
+    for (u8_t i = 0; i < tx_done_len; i++) {
+        (void)pbuf_free(tx_done[i]);
+    }
+
+    while (pkts != NULL) {
+        p = pkts;
+        for (q = p; (q->tot_len != q->len) && (q->next != NULL); q = q->next) {
+        }
+        pkts = q->next;
+        q->next = NULL;
+        driverif_input_pkt(netif, p, driverif_input_local);
+    }
+}
+
+/*
+ * Hand the queued packets and transmit completions of the netif to tcpip_thread in one message.
+ * Called with interrupts masked, so that no other caller queues behind a message that failed.
+ */
+LWIP_STATIC err_t driverif_batch_post(struct netif *netif)
+{
+    err_t ret;
+
+    if (netif->rx_batch_posted) {
+        return ERR_OK;
+    }
+
+    ret = OS_INT_ACTIVE ? tcpip_callbackmsg_trycallback_fromisr(netif->rx_batch_msg) :
+                          tcpip_callbackmsg_trycallback(netif->rx_batch_msg);
+    if (ret != ERR_OK) {
+        LWIP_DEBUGF(DRIVERIF_DEBUG, ("driverif_batch_post : post error %d\n", ret));
+        return ret;
+    }
+    netif->rx_batch_posted = 1;
+    return ERR_OK;
+}
+
+/*
+ * This function may be called by network driver, from its receive interrupt or from a task, to pass
+ * several input packets to LwIP at once. The packets are queued on the netif and a single message
+ * hands the whole queue to the TCPIP thread, which processes the packets without further messages.
+ *
+ * Packets are linked through the next field of the last pbuf of each packet, the one whose tot_len
+ * equals its len, as in the pbuf queues of LwIP. Do not link them with pbuf_cat() or pbuf_chain(),
+ * which would merge them into a single packet.
+ *
+ * @param netif the lwip network interface structure for this driverif
+ * @param pkts queue of packets in pbuf structure format
+ * @return ERR_OK if the packets are queued, they are freed once processed
+ *         ERR_MEM if the netif already holds DRIVERIF_RX_BATCH_MAX packets or the TCPIP thread
+ *         mailbox is full, the packets still belong to the driver, which may resubmit them
+ *         ERR_IF if the netif was not initialized by driverif_init
+ */
+err_t driverif_input_batch(struct netif *netif, struct pbuf *pkts)
+{
+    struct pbuf *last = NULL;
+    struct pbuf *prev_tail = NULL;
+    u16_t count = 0;
+    UINT32 intSave;
+
+    LWIP_ERROR("driverif_input_batch : invalid arguments", ((netif != NULL) && (pkts != NULL)), return ERR_ARG);
+    LWIP_ERROR("driverif_input_batch : no batch message", (netif->rx_batch_msg != NULL), return ERR_IF);
+
+    for (last = pkts; ; last = last->next) {
+        if (last->tot_len == last->len) {
+            count++;
+        }
+        if (last->next == NULL) {
+            break;
+        }
+    }
+
+    intSave = LOS_IntLock();
+    if ((netif->rx_batch_len + count) > DRIVERIF_RX_BATCH_MAX) {
+        LOS_IntRestore(intSave);
+        LINK_STATS_INC(link.link_rx_overrun);
+        return ERR_MEM;
+    }
+    prev_tail = netif->rx_batch_tail;
+    if (prev_tail == NULL) {
+        netif->rx_batch_head = pkts;
+    } else {
+        prev_tail->next = pkts;
+    }
+    netif->rx_batch_tail = last;
+    netif->rx_batch_len += count;
+    if (driverif_batch_post(netif) != ERR_OK) {
+        /* nothing is posted, so the queue held nothing before: give the packets back to the driver */
+        if (prev_tail == NULL) {
+            netif->rx_batch_head = NULL;
+        } else {
+            prev_tail->next = NULL;
+        }
+        netif->rx_batch_tail = prev_tail;
+        netif->rx_batch_len -= count;
+        LOS_IntRestore(intSave);
+        LINK_STATS_INC(link.link_rx_overrun);
+        return ERR_MEM;
+    }
+    LOS_IntRestore(intSave);
+
+    return ERR_OK;
+}
+
+/*
+ * This function should be called by a scatter-gather driver once the frame passed to drv_send_sg has
+ * been transmitted, to release the reference the driver holds. In interrupt context the frame is freed
+ * later by the TCPIP thread.
+ *
+ * @param netif the lwip network interface structure for this driverif
+ * @param p the frame passed to drv_send_sg
+ * @return ERR_OK if the frame is released or will be
+ *         ERR_MEM if DRIVERIF_TX_DONE_MAX completions are already pending or the TCPIP thread mailbox
+ *         is full, try again later
+ */
+err_t driverif_tx_complete(struct netif *netif, struct pbuf *p)
+{
+    UINT32 intSave;
+
+    LWIP_ERROR("driverif_tx_complete : invalid arguments", ((netif != NULL) && (p != NULL)), return ERR_ARG);
+
+    if (!OS_INT_ACTIVE) {
+        (void)pbuf_free(p);
+        return ERR_OK;
+    }
+
+    intSave = LOS_IntLock();
+    if (netif->tx_done_len >= DRIVERIF_TX_DONE_MAX) {
+        LOS_IntRestore(intSave);
+        return ERR_MEM;
+    }
+    netif->tx_done[netif->tx_done_len++] = p;
+    if (driverif_batch_post(netif) != ERR_OK) {
+        netif->tx_done_len--;
+        LOS_IntRestore(intSave);
+        return ERR_MEM;
+    }
+    LOS_IntRestore(intSave);
+    return ERR_OK;
+}
+
+LWIP_STATIC void driverif_dma_buf_free(struct pbuf *p)
+{
+    struct driverif_dma_buf *buf = (struct driverif_dma_buf *)p;
+
+    (void)LOS_MemboxFree(buf->pool->box, buf);
+}
+
+/*
+ * Lay a pool of receive buffers over a DMA-capable memory region, for drivers that receive frames
+ * directly into the pbufs handed to the stack.
+ *
+ * @param pool the pool to initialize
+ * @param region start of the DMA-capable region, holding the buffers and their pbufs
+ * @param size size of the region in bytes
+ * @param buf_size bytes the DMA engine may write into each buffer
+ * @return ERR_OK if the pool is initialized
+ *         ERR_MEM if the region cannot hold a single buffer
+ */
+err_t driverif_dma_pool_init(struct driverif_dma_pool *pool, void *region, u32_t size, u16_t buf_size)
+{
+    UINT32 blkSize = sizeof(struct driverif_dma_buf) + ETH_PAD_SIZE + DRIVERIF_DMA_ALIGN - 1 + buf_size;
+
+    LWIP_ERROR("driverif_dma_pool_init : invalid arguments", ((pool != NULL) && (region != NULL) && (buf_size != 0)),
+        return ERR_ARG);
+    LWIP_ERROR("driverif_dma_pool_init : buffer too large", ((buf_size + ETH_PAD_SIZE) <= 0xFFFF), return ERR_ARG);
+
+    if (LOS_MemboxInit(region, size, blkSize) != LOS_OK) {
+        return ERR_MEM;
+    }
+    pool->box = region;
+    pool->buf_size = buf_size;
+    return ERR_OK;
+}
+
+/*
+ * Take a receive buffer from a DMA pool, to post it to the receive descriptors of the driver. The
+ * DMA engine writes the frame at DRIVERIF_RX_DMA_ADDR(p), once done the driver calls
+ * driverif_rx_buf_complete() and passes the pbuf to driverif_input() or driverif_input_batch().
+ * The buffer returns to the pool when the stack frees the pbuf. Safe in interrupt context.
+ *
+ * @param pool the DMA pool
+ * @return the pbuf of the buffer, NULL if the pool is empty
+ */
+struct pbuf *driverif_rx_buf_alloc(struct driverif_dma_pool *pool)
+{
+    struct driverif_dma_buf *buf = NULL;
+    u8_t *dma = NULL;
+    u16_t len;
+
+    LWIP_ERROR("driverif_rx_buf_alloc : invalid arguments", (pool != NULL), return NULL);
+
+    buf = (struct driverif_dma_buf *)LOS_MemboxAlloc(pool->box);
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    buf->pool = pool;
+    buf->pc.custom_free_function = driverif_dma_buf_free;
+    dma = (u8_t *)DRIVERIF_DMA_ALIGN_UP((u8_t *)(buf + 1) + ETH_PAD_SIZE);
+    len = (u16_t)(pool->buf_size + ETH_PAD_SIZE);
+    return pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &buf->pc, dma - ETH_PAD_SIZE, len);
+}
+
+/*
+ * Trim a receive buffer to the frame the DMA engine wrote into it.
+ *
+ * @param p the pbuf from driverif_rx_buf_alloc
+ * @param len length of the received frame
+ */
+void driverif_rx_buf_complete(struct pbuf *p, u16_t len)
+{
+    LWIP_ERROR("driverif_rx_buf_complete : invalid arguments", ((p != NULL) && ((len + ETH_PAD_SIZE) <= p->len)),
+        return);
+
+    p->len = (u16_t)(len + ETH_PAD_SIZE);
+    p->tot_len = p->len;
+}
+
 /*
  * Should be called at the beginning of the program to set up the
  * network interface. It calls the function low_level_init() to do the
@@ -313,6 +634,14 @@ err_t driverif_init(struct netif *netif)
     netif->output = etharp_output;
     netif->linkoutput = driverif_output;
 
+    /* batched input is optional, drivers not using it still work without the message */
+    netif->rx_batch_head = NULL;
+    netif->rx_batch_tail = NULL;
+    netif->rx_batch_len = 0;
+    netif->rx_batch_posted = 0;
+    netif->tx_done_len = 0;
+    netif->rx_batch_msg = tcpip_callbackmsg_new(driverif_batch_proc, netif);
+
     /* init the netif's full name */
     driverif_init_ifname(netif);
 
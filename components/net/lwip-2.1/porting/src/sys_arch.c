@@ -37,6 +37,7 @@
 #include <los_sem.h>
 #include <los_mux.h>
 #include <los_config.h>
+#include <los_atomic.h>
 
 #ifndef LOSCFG_KERNEL_SMP
 #define LOSCFG_KERNEL_SMP 0
@@ -51,6 +52,28 @@ static int lwprot_count = 0;
 #define ROUND_UP_DIV(val, div) (((val) + (div) - 1) / (div))
 #define LWIP_LOG_BUF_SIZE 64
 
+#if (LWIP_SYS_MBOX_ISR_SIZE & (LWIP_SYS_MBOX_ISR_SIZE - 1))
+#error "LWIP_SYS_MBOX_ISR_SIZE must be a power of 2"
+#endif
+
+/*
+ * Messages posted from interrupts bypass the LiteOS queue of the mbox: they go to a lock-free ring bound to
+ * the mbox on its first interrupt post. Interrupts reserve ring slots with a compare-and-swap on the tail and
+ * a slot is readable once its message is stored, only the mbox reader consumes them.
+ * The reader polls the ring before reading the queue, and a single doorbell message is queued when the ring
+ * gets its first message, so a blocked reader wakes once per burst instead of once per message.
+ */
+struct sys_mbox_isr_ring {
+    Atomic owner;                               /* bound mbox + 1, 0 when the ring is free */
+    Atomic doorbell;                            /* a doorbell message is queued in the mbox */
+    Atomic tail;                                /* next slot reserved by an interrupt */
+    volatile UINT32 head;                       /* next slot consumed by the reader */
+    void *volatile slot[LWIP_SYS_MBOX_ISR_SIZE];
+};
+
+static struct sys_mbox_isr_ring g_mboxIsrRing[LWIP_SYS_MBOX_ISR_NUM];
+static const char g_mboxDoorbell; /* its address is the doorbell message */
+
 /**
  * Thread and System misc
  */
@@ -198,11 +221,130 @@ err_t sys_mbox_trypost(sys_mbox_t *mbox, void *msg)
     return ERR_ARG;
 }
 
+static struct sys_mbox_isr_ring *sys_mbox_isr_ring_bind(const sys_mbox_t *mbox)
+{
+    INT32 owner = (INT32)(*mbox + 1);
+    int i;
+
+    for (i = 0; i < LWIP_SYS_MBOX_ISR_NUM; i++) {
+        if (LOS_AtomicRead(&g_mboxIsrRing[i].owner) == owner) {
+            return &g_mboxIsrRing[i];
+        }
+    }
+
+    for (i = 0; i < LWIP_SYS_MBOX_ISR_NUM; i++) {
+        if (!LOS_AtomicCmpXchg32bits(&g_mboxIsrRing[i].owner, owner, 0)) {
+            return &g_mboxIsrRing[i];
+        }
+    }
+    return NULL;
+}
+
+static void *sys_mbox_isr_ring_pop(const sys_mbox_t *mbox)
+{
+    INT32 owner = (INT32)(*mbox + 1);
+    struct sys_mbox_isr_ring *ring = NULL;
+    UINT32 index;
+    void *msg = NULL;
+
+    for (int i = 0; i < LWIP_SYS_MBOX_ISR_NUM; i++) {
+        ring = &g_mboxIsrRing[i];
+        if (LOS_AtomicRead(&ring->owner) != owner) {
+            continue;
+        }
+
+        index = ring->head & (LWIP_SYS_MBOX_ISR_SIZE - 1);
+        msg = ring->slot[index];
+        if (msg != NULL) {
+            ring->slot[index] = NULL;
+            ring->head++;
+            return msg;
+        }
+    }
+    return NULL;
+}
+
+static void sys_mbox_isr_ring_ack(const sys_mbox_t *mbox)
+{
+    INT32 owner = (INT32)(*mbox + 1);
+
+    for (int i = 0; i < LWIP_SYS_MBOX_ISR_NUM; i++) {
+        if (LOS_AtomicRead(&g_mboxIsrRing[i].owner) == owner) {
+            LOS_AtomicSet(&g_mboxIsrRing[i].doorbell, 0);
+        }
+    }
+}
+
+static void sys_mbox_isr_ring_unbind(const sys_mbox_t *mbox)
+{
+    INT32 owner = (INT32)(*mbox + 1);
+    struct sys_mbox_isr_ring *ring = NULL;
+
+    for (int i = 0; i < LWIP_SYS_MBOX_ISR_NUM; i++) {
+        ring = &g_mboxIsrRing[i];
+        if (LOS_AtomicRead(&ring->owner) != owner) {
+            continue;
+        }
+
+        (void)memset_s((void *)ring->slot, sizeof(ring->slot), 0, sizeof(ring->slot));
+        ring->head = 0;
+        LOS_AtomicSet(&ring->tail, 0);
+        LOS_AtomicSet(&ring->doorbell, 0);
+        LOS_AtomicSet(&ring->owner, 0);
+    }
+}
+
+/* Read the interrupt ring first, then the queue, which may hold a doorbell for the ring */
+static UINT32 sys_mbox_read(sys_mbox_t *mbox, void **msg, UINT32 timeout)
+{
+    UINT64 deadline = LOS_TickCountGet() + timeout;
+    UINT64 now;
+    UINT32 ret;
+
+    while ((*msg = sys_mbox_isr_ring_pop(mbox)) == NULL) {
+        ret = LOS_QueueRead(*mbox, msg, sizeof(void *), timeout);
+        if ((ret != LOS_OK) || (*msg != (void *)&g_mboxDoorbell)) {
+            return ret;
+        }
+
+        sys_mbox_isr_ring_ack(mbox);
+        if ((timeout != 0) && (timeout != LOS_WAIT_FOREVER)) {
+            now = LOS_TickCountGet();
+            timeout = (now >= deadline) ? 0 : (UINT32)(deadline - now);
+        }
+    }
+    return LOS_OK;
+}
+
 err_t sys_mbox_trypost_fromisr(sys_mbox_t *mbox, void *msg)
 {
-    (void)mbox;
-    (void)msg;
-    return ERR_ARG;
+    struct sys_mbox_isr_ring *ring = NULL;
+    INT32 tail;
+
+    if ((mbox == NULL) || (msg == NULL)) {
+        return ERR_ARG;
+    }
+
+    ring = sys_mbox_isr_ring_bind(mbox);
+    if (ring == NULL) {
+        return ERR_MEM;
+    }
+
+    do {
+        tail = LOS_AtomicRead(&ring->tail);
+        if (((UINT32)tail - ring->head) >= LWIP_SYS_MBOX_ISR_SIZE) {
+            return ERR_MEM;
+        }
+    } while (LOS_AtomicCmpXchg32bits(&ring->tail, tail + 1, tail));
+    ring->slot[(UINT32)tail & (LWIP_SYS_MBOX_ISR_SIZE - 1)] = msg;
+
+    /* A full queue needs no doorbell, the reader polls the ring before every queue read */
+    if (!LOS_AtomicCmpXchg32bits(&ring->doorbell, 1, 0)) {
+        if (LOS_QueueWrite(*mbox, (void *)&g_mboxDoorbell, sizeof(void *), 0) != LOS_OK) {
+            LOS_AtomicSet(&ring->doorbell, 0);
+        }
+    }
+    return ERR_OK;
 }
 
 u32_t sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeoutMs)
@@ -214,7 +356,7 @@ u32_t sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeoutMs)
 
     void *ignore = 0; /* if msg==NULL, the fetched msg should be dropped */
     UINT64 tick = ROUND_UP_DIV((UINT64)timeoutMs * LOSCFG_BASE_CORE_TICK_PER_SECOND, OS_SYS_MS_PER_SECOND);
-    UINT32 ret = LOS_QueueRead(*mbox, msg ? msg : &ignore, sizeof(void *), tick ? (UINT32)tick : LOS_WAIT_FOREVER);
+    UINT32 ret = sys_mbox_read(mbox, msg ? msg : &ignore, tick ? (UINT32)tick : LOS_WAIT_FOREVER);
     switch (ret) {
         case LOS_OK:
             return ERR_OK;
@@ -236,7 +378,7 @@ u32_t sys_arch_mbox_tryfetch(sys_mbox_t *mbox, void **msg)
     }
 
     void *ignore = 0; /* if msg==NULL, the fetched msg should be dropped */
-    UINT32 ret = LOS_QueueRead(*mbox, msg ? msg : &ignore, sizeof(void *), 0);
+    UINT32 ret = sys_mbox_read(mbox, msg ? msg : &ignore, 0);
     switch (ret) {
         case LOS_OK:
             return ERR_OK;
@@ -258,6 +400,7 @@ void sys_mbox_free(sys_mbox_t *mbox)
         return;
     }
 
+    sys_mbox_isr_ring_unbind(mbox);
     (void)LOS_QueueDelete(*mbox);
 }
 
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lwip_test.h"
+#include "lwipopts.h"
+#include <arch/sys_arch.h>
+#include <lwip/sys.h>
+
+#define TEST_CASE 240
+#define MBOX_ISR_TEST_SIZE 4
+#define MBOX_ISR_TEST_MSGS 3
+#define MBOX_ISR_TEST_TIMEOUT 1000
+
+static int g_mboxIsrMsg[MBOX_ISR_TEST_MSGS + 1];
+
+void MboxIsrTest()
+{
+    LogPrintln("net_socket_test_014.c enter");
+    g_testCase = TEST_CASE;
+    sys_mbox_t mbox;
+    void *msg = NULL;
+    err_t ret;
+    int i;
+
+    ret = sys_mbox_new(&mbox, MBOX_ISR_TEST_SIZE);
+    ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 1);
+
+    ret = sys_mbox_trypost_fromisr(&mbox, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, ERR_ARG, 2);
+
+    /* interrupt posts go to the ring, only the first one queues a doorbell */
+    for (i = 0; i < MBOX_ISR_TEST_MSGS; i++) {
+        ret = sys_mbox_trypost_fromisr(&mbox, &g_mboxIsrMsg[i]);
+        ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 3);
+    }
+    ret = sys_mbox_trypost(&mbox, &g_mboxIsrMsg[MBOX_ISR_TEST_MSGS]);
+    ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 4);
+
+    for (i = 0; i <= MBOX_ISR_TEST_MSGS; i++) {
+        ret = sys_arch_mbox_fetch(&mbox, &msg, MBOX_ISR_TEST_TIMEOUT);
+        ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 5);
+        ICUNIT_ASSERT_EQUAL(msg, &g_mboxIsrMsg[i], 6);
+    }
+
+    /* the doorbell left in the queue is not a message */
+    ret = sys_arch_mbox_tryfetch(&mbox, &msg);
+    ICUNIT_ASSERT_EQUAL(ret, SYS_MBOX_EMPTY, 7);
+
+    for (i = 0; i < LWIP_SYS_MBOX_ISR_SIZE; i++) {
+        ret = sys_mbox_trypost_fromisr(&mbox, &g_mboxIsrMsg[0]);
+        ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 8);
+    }
+    ret = sys_mbox_trypost_fromisr(&mbox, &g_mboxIsrMsg[0]);
+    ICUNIT_ASSERT_EQUAL(ret, ERR_MEM, 9);
+
+    for (i = 0; i < LWIP_SYS_MBOX_ISR_SIZE; i++) {
+        ret = sys_arch_mbox_tryfetch(&mbox, &msg);
+        ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 10);
+    }
+    ret = sys_arch_mbox_tryfetch(&mbox, &msg);
+    ICUNIT_ASSERT_EQUAL(ret, SYS_MBOX_EMPTY, 11);
+
+    sys_mbox_free(&mbox);
+}
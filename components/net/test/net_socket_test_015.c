@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lwip_test.h"
+#include "lwipopts.h"
+#include <lwip/netif.h>
+#include <lwip/netifapi.h>
+#include <lwip/etharp.h>
+#include <lwip/tcpip.h>
+#include <lwip/prot/ip4.h>
+
+#define TEST_CASE 250
+#define ZC_IP_OFFSET        (SIZEOF_ETH_HDR - ETH_PAD_SIZE)
+#define ZC_IP_SRC_OFFSET    12
+#define ZC_IP_DST_OFFSET    16
+#define ZC_DMA_BUF_SIZE     1536
+#define ZC_DMA_BUF_NUM      32
+#define ZC_DMA_REGION_SIZE  ((ZC_DMA_BUF_SIZE + 128) * ZC_DMA_BUF_NUM)
+#define ZC_PORT             2290
+#define ZC_MSG_SIZE         1024
+#define ZC_MSG_COUNT        1000
+#define ZC_NETIF_MAC        "\x02\x00\x00\x00\x00\x01"
+
+static UINT8 g_zcDmaRegion[ZC_DMA_REGION_SIZE] __attribute__((aligned(DRIVERIF_DMA_ALIGN)));
+static struct driverif_dma_pool g_zcPool;
+static char g_zcBuf[ZC_MSG_SIZE];
+
+static void LoopbackSend(struct netif *netif, struct pbuf *p)
+{
+    (void)netif;
+    (void)p;
+}
+
+/*
+ * Loopback driver: "DMA" the frame segments into a receive buffer and reflect it by swapping the IP
+ * addresses, which changes neither the IP nor the UDP checksum.
+ */
+static err_t LoopbackSendSg(struct netif *netif, const struct driverif_sg *sg, u16_t count, struct pbuf *p)
+{
+    struct pbuf *rx = driverif_rx_buf_alloc(&g_zcPool);
+    u8_t *dma = NULL;
+    u8_t addr[sizeof(ip4_addr_t)];
+    u16_t len = 0;
+
+    if (rx == NULL) {
+        return ERR_MEM;
+    }
+
+    dma = DRIVERIF_RX_DMA_ADDR(rx);
+    for (u16_t i = 0; i < count; i++) {
+        if ((len + sg[i].len) > g_zcPool.buf_size) {
+            (void)pbuf_free(rx);
+            return ERR_BUF;
+        }
+        (void)memcpy_s(dma + len, g_zcPool.buf_size - len, sg[i].payload, sg[i].len);
+        len += sg[i].len;
+    }
+
+    (void)memcpy_s(addr, sizeof(addr), dma + ZC_IP_OFFSET + ZC_IP_SRC_OFFSET, sizeof(addr));
+    (void)memcpy_s(dma + ZC_IP_OFFSET + ZC_IP_SRC_OFFSET, sizeof(addr),
+        dma + ZC_IP_OFFSET + ZC_IP_DST_OFFSET, sizeof(addr));
+    (void)memcpy_s(dma + ZC_IP_OFFSET + ZC_IP_DST_OFFSET, sizeof(addr), addr, sizeof(addr));
+
+    driverif_rx_buf_complete(rx, len);
+    (void)driverif_tx_complete(netif, p);
+    if (driverif_input_batch(netif, rx) != ERR_OK) {
+        (void)pbuf_free(rx);
+    }
+    return ERR_OK;
+}
+
+static struct netif *CreateLoopbackNetif(void)
+{
+    struct netif *netif = NULL;
+    ip4_addr_t gw, ipaddr, netmask, peer;
+    err_t ret;
+
+    netif = (struct netif *)malloc(sizeof(struct netif));
+    ICUNIT_ASSERT_NOT_EQUAL(netif, NULL, 1);
+    (void)memset_s(netif, sizeof(struct netif), 0, sizeof(struct netif));
+    netif->drv_send = LoopbackSend;
+    netif->drv_send_sg = LoopbackSendSg;
+    netif->link_layer_type = ETHERNET_DRIVER_IF;
+    netif->hwaddr_len = ETH_HWADDR_LEN;
+    (void)memcpy_s(&netif->hwaddr, sizeof(netif->hwaddr), ZC_NETIF_MAC, ETH_HWADDR_LEN);
+
+    IP4_ADDR(&gw, 10, 10, 10, 254);
+    IP4_ADDR(&ipaddr, 10, 10, 10, 1);
+    IP4_ADDR(&netmask, 255, 255, 255, 0);
+    ret = netifapi_netif_add(netif, &ipaddr, &netmask, &gw, netif, driverif_init, tcpip_input);
+    ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 2);
+    netifapi_netif_set_up(netif);
+
+    /* the peer resolves to the netif itself, so every frame comes back through the driver */
+    IP4_ADDR(&peer, 10, 10, 10, 2);
+    LOCK_TCPIP_CORE();
+    ret = etharp_add_static_entry(&peer, (struct eth_addr *)netif->hwaddr);
+    UNLOCK_TCPIP_CORE();
+    ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 3);
+    return netif;
+}
+
+static void ZeroCopyTestTask(void *arg)
+{
+    (void)arg;
+    struct netif *netif = NULL;
+    struct sockaddr_in addr = { 0 };
+    u32_t start;
+    u32_t elapsed;
+    int sfd;
+    int ret;
+    int i;
+
+    LogPrintln("net_socket_test_015.c enter");
+    g_testCase = TEST_CASE;
+
+    ret = driverif_dma_pool_init(&g_zcPool, g_zcDmaRegion, sizeof(g_zcDmaRegion), ZC_DMA_BUF_SIZE);
+    ICUNIT_ASSERT_EQUAL(ret, ERR_OK, 4);
+    netif = CreateLoopbackNetif();
+
+    sfd = socket(AF_INET, SOCK_DGRAM, 0);
+    ICUNIT_ASSERT_NOT_EQUAL(sfd, -1, 5);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr("10.10.10.1");
+    addr.sin_port = htons(ZC_PORT);
+    ret = bind(sfd, (struct sockaddr *)&addr, sizeof(addr));
+    ICUNIT_ASSERT_EQUAL(ret, 0, 6);
+
+    /* datagrams to the peer port come back to the bound port from the peer address */
+    addr.sin_addr.s_addr = inet_addr("10.10.10.2");
+    start = sys_now();
+    for (i = 0; i < ZC_MSG_COUNT; i++) {
+        ret = sendto(sfd, g_zcBuf, ZC_MSG_SIZE, 0, (struct sockaddr *)&addr, sizeof(addr));
+        ICUNIT_ASSERT_EQUAL(ret, ZC_MSG_SIZE, 7);
+        ret = recv(sfd, g_zcBuf, ZC_MSG_SIZE, 0);
+        ICUNIT_ASSERT_EQUAL(ret, ZC_MSG_SIZE, 8);
+    }
+    elapsed = sys_now() - start;
+    LogPrintln("zero-copy loopback: %d datagrams of %d bytes in %u ms, %u KB/s", ZC_MSG_COUNT, ZC_MSG_SIZE,
+        elapsed, (u32_t)((ZC_MSG_COUNT * ZC_MSG_SIZE) / (elapsed + 1)));
+
+    ret = closesocket(sfd);
+    ICUNIT_ASSERT_NOT_EQUAL(ret, -1, 9);
+    (void)netifapi_netif_remove(netif);
+    free(netif);
+}
+
+void ZeroCopyTest()
+{
+    int ret = sys_thread_new("zero_copy_test", ZeroCopyTestTask, NULL,
+        STACK_TEST_SIZE, TCPIP_THREAD_PRIO);
+    ICUNIT_ASSERT_NOT_EQUAL(ret, -1, 10);
+}
@@ -48,6 +48,8 @@
 #define NETIF_TEST      410
 #define TCP_DUP_TEST    420
 #define TCP_LONG_TEST   430
+#define MBOX_ISR_TEST   440
+#define ZERO_COPY_TEST  450
 
 int g_lwipTimerCount = 0;
 int g_testCase = LWIP_TEST_COUNT_FLAG;
@@ -67,6 +69,8 @@ extern void TcpTestPoll();
 extern int UdpTestNetif(void);
 extern void TcpTestDup();
 extern void TcpTestLong();
+extern void MboxIsrTest();
+extern void ZeroCopyTest();
 
 // time out 1s
 static void LwipTestTimeoutCallback(void const *argument)
@@ -112,6 +116,12 @@ static void LwipTestTimeoutCallback(void const *argument)
         case TCP_LONG_TEST:
             TcpTestLong();
             break;
+        case MBOX_ISR_TEST:
+            MboxIsrTest();
+            break;
+        case ZERO_COPY_TEST:
+            ZeroCopyTest();
+            break;
         default:
           break;
     }
@@ -44,6 +44,10 @@
 #define OS_PM_LOCK_MAX  0xFFFFU
 #define OS_PM_SYS_EARLY        1
 #define OS_PM_SYS_DEVICE_EARLY 2
+#define OS_PM_LOCK_CREATED     0x1U
+#define OS_PM_LOCK_HANDLE_INDEX_BITS 16
+#define OS_PM_LOCK_HANDLE_INDEX_MASK 0xFFFFU
+#define OS_PM_LOCK_HANDLE(index, gen) (((UINTPTR)(gen) << OS_PM_LOCK_HANDLE_INDEX_BITS) | (index))
 
 typedef UINT32 (*Suspend)(UINT32 mode);
 
@@ -51,9 +55,18 @@ typedef struct {
     CHAR         *name;
     UINT32       count;
     UINT32       swtmrID;
+    UINT32       flags;
+    UINT32       acquireCount;
+    UINT64       acquireTime;
+    UINT64       holdTime;
     LOS_DL_LIST  list;
 } OsPmLockCB;
 
+typedef struct {
+    OsPmLockCB *lock;
+    UINT16     gen;   /* Bumped on delete, so that handles of a reused slot do not match */
+} OsPmLockSlot;
+
 typedef struct {
     LOS_SysSleepEnum  pmMode;
     LOS_SysSleepEnum  sysMode;
@@ -74,6 +87,150 @@ STATIC EVENT_CB_S g_pmEvent;
 STATIC LosPmCB g_pmCB;
 STATIC LosPmSysctrl g_sysctrl;
 
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+#define OS_PM_GOV_HISTORY_NUM    8
+#define OS_PM_GOV_RATIO_ONE      1024
+#define OS_PM_GOV_EWMA_SHIFT     3
+#define OS_PM_GOV_BUCKET_BASE_US 100
+#define OS_PM_GOV_BUCKET_STEP    10
+
+typedef struct {
+    UINT64 entryLatency; /* Moving average, in cycles */
+    UINT64 exitLatency;  /* Moving average, in cycles */
+} OsPmModeCost;
+
+typedef struct {
+    OsPmModeCost      cost[LOS_SYS_SHUTDOWN];
+    UINT32            ratio[OS_PM_GOV_HISTORY_NUM]; /* Slept time / time to the next timer event */
+    UINT32            ratioPos;
+    UINT64            expected;                     /* Time to the next timer event of the current sleep */
+    LOS_SysSleepEnum  select;
+    BOOL              governed;                     /* The governor chose the mode of the current sleep */
+    LosPmGovernorStat stat;
+} OsPmGovernor;
+
+STATIC OsPmGovernor g_pmGovernor;
+
+STATIC VOID OsPmGovernorInit(VOID)
+{
+    UINT32 index;
+
+    (VOID)memset_s(&g_pmGovernor, sizeof(OsPmGovernor), 0, sizeof(OsPmGovernor));
+    /* Until sleeps have been measured, trust the timer */
+    for (index = 0; index < OS_PM_GOV_HISTORY_NUM; index++) {
+        g_pmGovernor.ratio[index] = OS_PM_GOV_RATIO_ONE;
+    }
+}
+
+STATIC UINT64 OsPmGovernorCost(const OsPmGovernor *gov, LOS_SysSleepEnum mode)
+{
+    UINT64 residencyUs = 0;
+
+    if (mode == LOS_SYS_LIGHT_SLEEP) {
+        residencyUs = LOSCFG_KERNEL_PM_GOVERNOR_LIGHT_RESIDENCY_US;
+    } else if (mode == LOS_SYS_DEEP_SLEEP) {
+        residencyUs = LOSCFG_KERNEL_PM_GOVERNOR_DEEP_RESIDENCY_US;
+    }
+
+    return gov->cost[mode].entryLatency + gov->cost[mode].exitLatency +
+           OS_SYS_NS_TO_CYCLE(residencyUs * OS_SYS_NS_PER_US, g_sysClock);
+}
+
+/* Called with interrupts masked: pick the deepest allowed mode the predicted idle time pays off */
+STATIC LOS_SysSleepEnum OsPmGovernorSelect(LosPmCB *pm)
+{
+    OsPmGovernor *gov = &g_pmGovernor;
+    UINT64 currTime = OsGetCurrSchedTimeCycle();
+    UINT64 expireTime = OsSchedGetNextExpireTime(currTime);
+    UINT64 predicted;
+    UINT32 ratio = 0;
+    UINT32 index;
+    INT32 mode;
+
+    gov->expected = (expireTime > currTime) ? (expireTime - currTime) : 0;
+    gov->select = LOS_SYS_NORMAL_SLEEP;
+    if (pm->pmMode == LOS_SYS_SHUTDOWN) {
+        /* Shutdown is an explicit request, not a governed choice */
+        gov->select = LOS_SYS_SHUTDOWN;
+        return gov->select;
+    }
+
+    for (index = 0; index < OS_PM_GOV_HISTORY_NUM; index++) {
+        ratio += gov->ratio[index];
+    }
+    ratio /= OS_PM_GOV_HISTORY_NUM;
+
+    predicted = gov->expected;
+    if (predicted < (OS_SCHED_MAX_RESPONSE_TIME / OS_PM_GOV_RATIO_ONE)) {
+        predicted = predicted * ratio / OS_PM_GOV_RATIO_ONE;
+    }
+
+    for (mode = (INT32)pm->pmMode; mode > (INT32)LOS_SYS_NORMAL_SLEEP; mode--) {
+        if (predicted >= OsPmGovernorCost(gov, (LOS_SysSleepEnum)mode)) {
+            break;
+        }
+    }
+
+    gov->select = (LOS_SysSleepEnum)mode;
+    gov->governed = TRUE;
+    return gov->select;
+}
+
+/* Normal sleep of the idle task only counts as a prediction when the governor could have gone deeper */
+STATIC VOID OsPmGovernorNormalSelect(LosPmCB *pm)
+{
+    OsPmGovernor *gov = &g_pmGovernor;
+    BOOL governed = (pm->lock == 0) && (pm->pmMode != LOS_SYS_NORMAL_SLEEP);
+
+    (VOID)OsPmGovernorSelect(pm);
+    gov->governed = governed && (gov->select == LOS_SYS_NORMAL_SLEEP);
+    gov->select = LOS_SYS_NORMAL_SLEEP;
+}
+
+STATIC VOID OsPmGovernorUpdate(LosPmCB *pm, UINT64 entry, UINT64 residency, UINT64 exit)
+{
+    OsPmGovernor *gov = &g_pmGovernor;
+    LOS_SysSleepEnum mode = gov->select;
+    OsPmModeCost *cost = NULL;
+    LosPmModeStat *stat = NULL;
+    UINT64 residencyUs;
+    UINT64 bound = OS_PM_GOV_BUCKET_BASE_US;
+    UINT32 bucket = 0;
+
+    if (mode >= LOS_SYS_SHUTDOWN) {
+        return;
+    }
+
+    cost = &gov->cost[mode];
+    cost->entryLatency = cost->entryLatency + (entry >> OS_PM_GOV_EWMA_SHIFT) -
+                         (cost->entryLatency >> OS_PM_GOV_EWMA_SHIFT);
+    cost->exitLatency = cost->exitLatency + (exit >> OS_PM_GOV_EWMA_SHIFT) -
+                        (cost->exitLatency >> OS_PM_GOV_EWMA_SHIFT);
+
+    if (gov->expected != 0) {
+        residency = (residency > gov->expected) ? gov->expected : residency;
+        gov->ratio[gov->ratioPos] = (UINT32)(residency * OS_PM_GOV_RATIO_ONE / gov->expected);
+        gov->ratioPos = (gov->ratioPos + 1) % OS_PM_GOV_HISTORY_NUM;
+    }
+
+    stat = &gov->stat.mode[mode];
+    stat->count++;
+    residencyUs = OS_SYS_CYCLE_TO_NS(residency, g_sysClock) / OS_SYS_NS_PER_US;
+    while ((bucket < (LOS_PM_RESIDENCY_BUCKET_NUM - 1)) && (residencyUs >= bound)) {
+        bound *= OS_PM_GOV_BUCKET_STEP;
+        bucket++;
+    }
+    stat->residency[bucket]++;
+
+    if ((mode != LOS_SYS_NORMAL_SLEEP) && (residency < OsPmGovernorCost(gov, mode))) {
+        gov->stat.tooDeep++;
+    } else if (gov->governed && (mode < pm->pmMode) && (pm->pmMode < LOS_SYS_SHUTDOWN) &&
+               (residency >= OsPmGovernorCost(gov, (LOS_SysSleepEnum)(mode + 1)))) {
+        gov->stat.tooShallow++;
+    }
+}
+#endif
+
 STATIC VOID OsPmSysctrlInit(VOID)
 {
     /* Default handler functions, which are implemented by the product */
@@ -226,6 +383,14 @@ STATIC UINT32 OsPmSuspendCheck(LosPmCB *pm, Suspend *sysSuspendEarly, Suspend *d
         return LOS_NOK;
     }
 
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    pm->sysMode = OsPmGovernorSelect(pm);
+    if (pm->sysMode == LOS_SYS_NORMAL_SLEEP) {
+        LOS_IntRestore(intSave);
+        return LOS_NOK;
+    }
+#endif
+
     pm->isWake = FALSE;
     *mode = pm->sysMode;
     *sysSuspendEarly = pm->sysctrl->early;
@@ -241,6 +406,11 @@ STATIC UINT32 OsPmSuspendSleep(LosPmCB *pm)
     LOS_SysSleepEnum mode;
     UINT32 prepare = 0;
     BOOL tickTimerStop = FALSE;
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    UINT64 entryTime = LOS_SysCycleGet();
+    UINT64 sleepTime = 0;
+    UINT64 wakeTime = 0;
+#endif
 
     ret = OsPmSuspendCheck(pm, &sysSuspendEarly, &deviceSuspend, &mode);
     if (ret != LOS_OK) {
@@ -260,6 +430,9 @@ STATIC UINT32 OsPmSuspendSleep(LosPmCB *pm)
         goto EXIT;
     }
 
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    sleepTime = LOS_SysCycleGet();
+#endif
     tickTimerStop = OsPmTickTimerStop(pm);
     if (!tickTimerStop) {
         OsSchedResetSchedResponseTime(0);
@@ -272,9 +445,18 @@ STATIC UINT32 OsPmSuspendSleep(LosPmCB *pm)
 
     OsPmTickTimerStart(pm);
 
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    wakeTime = LOS_SysCycleGet();
+#endif
+
 EXIT:
     pm->sysMode = LOS_SYS_NORMAL_SLEEP;
     OsPmResumePrepare(pm, (UINT32)mode, prepare);
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    if (wakeTime != 0) {
+        OsPmGovernorUpdate(pm, sleepTime - entryTime, wakeTime - sleepTime, LOS_SysCycleGet() - wakeTime);
+    }
+#endif
     LOS_IntRestore(intSave);
 
     LOS_TaskUnlock();
@@ -285,13 +467,28 @@ STATIC VOID OsPmNormalSleep(VOID)
 {
     UINT32 intSave;
     LosPmCB *pm = &g_pmCB;
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    UINT64 sleepTime;
+
+    if (((pm->pmMode == LOS_SYS_LIGHT_SLEEP) || (pm->pmMode == LOS_SYS_DEEP_SLEEP)) &&
+        (OsPmSuspendSleep(pm) == LOS_OK)) {
+        return;
+    }
+#endif
 
     intSave = LOS_IntLock();
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    OsPmGovernorNormalSelect(pm);
+    sleepTime = LOS_SysCycleGet();
+#endif
 
     OsPmCpuSuspend(pm);
 
     OsPmCpuResume(pm);
 
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    OsPmGovernorUpdate(pm, 0, LOS_SysCycleGet() - sleepTime, 0);
+#endif
     LOS_IntRestore(intSave);
 }
 
@@ -520,21 +717,119 @@ UINT32 LOS_PmModeSet(LOS_SysSleepEnum mode)
     return LOS_OK;
 }
 
+STATIC OsPmLockCB *OsPmLockFind(LosPmCB *pm, const CHAR *name)
+{
+    OsPmLockCB *lock = NULL;
+    LOS_DL_LIST *head = &pm->lockList;
+    LOS_DL_LIST *list = head->pstNext;
+
+    while (list != head) {
+        lock = LOS_DL_LIST_ENTRY(list, OsPmLockCB, list);
+        if (strcmp(name, lock->name) == 0) {
+            return lock;
+        }
+        list = list->pstNext;
+    }
+
+    return NULL;
+}
+
+STATIC OsPmLockCB *OsPmLockAlloc(const CHAR *name, UINT32 swtmrID, UINT32 flags)
+{
+    OsPmLockCB *lock = LOS_MemAlloc((VOID *)OS_SYS_MEM_ADDR, sizeof(OsPmLockCB));
+    if (lock == NULL) {
+        return NULL;
+    }
+
+    (VOID)memset_s(lock, sizeof(OsPmLockCB), 0, sizeof(OsPmLockCB));
+    lock->name = (CHAR *)name;
+    lock->swtmrID = swtmrID;
+    lock->flags = flags;
+    return lock;
+}
+
+/* Called with interrupts masked, the first holder of a lock takes a system lock */
+STATIC UINT32 OsPmLockAcquire(LosPmCB *pm, OsPmLockCB *lock)
+{
+    if (lock->count >= OS_PM_LOCK_MAX) {
+        return LOS_ERRNO_PM_LOCK_LIMIT;
+    }
+
+    if (lock->count == 0) {
+        if (pm->lock >= OS_PM_LOCK_MAX) {
+            return LOS_ERRNO_PM_LOCK_LIMIT;
+        }
+        pm->lock++;
+        lock->acquireTime = LOS_SysCycleGet();
+    }
+    lock->count++;
+    lock->acquireCount++;
+    return LOS_OK;
+}
+
+/* Called with interrupts masked, returns whether the last system lock was dropped */
+STATIC BOOL OsPmLockDrop(LosPmCB *pm, OsPmLockCB *lock)
+{
+    lock->count--;
+    if (lock->count != 0) {
+        return FALSE;
+    }
+
+    lock->holdTime += LOS_SysCycleGet() - lock->acquireTime;
+    pm->lock--;
+    return (pm->lock == 0);
+}
+
+STATIC OsPmLockSlot g_pmLockTable[LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM];
+
+/* Called with interrupts masked, returns NULL unless the handle names a live created lock */
+STATIC OsPmLockCB *OsPmLockHandleGet(UINTPTR handle)
+{
+    UINT32 index = (UINT32)(handle & OS_PM_LOCK_HANDLE_INDEX_MASK);
+    UINTPTR gen = handle >> OS_PM_LOCK_HANDLE_INDEX_BITS;
+
+    if ((index >= LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM) || (g_pmLockTable[index].lock == NULL) ||
+        (g_pmLockTable[index].gen != gen)) {
+        return NULL;
+    }
+    return g_pmLockTable[index].lock;
+}
+
+STATIC VOID OsPmLockReleaseNotify(BOOL isRelease, UINT32 mode)
+{
+    if (isRelease && (mode > LOS_SYS_NORMAL_SLEEP)) {
+        (VOID)LOS_EventWrite(&g_pmEvent, PM_EVENT_LOCK_RELEASE);
+    }
+}
+
+STATIC UINT64 OsPmLockHoldTime(const OsPmLockCB *lock)
+{
+    UINT64 holdTime = lock->holdTime;
+
+    if (lock->count != 0) {
+        holdTime += LOS_SysCycleGet() - lock->acquireTime;
+    }
+    return holdTime;
+}
+
 #if (LOSCFG_KERNEL_PM_DEBUG == 1)
 VOID LOS_PmLockInfoShow(VOID)
 {
     UINT32 intSave;
+    UINT64 holdTime;
     LosPmCB *pm = &g_pmCB;
     OsPmLockCB *lock = NULL;
     LOS_DL_LIST *head = &pm->lockList;
     LOS_DL_LIST *list = head->pstNext;
 
-    PRINTK("Name                          Count\n\r");
+    PRINTK("Name                          Count  Acquires   HoldTime(ms)\n\r");
 
     intSave = LOS_IntLock();
     while (list != head) {
         lock = LOS_DL_LIST_ENTRY(list, OsPmLockCB, list);
-        PRINTK("%-30s%5u\n\r", lock->name, lock->count);
+        holdTime = OsPmLockHoldTime(lock);
+        holdTime = OS_SYS_CYCLE_TO_NS(holdTime, g_sysClock) / OS_SYS_NS_PER_MS;
+        PRINTK("%-30s%5u%10u%15u\n\r", lock->name, lock->count, lock->acquireCount, (UINT32)holdTime);
         list = list->pstNext;
     }
     LOS_IntRestore(intSave);
@@ -543,56 +838,232 @@ VOID LOS_PmLockInfoShow(VOID)
 }
 #endif
 
-UINT32 OsPmLockRequest(const CHAR *name, UINT32 swtmrID)
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+UINT32 LOS_PmGovernorStatGet(LosPmGovernorStat *stat)
 {
+    OsPmGovernor *gov = &g_pmGovernor;
     UINT32 intSave;
-    UINT32 ret = LOS_ERRNO_PM_NOT_LOCK;
+    UINT32 mode;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_PM_INVALID_PARAM;
+    }
+
+    intSave = LOS_IntLock();
+    *stat = gov->stat;
+    for (mode = 0; mode < LOS_SYS_SHUTDOWN; mode++) {
+        stat->mode[mode].entryLatency = (UINT32)(OS_SYS_CYCLE_TO_NS(gov->cost[mode].entryLatency, g_sysClock) /
+                                                 OS_SYS_NS_PER_US);
+        stat->mode[mode].exitLatency = (UINT32)(OS_SYS_CYCLE_TO_NS(gov->cost[mode].exitLatency, g_sysClock) /
+                                                OS_SYS_NS_PER_US);
+    }
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+#if (LOSCFG_KERNEL_PM_DEBUG == 1)
+VOID LOS_PmGovernorInfoShow(VOID)
+{
+    STATIC const CHAR *modeName[LOS_SYS_SHUTDOWN] = { "normal", "light", "deep" };
+    LosPmGovernorStat stat;
+    LosPmModeStat *modeStat = NULL;
+    UINT32 mode;
+
+    (VOID)LOS_PmGovernorStatGet(&stat);
+
+    PRINTK("Mode    Count    Entry(us) Exit(us)  <100us   <1ms     <10ms    <100ms   >=100ms\n\r");
+    for (mode = 0; mode < LOS_SYS_SHUTDOWN; mode++) {
+        modeStat = &stat.mode[mode];
+        PRINTK("%-8s%-9u%-10u%-10u%-9u%-9u%-9u%-9u%u\n\r", modeName[mode], modeStat->count,
+               modeStat->entryLatency, modeStat->exitLatency, modeStat->residency[0], modeStat->residency[1],
+               modeStat->residency[2], modeStat->residency[3], modeStat->residency[4]); /* 2, 3, 4: bucket */
+    }
+    PRINTK("Mispredictions: too deep %u, too shallow %u\n\r", stat.tooDeep, stat.tooShallow);
+
+    return;
+}
+#endif
+#endif
+
+UINT32 LOS_PmLockCreate(const CHAR *name, UINTPTR *handle)
+{
+    UINT32 intSave;
+    UINT32 index;
     LosPmCB *pm = &g_pmCB;
-    OsPmLockCB *listNode = NULL;
     OsPmLockCB *lock = NULL;
-    LOS_DL_LIST *head = &pm->lockList;
-    LOS_DL_LIST *list = head->pstNext;
+    OsPmLockSlot *slot = NULL;
+
+    if ((name == NULL) || (handle == NULL)) {
+        return LOS_ERRNO_PM_INVALID_PARAM;
+    }
+
+    lock = OsPmLockAlloc(name, OS_INVALID, OS_PM_LOCK_CREATED);
+    if (lock == NULL) {
+        return LOS_NOK;
+    }
 
     intSave = LOS_IntLock();
-    while (list != head) {
-        listNode = LOS_DL_LIST_ENTRY(list, OsPmLockCB, list);
-        if (strcmp(name, listNode->name) == 0) {
-            lock = listNode;
+    for (index = 0; index < LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM; index++) {
+        if (g_pmLockTable[index].lock == NULL) {
             break;
         }
+    }
+    if (index == LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM) {
+        LOS_IntRestore(intSave);
+        (VOID)LOS_MemFree((VOID *)OS_SYS_MEM_ADDR, lock);
+        return LOS_ERRNO_PM_LOCK_LIMIT;
+    }
 
-        list = list->pstNext;
+    slot = &g_pmLockTable[index];
+    if (slot->gen == 0) {
+        /* Keep 0 an invalid handle */
+        slot->gen = 1;
     }
+    slot->lock = lock;
+    LOS_ListTailInsert(&pm->lockList, &lock->list);
+    *handle = OS_PM_LOCK_HANDLE(index, slot->gen);
+    LOS_IntRestore(intSave);
 
+    return LOS_OK;
+}
+
+UINT32 LOS_PmLockDelete(UINTPTR handle)
+{
+    UINT32 intSave;
+    OsPmLockCB *lock = NULL;
+    OsPmLockSlot *slot = NULL;
+
+    intSave = LOS_IntLock();
+    lock = OsPmLockHandleGet(handle);
     if (lock == NULL) {
-        lock = LOS_MemAlloc((VOID *)OS_SYS_MEM_ADDR, sizeof(OsPmLockCB));
-        if (lock == NULL) {
-            LOS_IntRestore(intSave);
-            return LOS_NOK;
-        }
-        lock->name = (CHAR *)name;
-        lock->count = 1;
-        lock->swtmrID = swtmrID;
-        LOS_ListTailInsert(head, &lock->list);
-    } else if (lock->count < OS_PM_LOCK_MAX) {
-        lock->count++;
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_PM_INVALID_PARAM;
     }
 
-    if ((lock->swtmrID != OS_INVALID) && (lock->count > 1)) {
-        lock->count--;
+    if (lock->count != 0) {
         LOS_IntRestore(intSave);
-        return LOS_ERRNO_PM_ALREADY_LOCK;
+        return LOS_ERRNO_PM_LOCK_BUSY;
     }
+    LOS_ListDelete(&lock->list);
+    lock->flags = 0;
+    slot = &g_pmLockTable[handle & OS_PM_LOCK_HANDLE_INDEX_MASK];
+    slot->lock = NULL;
+    slot->gen++;
+    LOS_IntRestore(intSave);
 
-    if (pm->lock < OS_PM_LOCK_MAX) {
-        pm->lock++;
-        ret = LOS_OK;
+    (VOID)LOS_MemFree((VOID *)OS_SYS_MEM_ADDR, lock);
+    return LOS_OK;
+}
+
+UINT32 LOS_PmLockAcquire(UINTPTR handle)
+{
+    UINT32 intSave;
+    UINT32 ret;
+    OsPmLockCB *lock = NULL;
+
+    intSave = LOS_IntLock();
+    lock = OsPmLockHandleGet(handle);
+    if (lock == NULL) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_PM_INVALID_PARAM;
     }
 
+    ret = OsPmLockAcquire(&g_pmCB, lock);
     LOS_IntRestore(intSave);
     return ret;
 }
 
+UINT32 LOS_PmLockRelinquish(UINTPTR handle)
+{
+    UINT32 intSave;
+    UINT32 mode;
+    BOOL isRelease;
+    OsPmLockCB *lock = NULL;
+
+    intSave = LOS_IntLock();
+    lock = OsPmLockHandleGet(handle);
+    if (lock == NULL) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_PM_INVALID_PARAM;
+    }
+
+    if (lock->count == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_PM_NOT_LOCK;
+    }
+    mode = (UINT32)g_pmCB.pmMode;
+    isRelease = OsPmLockDrop(&g_pmCB, lock);
+    LOS_IntRestore(intSave);
+
+    OsPmLockReleaseNotify(isRelease, mode);
+    return LOS_OK;
+}
+
+UINT32 LOS_PmLockHoldTimeGet(UINTPTR handle, UINT64 *holdTimeUs)
+{
+    UINT32 intSave;
+    UINT64 holdTime;
+    OsPmLockCB *lock = NULL;
+
+    if (holdTimeUs == NULL) {
+        return LOS_ERRNO_PM_INVALID_PARAM;
+    }
+
+    intSave = LOS_IntLock();
+    lock = OsPmLockHandleGet(handle);
+    if (lock == NULL) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_PM_INVALID_PARAM;
+    }
+
+    holdTime = OsPmLockHoldTime(lock);
+    LOS_IntRestore(intSave);
+
+    *holdTimeUs = OS_SYS_CYCLE_TO_NS(holdTime, g_sysClock) / OS_SYS_NS_PER_US;
+    return LOS_OK;
+}
+
+/* The name based locks are looked up on every call and freed once no longer held */
+UINT32 OsPmLockRequest(const CHAR *name, UINT32 swtmrID)
+{
+    UINT32 intSave;
+    UINT32 ret;
+    LosPmCB *pm = &g_pmCB;
+    OsPmLockCB *lock = NULL;
+    OsPmLockCB *newLock = NULL;
+
+    intSave = LOS_IntLock();
+    lock = OsPmLockFind(pm, name);
+    if (lock == NULL) {
+        LOS_IntRestore(intSave);
+        newLock = OsPmLockAlloc(name, swtmrID, 0);
+        if (newLock == NULL) {
+            return LOS_NOK;
+        }
+
+        intSave = LOS_IntLock();
+        lock = OsPmLockFind(pm, name);
+        if (lock == NULL) {
+            lock = newLock;
+            newLock = NULL;
+            LOS_ListTailInsert(&pm->lockList, &lock->list);
+        }
+    }
+
+    if ((lock->swtmrID != OS_INVALID) && (lock->count > 0)) {
+        ret = LOS_ERRNO_PM_ALREADY_LOCK;
+    } else {
+        ret = OsPmLockAcquire(pm, lock);
+    }
+    LOS_IntRestore(intSave);
+
+    if (newLock != NULL) {
+        (VOID)LOS_MemFree((VOID *)OS_SYS_MEM_ADDR, newLock);
+    }
+    return ret;
+}
+
 UINT32 LOS_PmLockRequest(const CHAR *name)
 {
     if (name == NULL) {
@@ -605,14 +1076,10 @@ UINT32 LOS_PmLockRequest(const CHAR *name)
 UINT32 LOS_PmLockRelease(const CHAR *name)
 {
     UINT32 intSave;
-    UINT32 ret = LOS_ERRNO_PM_NOT_LOCK;
     LosPmCB *pm = &g_pmCB;
     OsPmLockCB *lock = NULL;
-    OsPmLockCB *listNode = NULL;
-    LOS_DL_LIST *head = &pm->lockList;
-    LOS_DL_LIST *list = head->pstNext;
     OsPmLockCB *lockFree = NULL;
-    BOOL isRelease = FALSE;
+    BOOL isRelease;
     UINT32 mode;
 
     if (name == NULL) {
@@ -621,33 +1088,16 @@ UINT32 LOS_PmLockRelease(const CHAR *name)
 
     intSave = LOS_IntLock();
     mode = (UINT32)pm->pmMode;
-    while (list != head) {
-        listNode = LOS_DL_LIST_ENTRY(list, OsPmLockCB, list);
-        if (strcmp(name, listNode->name) == 0) {
-            lock = listNode;
-            break;
-        }
-
-        list = list->pstNext;
-    }
-
-    if (lock == NULL) {
+    lock = OsPmLockFind(pm, name);
+    if ((lock == NULL) || (lock->count == 0)) {
         LOS_IntRestore(intSave);
         return LOS_ERRNO_PM_NOT_LOCK;
-    } else if (lock->count > 0) {
-        lock->count--;
-        if (lock->count == 0) {
-            LOS_ListDelete(&lock->list);
-            lockFree = lock;
-        }
     }
 
-    if (pm->lock > 0) {
-        pm->lock--;
-        if (pm->lock == 0) {
-            isRelease = TRUE;
-        }
-        ret = LOS_OK;
+    isRelease = OsPmLockDrop(pm, lock);
+    if ((lock->count == 0) && !(lock->flags & OS_PM_LOCK_CREATED)) {
+        LOS_ListDelete(&lock->list);
+        lockFree = lock;
     }
     LOS_IntRestore(intSave);
 
@@ -656,11 +1106,8 @@ UINT32 LOS_PmLockRelease(const CHAR *name)
         (VOID)LOS_MemFree((VOID *)OS_SYS_MEM_ADDR, lockFree);
     }
 
-    if (isRelease && (mode > LOS_SYS_NORMAL_SLEEP)) {
-        (VOID)LOS_EventWrite(&g_pmEvent, PM_EVENT_LOCK_RELEASE);
-    }
-
-    return ret;
+    OsPmLockReleaseNotify(isRelease, mode);
+    return LOS_OK;
 }
 
 STATIC VOID OsPmSwtmrHandler(UINT32 arg)
@@ -754,6 +1201,10 @@ UINT32 OsPmInit(VOID)
 
     OsPmSysctrlInit();
     pm->sysctrl = &g_sysctrl;
+
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+    OsPmGovernorInit();
+#endif
     return ret;
 }
 #endif
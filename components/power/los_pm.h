@@ -127,6 +127,47 @@
  */
 #define LOS_ERRNO_PM_ALREADY_LOCK        LOS_ERRNO_OS_ERROR(LOS_MOD_PM, 0x0a)
 
+/**
+ * @ingroup los_pm
+ * Pm error code: The lock to be deleted is still held.
+ *
+ * Value: 0x0200200b
+ *
+ */
+#define LOS_ERRNO_PM_LOCK_BUSY           LOS_ERRNO_OS_ERROR(LOS_MOD_PM, 0x0b)
+
+/**
+ * @ingroup los_pm
+ * Minimum residency, in microseconds, for which light sleep pays off its entry and exit energy.
+ * Only used by the governor.
+ */
+#ifndef LOSCFG_KERNEL_PM_GOVERNOR_LIGHT_RESIDENCY_US
+#define LOSCFG_KERNEL_PM_GOVERNOR_LIGHT_RESIDENCY_US 1000
+#endif
+
+/**
+ * @ingroup los_pm
+ * Minimum residency, in microseconds, for which deep sleep pays off its entry and exit energy.
+ * Only used by the governor.
+ */
+#ifndef LOSCFG_KERNEL_PM_GOVERNOR_DEEP_RESIDENCY_US
+#define LOSCFG_KERNEL_PM_GOVERNOR_DEEP_RESIDENCY_US 10000
+#endif
+
+/**
+ * @ingroup los_pm
+ * Maximum number of wake locks created by LOS_PmLockCreate at the same time.
+ */
+#ifndef LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM
+#define LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM 16
+#endif
+
+/**
+ * @ingroup los_pm
+ * Number of buckets of the residency histogram: <100us, <1ms, <10ms, <100ms, >=100ms.
+ */
+#define LOS_PM_RESIDENCY_BUCKET_NUM      5
+
 typedef enum {
     LOS_SYS_NORMAL_SLEEP = 0,
     LOS_SYS_LIGHT_SLEEP,
@@ -199,6 +240,19 @@ typedef struct {
     VOID (*shutdownResume)(VOID);
 } LosPmSysctrl;
 
+typedef struct {
+    UINT32 count;                                  /* Times the mode was entered */
+    UINT32 entryLatency;                           /* Average entry latency, in microseconds */
+    UINT32 exitLatency;                            /* Average exit latency, in microseconds */
+    UINT32 residency[LOS_PM_RESIDENCY_BUCKET_NUM]; /* Residency histogram */
+} LosPmModeStat;
+
+typedef struct {
+    LosPmModeStat mode[LOS_SYS_SHUTDOWN]; /* Normal, light and deep sleep */
+    UINT32        tooDeep;                /* The system woke up before the selected mode paid off */
+    UINT32        tooShallow;             /* A deeper allowed mode would have paid off */
+} LosPmGovernorStat;
+
 /**
  * @ingroup los_pm
  * @brief Initialize system low power frame.
@@ -393,6 +447,110 @@ UINT32 LOS_PmTimeLockRequest(const CHAR *name, UINT64 millisecond);
  */
 UINT32 LOS_PmLockRelease(const CHAR *name);
 
+/**
+ * @ingroup los_pm
+ * @brief Create a wake lock that is acquired and released through a handle.
+ *
+ * @par Description:
+ * This API is used to register a lock once, so that acquiring and releasing it later neither
+ * looks the lock up by name nor allocates memory.
+ *
+ * @attention
+ * <ul>
+ * <li>The name is not copied and must stay valid until the lock is deleted.</li>
+ * <li>At most LOSCFG_KERNEL_PM_LOCK_HANDLE_NUM locks can exist at the same time, further creations
+ * return LOS_ERRNO_PM_LOCK_LIMIT.</li>
+ * <li>The handle is an index into the lock table plus a generation count, a handle of a deleted lock
+ * is rejected with LOS_ERRNO_PM_INVALID_PARAM even after its slot is reused.</li>
+ * </ul>
+ *
+ * @param  name   [IN]  Who owns the lock.
+ * @param  handle [OUT] Handle of the created lock.
+ *
+ * @retval error code, LOS_OK means success.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmLockDelete | LOS_PmLockAcquire
+ */
+UINT32 LOS_PmLockCreate(const CHAR *name, UINTPTR *handle);
+
+/**
+ * @ingroup los_pm
+ * @brief Delete a wake lock created by LOS_PmLockCreate.
+ *
+ * @par Description:
+ * This API is used to delete a wake lock that is no longer held.
+ *
+ * @attention None.
+ *
+ * @param  handle [IN] Handle of the lock.
+ *
+ * @retval error code, LOS_OK means success.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmLockCreate
+ */
+UINT32 LOS_PmLockDelete(UINTPTR handle);
+
+/**
+ * @ingroup los_pm
+ * @brief Acquire a wake lock through its handle, so that the system will not enter
+ * the current mode when it enters the idle task next time.
+ *
+ * @par Description:
+ * This API is used to acquire a lock created by LOS_PmLockCreate in constant time.
+ * It can be called from interrupt context.
+ *
+ * @attention None.
+ *
+ * @param  handle [IN] Handle of the lock.
+ *
+ * @retval error code, LOS_OK means success.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmLockRelinquish
+ */
+UINT32 LOS_PmLockAcquire(UINTPTR handle);
+
+/**
+ * @ingroup los_pm
+ * @brief Release a wake lock acquired through its handle.
+ *
+ * @par Description:
+ * This API is used to release a lock acquired by LOS_PmLockAcquire in constant time.
+ * It can be called from interrupt context.
+ *
+ * @attention None.
+ *
+ * @param  handle [IN] Handle of the lock.
+ *
+ * @retval error code, LOS_OK means success.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmLockAcquire
+ */
+UINT32 LOS_PmLockRelinquish(UINTPTR handle);
+
+/**
+ * @ingroup los_pm
+ * @brief Obtain how long a wake lock has been held.
+ *
+ * @par Description:
+ * This API is used to get the accumulated time a lock has been held, including the
+ * current hold if it is still acquired.
+ *
+ * @attention None.
+ *
+ * @param  handle     [IN]  Handle of the lock.
+ * @param  holdTimeUs [OUT] Held time, in microseconds.
+ *
+ * @retval error code, LOS_OK means success.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmLockAcquire
+ */
+UINT32 LOS_PmLockHoldTimeGet(UINTPTR handle, UINT64 *holdTimeUs);
+
 /**
  * @ingroup los_pm
  * @brief Gets the current PM lock status.
@@ -446,4 +604,46 @@ UINT32 LOS_PmSuspend(UINT32 wakeCount);
  * @see LOS_PmLockRequest
  */
 VOID LOS_PmLockInfoShow(VOID);
+
+/**
+ * @ingroup los_pm
+ * @brief Obtain the statistics of the sleep mode governor.
+ *
+ * @par Description:
+ * With LOSCFG_KERNEL_PM_GOVERNOR the mode set by LOS_PmModeSet is the deepest mode allowed, and the
+ * governor picks normal, light or deep sleep from the time to the next timer event, the measured
+ * entry and exit latency of each mode and how early recent sleeps were cut short. The idle task then
+ * enters light and deep sleep on its own, so device and sysctrl callbacks may run in the idle task
+ * and must not block.
+ * This API is used to obtain how often each mode was entered, its latencies, residency histogram and
+ * the number of mispredictions.
+ *
+ * @attention None.
+ *
+ * @param  stat [OUT] Statistics of the governor.
+ *
+ * @retval error code, LOS_OK means success.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmGovernorInfoShow
+ */
+UINT32 LOS_PmGovernorStatGet(LosPmGovernorStat *stat);
+
+/**
+ * @ingroup los_pm
+ * @brief Output the statistics of the sleep mode governor.
+ *
+ * @par Description:
+ * This API is used to output the statistics of the sleep mode governor.
+ *
+ * @attention None.
+ *
+ * @param None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_pm.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_PmGovernorStatGet
+ */
+VOID LOS_PmGovernorInfoShow(VOID);
 #endif
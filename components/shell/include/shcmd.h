@@ -93,6 +93,15 @@ extern UINT32 OsShellSysCmdRegister(VOID);
 extern INT32 VfsNormalizePath(const CHAR *directory, const CHAR *filename, CHAR **pathname);
 extern INT32 OsShellCmdDate(INT32 argc, const CHAR **argv);
 extern INT32 OsShellCmdDumpTask(INT32 argc, const CHAR **argv);
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+extern INT32 OsShellCmdBootProfile(INT32 argc, const CHAR **argv);
+#endif
+#if (LOSCFG_KERNEL_IRQSTAT == 1)
+extern INT32 OsShellCmdIrqStat(INT32 argc, const CHAR **argv);
+#endif
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+extern INT32 OsShellCmdSchedLatency(INT32 argc, const CHAR **argv);
+#endif
 extern UINT32 OsShellCmdFree(INT32 argc, const CHAR **argv);
 extern UINT32 lwip_ifconfig(INT32 argc, const CHAR **argv);
 extern UINT32 OsShellPing(INT32 argc, const CHAR **argv);
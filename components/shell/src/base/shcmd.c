@@ -46,6 +46,15 @@ ShellCB *g_shellCB = NULL;
 CmdItem g_shellcmdAll[] = {
     {CMD_TYPE_STD, "date", XARGS, (CmdCallBackFunc)OsShellCmdDate},
     {CMD_TYPE_EX, "task", 1, (CmdCallBackFunc)OsShellCmdDumpTask},
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+    {CMD_TYPE_EX, "bootprof", 0, (CmdCallBackFunc)OsShellCmdBootProfile},
+#endif
+#if (LOSCFG_KERNEL_IRQSTAT == 1)
+    {CMD_TYPE_EX, "irqstat", XARGS, (CmdCallBackFunc)OsShellCmdIrqStat},
+#endif
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+    {CMD_TYPE_EX, "schedlat", XARGS, (CmdCallBackFunc)OsShellCmdSchedLatency},
+#endif
     {CMD_TYPE_EX, "free", XARGS, (CmdCallBackFunc)OsShellCmdFree},
 #ifdef LWIP_SHELLCMD_ENABLE
     {CMD_TYPE_EX, "ifconfig", XARGS, (CmdCallBackFunc)lwip_ifconfig},
@@ -30,7 +30,10 @@
  */
 
 #include "stdlib.h"
+#include "string.h"
 #include "los_task.h"
+#include "los_sched.h"
+#include "los_init.h"
 #include "shcmd.h"
 #include "shell.h"
 #define OS_ALL_TASK_MASK 0xFFFFFFFF
@@ -56,3 +59,35 @@ INT32 OsShellCmdDumpTask(INT32 argc, const CHAR **argv)
     }
 }
 
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+INT32 OsShellCmdBootProfile(INT32 argc, const CHAR **argv)
+{
+    (VOID)argv;
+
+    if (argc != 0) {
+        PRINTK("\nUsage: bootprof\n");
+        return (INT32)OS_ERROR;
+    }
+
+    LOS_BootStageShow();
+    return 0;
+}
+#endif
+
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+INT32 OsShellCmdSchedLatency(INT32 argc, const CHAR **argv)
+{
+    if (argc == 0) {
+        LOS_SchedLatencyShow();
+        return 0;
+    }
+
+    if ((argc == 1) && (strcmp(argv[0], "-r") == 0)) {
+        LOS_SchedLatencyReset();
+        return 0;
+    }
+
+    PRINTK("\nUsage: schedlat [-r]\n");
+    return (INT32)OS_ERROR;
+}
+#endif
@@ -226,6 +226,16 @@ STATIC VOID LOS_TraceSwtmrStop(const SWTMR_CTRL_S *swtmr)
     LOS_TRACE(SWTMR_STOP, swtmr->usTimerID);
 }
 
+STATIC VOID LOS_TraceBootStage(UINT32 stageIndex, UINT32 cycles, UINT32 heapUsed)
+{
+    LOS_TRACE(SYS_BOOT_STAGE, stageIndex, cycles, heapUsed);
+}
+
+STATIC VOID LOS_TraceCriticalSection(UINT32 type, UINT32 cycles, UINTPTR callSite)
+{
+    LOS_TRACE(SYS_CRITICAL_SECTION, type, cycles, callSite);
+}
+
 VOID OsTraceCnvInit(VOID)
 {
     LOS_HookReg(LOS_HOOK_TYPE_MEM_ALLOC, LOS_TraceMemAlloc);
@@ -263,6 +273,8 @@ VOID OsTraceCnvInit(VOID)
     LOS_HookReg(LOS_HOOK_TYPE_SWTMR_EXPIRED, LOS_TraceSwtmrExpired);
     LOS_HookReg(LOS_HOOK_TYPE_SWTMR_START, LOS_TraceSwtmrStart);
     LOS_HookReg(LOS_HOOK_TYPE_SWTMR_STOP, LOS_TraceSwtmrStop);
+    LOS_HookReg(LOS_HOOK_TYPE_BOOT_STAGE, LOS_TraceBootStage);
+    LOS_HookReg(LOS_HOOK_TYPE_CRITICAL_SECTION, LOS_TraceCriticalSection);
 }
 
 #ifdef __cplusplus
@@ -146,6 +146,8 @@ typedef enum {
     SYS_ERROR             = TRACE_SYS_FLAG | 0,
     SYS_START             = TRACE_SYS_FLAG | 1,
     SYS_STOP              = TRACE_SYS_FLAG | 2,
+    SYS_BOOT_STAGE        = TRACE_SYS_FLAG | 3,
+    SYS_CRITICAL_SECTION  = TRACE_SYS_FLAG | 4,
 
     /* 0x20~0x2F */
     HWI_CREATE              = TRACE_HWI_FLAG | 0,
@@ -371,6 +373,8 @@ extern TRACE_EVENT_HOOK g_traceEventHook;
 #define MEM_INFO_PARAMS(pool, usedSize, freeSize)           pool, usedSize, freeSize
 
 #define SYS_ERROR_PARAMS(errno)                         errno
+#define SYS_BOOT_STAGE_PARAMS(stageIndex, cycles, heapUsed) stageIndex, cycles, heapUsed
+#define SYS_CRITICAL_SECTION_PARAMS(type, cycles, callSite) type, cycles, callSite
 
 #if (LOSCFG_KERNEL_TRACE == 1)
 
@@ -51,9 +51,15 @@ static osKernelState_t g_kernelState;
 
 extern BOOL g_taskScheduled;
 
+#if (LOSCFG_BASE_CORE_TSK_PRIORITY_NUM >= 64) /* 64, room for osPriorityIdle to osPriorityISR */
+/* Every CMSIS priority has its own priority, osPriorityIdle <---> just above the idle task */
+#define LOS_PRIORITY(cmsisPriority) (OS_TASK_PRIORITY_LOWEST - (cmsisPriority))
+#define CMSIS_PRIORITY(losPriority) (OS_TASK_PRIORITY_LOWEST - (losPriority))
+#else
 /* LOSCFG_BASE_CORE_TSK_DEFAULT_PRIO <---> osPriorityNormal */
 #define LOS_PRIORITY(cmsisPriority) (LOSCFG_BASE_CORE_TSK_DEFAULT_PRIO - ((cmsisPriority) - osPriorityNormal))
 #define CMSIS_PRIORITY(losPriority) (osPriorityNormal + (LOSCFG_BASE_CORE_TSK_DEFAULT_PRIO - (losPriority)))
+#endif
 
 /* OS_TASK_PRIORITY_HIGHEST and OS_TASK_PRIORITY_LOWEST is reserved for internal TIMER and IDLE task use only. */
 #define ISVALID_LOS_PRIORITY(losPrio) ((losPrio) > OS_TASK_PRIORITY_HIGHEST && (losPrio) < OS_TASK_PRIORITY_LOWEST)
@@ -366,7 +372,9 @@ uint32_t osThreadGetStackSize(osThreadId_t thread_id)
 uint32_t osTaskStackWaterMarkGet(UINT32 taskID)
 {
     UINT32 count = 0;
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 0)
     UINT32 *ptopOfStack = NULL;
+#endif
     UINT32 intSave;
     LosTaskCB *pstTaskCB = NULL;
 
@@ -382,6 +390,11 @@ uint32_t osTaskStackWaterMarkGet(UINT32 taskID)
         return 0;
     }
 
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+    // the tracked water line spares the scan, the first 4 bytes are OS_TASK_MAGIC_WORD
+    count = OsGetTaskWaterLine(taskID) + sizeof(UINT32);
+    count = (count >= pstTaskCB->stackSize) ? 0 : (pstTaskCB->stackSize - count);
+#else
     // first 4 bytes is OS_TASK_MAGIC_WORD, skip
     ptopOfStack = (UINT32 *)(UINTPTR)pstTaskCB->topOfStack + 1;
 
@@ -391,6 +404,7 @@ uint32_t osTaskStackWaterMarkGet(UINT32 taskID)
     }
 
     count *= sizeof(UINT32);
+#endif
 
     LOS_IntRestore(intSave);
     return count;
@@ -1231,14 +1245,23 @@ osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, cons
 {
     UINT32 queueId;
     UINT32 ret;
-    UNUSED(attr);
     osMessageQueueId_t handle;
 
     if ((msg_count == 0) || (msg_size == 0) || OS_INT_ACTIVE) {
         return (osMessageQueueId_t)NULL;
     }
 
+#if (LOSCFG_BASE_IPC_QUEUE_STATIC == 1)
+    if ((attr != NULL) && (attr->mq_mem != NULL)) {
+        ret = LOS_QueueCreateStatic((char *)NULL, (UINT16)msg_count, &queueId, 0, (UINT16)msg_size,
+                                    attr->mq_mem, attr->mq_size);
+    } else {
+        ret = LOS_QueueCreate((char *)NULL, (UINT16)msg_count, &queueId, 0, (UINT16)msg_size);
+    }
+#else
+    UNUSED(attr);
     ret = LOS_QueueCreate((char *)NULL, (UINT16)msg_count, &queueId, 0, (UINT16)msg_size);
+#endif
     if (ret == LOS_OK) {
         handle = (osMessageQueueId_t)(GET_QUEUE_HANDLE(queueId));
     } else {
@@ -487,24 +487,30 @@ ERROUT_UNLOCK:
     return -1;
 }
 
-STATIC INT32 ConvertTimeout(long flags, const struct timespec *absTimeout, UINT64 *ticks)
+STATIC INT32 ConvertTimeout(long flags, const struct timespec *absTimeout, UINT64 *timeoutNs)
 {
+    INT32 ret;
+
     if ((UINT32)flags & (UINT32)FNONBLOCK) {
-        *ticks = LOS_NO_WAIT;
+        *timeoutNs = LOS_NO_WAIT;
         return 0;
     }
 
     if (absTimeout == NULL) {
-        *ticks = LOS_WAIT_FOREVER;
+        *timeoutNs = LOS_WAIT_FOREVER_NS;
         return 0;
     }
 
-    if (!ValidTimeSpec(absTimeout)) {
-        errno = EINVAL;
+    /* The timeout is an absolute CLOCK_REALTIME deadline, as for sem_timedwait */
+    ret = OsGetNsTimeFromNow(absTimeout, CLOCK_REALTIME, timeoutNs);
+    if (ret != 0) {
+        errno = ret;
         return -1;
     }
 
-    *ticks = OsTimeSpec2Tick(absTimeout);
+    if (*timeoutNs >= LOS_WAIT_FOREVER_NS) {
+        *timeoutNs = LOS_WAIT_FOREVER_NS - 1;
+    }
     return 0;
 }
 
@@ -535,7 +541,7 @@ int mq_timedsend(mqd_t personal, const char *msg, size_t msgLen, unsigned int ms
                  const struct timespec *absTimeout)
 {
     UINT32 mqueueID, err;
-    UINT64 absTicks;
+    UINT64 timeoutNs;
     struct mqarray *mqueueCB = NULL;
     struct mqpersonal *privateMqPersonal = NULL;
 
@@ -554,11 +560,11 @@ int mq_timedsend(mqd_t personal, const char *msg, size_t msgLen, unsigned int ms
                                 (((UINT32)privateMqPersonal->mq_flags & (UINT32)O_RDWR) != (UINT32)O_RDWR),
                                 EBADF);
 
-    OS_MQ_GOTO_ERROUT_UNLOCK_IF(ConvertTimeout(privateMqPersonal->mq_flags, absTimeout, &absTicks) == -1, errno);
+    OS_MQ_GOTO_ERROUT_UNLOCK_IF(ConvertTimeout(privateMqPersonal->mq_flags, absTimeout, &timeoutNs) == -1, errno);
     mqueueID = mqueueCB->mq_id;
     (VOID)pthread_mutex_unlock(&g_mqueueMutex);
 
-    err = LOS_QueueWriteCopy(mqueueID, (VOID *)msg, (UINT32)msgLen, (UINT32)absTicks);
+    err = LOS_QueueWriteCopyNs(mqueueID, (VOID *)msg, (UINT32)msgLen, timeoutNs);
     if (MapMqErrno(err) != ENOERR) {
         goto ERROUT;
     }
@@ -574,7 +580,7 @@ ssize_t mq_timedreceive(mqd_t personal, char *msg, size_t msgLen, unsigned int *
 {
     UINT32 mqueueID, err;
     UINT32 receiveLen;
-    UINT64 absTicks;
+    UINT64 timeoutNs;
     struct mqarray *mqueueCB = NULL;
     struct mqpersonal *privateMqPersonal = NULL;
 
@@ -604,7 +610,7 @@ ssize_t mq_timedreceive(mqd_t personal, char *msg, size_t msgLen, unsigned int *
         goto ERROUT_UNLOCK;
     }
 
-    if (ConvertTimeout(privateMqPersonal->mq_flags, absTimeout, &absTicks) == -1) {
+    if (ConvertTimeout(privateMqPersonal->mq_flags, absTimeout, &timeoutNs) == -1) {
         goto ERROUT_UNLOCK;
     }
 
@@ -612,7 +618,7 @@ ssize_t mq_timedreceive(mqd_t personal, char *msg, size_t msgLen, unsigned int *
     mqueueID = mqueueCB->mq_id;
     (VOID)pthread_mutex_unlock(&g_mqueueMutex);
 
-    err = LOS_QueueReadCopy(mqueueID, (VOID *)msg, &receiveLen, (UINT32)absTicks);
+    err = LOS_QueueReadCopyNs(mqueueID, (VOID *)msg, &receiveLen, timeoutNs);
     if (MapMqErrno(err) == ENOERR) {
         return (ssize_t)receiveLen;
     } else {
@@ -39,6 +39,7 @@
 #include "los_config.h"
 #include "los_task.h"
 #include "los_debug.h"
+#include "time_internal.h"
 
 #define PTHREAD_DEFAULT_NAME     "pthread"
 #define PTHREAD_DEFAULT_NAME_LEN 8
@@ -391,6 +392,28 @@ pthread_t pthread_self(void)
     return (pthread_t)LOS_CurTaskIDGet();
 }
 
+int pthread_getcpuclockid(pthread_t thread, clockid_t *clockID)
+{
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+    if (clockID == NULL) {
+        return EINVAL;
+    }
+
+    /* Any task has a CPU-time clock, not only the ones created by pthread_create */
+    if (((UINT32)thread > LOSCFG_BASE_CORE_TSK_LIMIT) ||
+        (OS_TCB_FROM_TID((UINT32)thread)->taskStatus & OS_TASK_STATUS_UNUSED)) {
+        return ESRCH;
+    }
+
+    *clockID = OS_CPUCLOCK_FROM_TID((UINT32)thread);
+    return 0;
+#else
+    (VOID)thread;
+    (VOID)clockID;
+    return ENOENT;
+#endif
+}
+
 STATIC UINT32 DoPthreadCancel(LosTaskCB *task)
 {
     UINT32 ret = LOS_OK;
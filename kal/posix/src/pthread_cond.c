@@ -273,7 +273,7 @@ int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex,
                            const struct timespec *ts)
 {
     INT32 ret;
-    UINT64 absTicks;
+    UINT64 timeoutNs;
     LosMuxCB *muxPosted = NULL;
     pthread_testcancel();
     if ((cond == NULL) || (mutex == NULL) || (ts == NULL) || (mutex->magic != _MUX_MAGIC)) {
@@ -296,12 +296,12 @@ int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex,
     cond->count++;
     (VOID)pthread_mutex_unlock(cond->mutex);
 
-    ret = OsGetTickTimeFromNow(ts, cond->clock, &absTicks);
+    ret = OsGetNsTimeFromNow(ts, cond->clock, &timeoutNs);
     if (ret != 0) {
         return ret;
     }
 
-    if (absTicks >= UINT32_MAX) {
+    if (timeoutNs >= LOS_WAIT_FOREVER_NS) {
         return EINVAL;
     }
 
@@ -309,7 +309,7 @@ int pthread_cond_timedwait(pthread_cond_t *cond, pthread_mutex_t *mutex,
         PRINT_ERR("%s: %d failed\n", __FUNCTION__, __LINE__);
     }
 
-    ret = (INT32)LOS_EventRead(&(cond->event), 0x0f, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, (UINT32)absTicks);
+    ret = (INT32)LOS_EventReadNs(&(cond->event), 0x0f, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, timeoutNs);
 
     if (pthread_mutex_lock(mutex) != 0) {
         PRINT_ERR("%s: %d failed\n", __FUNCTION__, __LINE__);
@@ -38,9 +38,9 @@
 #include "los_debug.h"
 #include "los_hook.h"
 #include "los_sched.h"
+#include "time_internal.h"
 
 #define MUTEXATTR_TYPE_MASK   0x0FU
-#define OS_SYS_NS_PER_MSECOND 1000000
 #define OS_SYS_NS_PER_SECOND  1000000000
 
 static inline int MapError(UINT32 err)
@@ -201,7 +201,8 @@ STATIC UINT32 MuxPreCheck(const pthread_mutex_t *mutex, const LosTaskCB *runTask
     return 0;
 }
 
-STATIC UINT32 MuxPendForPosix(pthread_mutex_t *mutex, UINT32 timeout)
+/* timeout is in cycles, OS_SCHED_WAIT_FOREVER to wait forever */
+STATIC UINT32 MuxPendForPosix(pthread_mutex_t *mutex, UINT64 timeout)
 {
     UINT32 intSave;
     LosMuxCB *muxPended = NULL;
@@ -223,14 +224,14 @@ STATIC UINT32 MuxPendForPosix(pthread_mutex_t *mutex, UINT32 timeout)
         muxPended->owner = runningTask;
         muxPended->priority = runningTask->priority;
         LOS_IntRestore(intSave);
-        OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, timeout);
+        OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, OsSchedWaitCycleToTick(timeout));
         return LOS_OK;
     }
 
     if ((muxPended->owner == runningTask) && (mutex->stAttr.type == PTHREAD_MUTEX_RECURSIVE)) {
         muxPended->muxCount++;
         LOS_IntRestore(intSave);
-        OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, timeout);
+        OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, OsSchedWaitCycleToTick(timeout));
         return LOS_OK;
     }
 
@@ -245,10 +246,10 @@ STATIC UINT32 MuxPendForPosix(pthread_mutex_t *mutex, UINT32 timeout)
         (VOID)OsSchedModifyTaskSchedParam(muxPended->owner, runningTask->priority);
     }
 
-    OsSchedTaskWait(&muxPended->muxList, timeout);
+    OsSchedTaskWaitCycle(&muxPended->muxList, timeout);
 
     LOS_IntRestore(intSave);
-    OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, timeout);
+    OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, OsSchedWaitCycleToTick(timeout));
     LOS_Schedule();
 
     intSave = LOS_IntLock();
@@ -319,9 +320,7 @@ STATIC UINT32 MuxPostForPosix(pthread_mutex_t *mutex)
 int pthread_mutex_timedlock(pthread_mutex_t *mutex, const struct timespec *absTimeout)
 {
     UINT32 ret;
-    UINT32 timeout;
     UINT64 timeoutNs;
-    struct timespec curTime = {0};
     LosMuxCB *muxPended = NULL;
 
     ret = MuxPreCheck(mutex, OS_TCB_FROM_TID(LOS_CurTaskIDGet()));
@@ -345,16 +344,11 @@ int pthread_mutex_timedlock(pthread_mutex_t *mutex, const struct timespec *absTi
             return EDEADLK;
         }
     }
-    ret = clock_gettime(CLOCK_REALTIME, &curTime);
-    if (ret != LOS_OK) {
-        return EINVAL;
-    }
-    timeoutNs = (absTimeout->tv_sec - curTime.tv_sec) * OS_SYS_NS_PER_SECOND + (absTimeout->tv_nsec - curTime.tv_nsec);
-    if (timeoutNs <= 0) {
-        return ETIMEDOUT;
+    ret = OsGetNsTimeFromNow(absTimeout, CLOCK_REALTIME, &timeoutNs);
+    if (ret != 0) {
+        return (INT32)ret;
     }
-    timeout = (timeoutNs + (OS_SYS_NS_PER_MSECOND - 1)) / OS_SYS_NS_PER_MSECOND;
-    ret = MuxPendForPosix(mutex, timeout);
+    ret = MuxPendForPosix(mutex, OsSchedNsToWaitCycle(timeoutNs));
 
     return MapError(ret);
 }
@@ -384,7 +378,7 @@ int pthread_mutex_lock(pthread_mutex_t *mutex)
             return EDEADLK;
         }
     }
-    ret = MuxPendForPosix(mutex, LOS_WAIT_FOREVER);
+    ret = MuxPendForPosix(mutex, OS_SCHED_WAIT_FOREVER);
 
     return MapError(ret);
 }
@@ -163,24 +163,24 @@ int sem_trywait(sem_t *sem)
 int sem_timedwait(sem_t *sem, const struct timespec *timeout)
 {
     UINT32 ret;
-    UINT64 tickCnt;
+    UINT64 timeoutNs;
 
     if ((sem == NULL) || (sem->s_magic != (INT32)_SEM_MAGIC)) {
         errno = EINVAL;
         return -1;
     }
 
-    ret = OsGetTickTimeFromNow(timeout, CLOCK_REALTIME, &tickCnt);
+    ret = OsGetNsTimeFromNow(timeout, CLOCK_REALTIME, &timeoutNs);
     if (ret != 0) {
         errno = (INT32)ret;
         return -1;
     }
 
-    if (tickCnt > LOS_WAIT_FOREVER) {
-        tickCnt = LOS_WAIT_FOREVER;
+    if (timeoutNs >= LOS_WAIT_FOREVER_NS) {
+        timeoutNs = LOS_WAIT_FOREVER_NS - 1;
     }
 
-    ret = LOS_SemPend((UINT32)sem->s_handle, (UINT32)tickCnt);
+    ret = LOS_SemPendNs((UINT32)sem->s_handle, timeoutNs);
     if (ret != LOS_OK) {
         errno = MapError(ret);
         return -1;
@@ -43,9 +43,15 @@
 #include "los_tick.h"
 #include "los_context.h"
 #include "los_interrupt.h"
+#include "securec.h"
 #include "sys/times.h"
+#include "sys/resource.h"
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+#include "los_cpup_pri.h"
+#endif
 
 #define DELAYTIMER_MAX 0x7FFFFFFFF
+#define BYTES_PER_KB 1024
 
 /* accumulative time delta from discontinuous modify */
 STATIC struct timespec g_accDeltaFromSet;
@@ -68,29 +74,12 @@ STATIC const UINT8 g_montbl[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30,
  */
 long timezone = -8 * 60 * 60; // defaults to CST: 8 hours east of the Prime Meridian
 
-int nanosleep(const struct timespec *rqtp, struct timespec *rmtp)
+STATIC INT32 OsNanoSleep(UINT64 nseconds, struct timespec *rmtp)
 {
-    UINT64 nseconds;
-    UINT64 tick;
     UINT32 ret;
-    const UINT32 nsPerTick = OS_SYS_NS_PER_SECOND / LOSCFG_BASE_CORE_TICK_PER_SECOND;
 
-    if (!ValidTimeSpec(rqtp)) {
-        errno = EINVAL;
-        return -1;
-    }
-
-    nseconds = (UINT64)rqtp->tv_sec * OS_SYS_NS_PER_SECOND + rqtp->tv_nsec;
-
-    tick = (nseconds + nsPerTick - 1) / nsPerTick; // Round up for ticks
-
-    if (tick >= UINT32_MAX) {
-        errno = EINVAL;
-        return -1;
-    }
-
-    /* PS: skip the first tick because it is NOT a full tick. */
-    ret = LOS_TaskDelay(tick ? (UINT32)(tick + 1) : 0);
+    /* The wake-up time is kept in cycles, so there is no partial first tick to skip. */
+    ret = LOS_TaskDelayNs(nseconds);
     if (ret == LOS_OK || ret == LOS_ERRNO_TSK_YIELD_NOT_ENOUGH_TASK) {
         if (rmtp) {
             rmtp->tv_sec = rmtp->tv_nsec = 0;
@@ -103,6 +92,16 @@ int nanosleep(const struct timespec *rqtp, struct timespec *rmtp)
     return -1;
 }
 
+int nanosleep(const struct timespec *rqtp, struct timespec *rmtp)
+{
+    if (!ValidTimeSpec(rqtp)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    return OsNanoSleep(OsTimeSpec2Ns(rqtp), rmtp);
+}
+
 int timer_create(clockid_t clockID, struct sigevent *restrict evp, timer_t *restrict timerID)
 {
     UINT32 ret;
@@ -252,15 +251,43 @@ int timer_getoverrun(timer_t timerID)
     return (int)swtmr->ucOverrun;
 }
 
+STATIC VOID OsCycle2TimeSpec(UINT64 cycle, struct timespec *tp)
+{
+    UINT64 nsec = (cycle / g_sysClock) * OS_SYS_NS_PER_SECOND +
+                  (cycle % g_sysClock) * OS_SYS_NS_PER_SECOND / g_sysClock;
+
+    tp->tv_sec = nsec / OS_SYS_NS_PER_SECOND;
+    tp->tv_nsec = nsec % OS_SYS_NS_PER_SECOND;
+}
+
 STATIC VOID OsGetHwTime(struct timespec *hwTime)
 {
-    UINT64 cycle = LOS_SysCycleGet();
-    UINT64 nowNsec = (cycle / g_sysClock) * OS_SYS_NS_PER_SECOND +
-                     (cycle % g_sysClock) * OS_SYS_NS_PER_SECOND / g_sysClock;
+    OsCycle2TimeSpec(LOS_SysCycleGet(), hwTime);
+}
+
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+/* CPU time is what CPUP accounted to the task, or to all tasks but idle for the process clock */
+STATIC INT32 OsGetCpuTime(clockid_t clockID, struct timespec *tp)
+{
+    UINT64 cycle = 0;
+    UINT32 ret;
 
-    hwTime->tv_sec = nowNsec / OS_SYS_NS_PER_SECOND;
-    hwTime->tv_nsec = nowNsec % OS_SYS_NS_PER_SECOND;
+    if (clockID == CLOCK_PROCESS_CPUTIME_ID) {
+        ret = LOS_SysCpuTimeGet(&cycle);
+    } else if (clockID == CLOCK_THREAD_CPUTIME_ID) {
+        ret = LOS_TaskCpuTimeGet(LOS_CurTaskIDGet(), &cycle);
+    } else {
+        ret = LOS_TaskCpuTimeGet(OS_CPUCLOCK_TO_TID(clockID), &cycle);
+    }
+    if (ret != LOS_OK) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    OsCycle2TimeSpec(cycle, tp);
+    return 0;
 }
+#endif
 
 STATIC VOID OsGetRealTime(struct timespec *realTime)
 {
@@ -344,6 +371,9 @@ int clock_gettime(clockid_t clockID, struct timespec *tp)
             return 0;
         case CLOCK_THREAD_CPUTIME_ID:
         case CLOCK_PROCESS_CPUTIME_ID:
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+            return OsGetCpuTime(clockID, tp);
+#endif
         case CLOCK_BOOTTIME:
 #ifdef CLOCK_REALTIME_ALARM
         case CLOCK_REALTIME_ALARM:
@@ -360,6 +390,11 @@ int clock_gettime(clockid_t clockID, struct timespec *tp)
             errno = ENOTSUP;
             return -1;
         default:
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+            if (OS_CPUCLOCK_IS_THREAD(clockID)) {
+                return OsGetCpuTime(clockID, tp);
+            }
+#endif
             errno = EINVAL;
             return -1;
     }
@@ -383,6 +418,11 @@ int clock_getres(clockid_t clockID, struct timespec *tp)
             return 0;
         case CLOCK_THREAD_CPUTIME_ID:
         case CLOCK_PROCESS_CPUTIME_ID:
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+            tp->tv_nsec = OS_SYS_NS_PER_SECOND / g_sysClock;
+            tp->tv_sec = 0;
+            return 0;
+#endif
         case CLOCK_BOOTTIME:
 #ifdef CLOCK_REALTIME_ALARM
         case CLOCK_REALTIME_ALARM:
@@ -399,6 +439,13 @@ int clock_getres(clockid_t clockID, struct timespec *tp)
             errno = ENOTSUP;
             return -1;
         default:
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+            if (OS_CPUCLOCK_IS_THREAD(clockID)) {
+                tp->tv_nsec = OS_SYS_NS_PER_SECOND / g_sysClock;
+                tp->tv_sec = 0;
+                return 0;
+            }
+#endif
             errno = EINVAL;
             return -1;
     }
@@ -406,17 +453,28 @@ int clock_getres(clockid_t clockID, struct timespec *tp)
 
 int clock_nanosleep(clockid_t clk, int flags, const struct timespec *req, struct timespec *rem)
 {
+    INT32 ret;
+    UINT64 nseconds;
+
     switch (clk) {
         case CLOCK_REALTIME:
+        case CLOCK_MONOTONIC:
             if (flags == 0) {
-                /* we only support the realtime clock currently */
-                return nanosleep(req, rem);
+                return (nanosleep(req, rem) == 0) ? 0 : errno;
             }
-            /* fallthrough */
+            if (flags == TIMER_ABSTIME) {
+                ret = OsGetNsTimeFromNow(req, clk, &nseconds);
+                if (ret == ETIMEDOUT) {
+                    return 0;
+                } else if (ret != 0) {
+                    return ret;
+                }
+                return (OsNanoSleep(nseconds, NULL) == 0) ? 0 : errno;
+            }
+            return EINVAL;
         case CLOCK_MONOTONIC_COARSE:
         case CLOCK_REALTIME_COARSE:
         case CLOCK_MONOTONIC_RAW:
-        case CLOCK_MONOTONIC:
         case CLOCK_PROCESS_CPUTIME_ID:
         case CLOCK_BOOTTIME:
 #ifdef CLOCK_REALTIME_ALARM
@@ -709,13 +767,84 @@ unsigned sleep(unsigned seconds)
 clock_t times(struct tms *tms)
 {
     clock_t clockTick = (clock_t)LOS_TickCountGet();
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+    UINT64 cpuCycle = 0;
+#endif
 
     if (tms != NULL) {
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+        /* There is no user/system split nor child processes, all task time is user time */
+        (VOID)LOS_SysCpuTimeGet(&cpuCycle);
+        tms->tms_utime  = (clock_t)(cpuCycle / g_cyclesPerTick);
+        tms->tms_stime  = 0;
+        tms->tms_cutime = 0;
+        tms->tms_cstime = 0;
+#else
         tms->tms_cstime = clockTick;
         tms->tms_cutime = clockTick;
         tms->tms_stime  = clockTick;
         tms->tms_utime  = clockTick;
+#endif
     }
     return clockTick;
 }
 
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+STATIC VOID OsRusageAdd(struct rusage *usage, const CPUP_RUSAGE_S *taskUsage, UINT64 *cpuCycle)
+{
+    /* ru_maxrss is in kilobytes, the nearest thing to it here is the stack usage */
+    long stackKb = (long)((taskUsage->stackPeakUsed + BYTES_PER_KB - 1) / BYTES_PER_KB);
+
+    *cpuCycle += taskUsage->cpuTime;
+    usage->ru_nvcsw += taskUsage->voluntarySwitch;
+    usage->ru_nivcsw += taskUsage->involuntarySwitch;
+    if (stackKb > usage->ru_maxrss) {
+        usage->ru_maxrss = stackKb;
+    }
+}
+
+int getrusage(int who, struct rusage *usage)
+{
+    CPUP_RUSAGE_S taskUsage;
+    struct timespec cpuTime = { 0 };
+    UINT64 cpuCycle = 0;
+    UINT32 taskID;
+
+    if (usage == NULL) {
+        errno = EFAULT;
+        return -1;
+    }
+
+    (VOID)memset_s(usage, sizeof(struct rusage), 0, sizeof(struct rusage));
+    switch (who) {
+        case RUSAGE_SELF:
+            for (taskID = 0; taskID < g_taskMaxNum; taskID++) {
+                if ((taskID == g_idleTaskID) || (OsTaskRusageGet(taskID, &taskUsage, FALSE) != LOS_OK)) {
+                    continue;
+                }
+                OsRusageAdd(usage, &taskUsage, &cpuCycle);
+            }
+            break;
+#ifdef RUSAGE_THREAD
+        case RUSAGE_THREAD:
+            if (OsTaskRusageGet(LOS_CurTaskIDGet(), &taskUsage, FALSE) != LOS_OK) {
+                errno = EINVAL;
+                return -1;
+            }
+            OsRusageAdd(usage, &taskUsage, &cpuCycle);
+            break;
+#endif
+        case RUSAGE_CHILDREN:
+            return 0;
+        default:
+            errno = EINVAL;
+            return -1;
+    }
+
+    OsCycle2TimeSpec(cpuCycle, &cpuTime);
+    usage->ru_utime.tv_sec = cpuTime.tv_sec;
+    usage->ru_utime.tv_usec = cpuTime.tv_nsec / OS_SYS_NS_PER_US;
+    return 0;
+}
+#endif
+
@@ -76,6 +76,18 @@
 #define DIV(a, b) (((a) / (b)) - ((a) % (b) < 0))
 #define LEAPS_THRU_END_OF(y) (DIV (y, 4) - DIV (y, 100) + DIV (y, 400))
 
+/*
+ * CPU-time clock of a given thread, encoded the same way as the C library does
+ * for pthread_getcpuclockid: a negative ID whose low three bits are 6.
+ */
+#define OS_CPUCLOCK_THREAD_TYPE        6
+#define OS_CPUCLOCK_TYPE_MASK          7
+#define OS_CPUCLOCK_SHIFT_MUL          8
+#define OS_CPUCLOCK_FROM_TID(tid)      ((clockid_t)((-(INT32)(tid) - 1) * OS_CPUCLOCK_SHIFT_MUL + \
+                                                    OS_CPUCLOCK_THREAD_TYPE))
+#define OS_CPUCLOCK_IS_THREAD(clk)     (((clk) < 0) && (((clk) & OS_CPUCLOCK_TYPE_MASK) == OS_CPUCLOCK_THREAD_TYPE))
+#define OS_CPUCLOCK_TO_TID(clk)        ((UINT32)(-(((clk) - OS_CPUCLOCK_THREAD_TYPE) / OS_CPUCLOCK_SHIFT_MUL) - 1))
+
 /* internal functions */
 STATIC INLINE BOOL ValidTimeSpec(const struct timespec *tp)
 {
@@ -112,24 +124,31 @@ STATIC INLINE VOID OsTick2TimeSpec(struct timespec *tp, UINT32 tick)
     tp->tv_nsec = (long)(ns % OS_SYS_NS_PER_SECOND);
 }
 
-STATIC INLINE INT32 OsGetTickTimeFromNow(const struct timespec *ts, clockid_t clockId, UINT64 *absTicks)
+STATIC INLINE UINT64 OsTimeSpec2Ns(const struct timespec *tp)
+{
+    return (UINT64)tp->tv_sec * OS_SYS_NS_PER_SECOND + tp->tv_nsec;
+}
+
+/* Get the relative time in nanoseconds from now to the absolute time ts of the clock clockId */
+STATIC INLINE INT32 OsGetNsTimeFromNow(const struct timespec *ts, clockid_t clockId, UINT64 *relNs)
 {
     struct timespec tp;
     UINT64 nseconds;
     UINT64 currTime;
-    const UINT32 nsPerTick = OS_SYS_NS_PER_SECOND / LOSCFG_BASE_CORE_TICK_PER_SECOND;
 
     if (!ValidTimeSpec(ts)) {
         return EINVAL;
     }
 
-    clock_gettime(clockId, &tp);
-    currTime = (UINT64)tp.tv_sec * OS_SYS_NS_PER_SECOND + tp.tv_nsec;
-    nseconds = (UINT64)ts->tv_sec * OS_SYS_NS_PER_SECOND + ts->tv_nsec;
+    if (clock_gettime(clockId, &tp) != 0) {
+        return EINVAL;
+    }
+    currTime = OsTimeSpec2Ns(&tp);
+    nseconds = OsTimeSpec2Ns(ts);
     if (currTime >= nseconds) {
         return ETIMEDOUT;
     }
-    *absTicks = ((nseconds - currTime) + nsPerTick - 1) / nsPerTick + 1;
+    *relNs = nseconds - currTime;
 
     return 0;
 }
@@ -197,6 +197,22 @@ extern "C" {
 #define LOSCFG_BASE_CORE_TSK_LIMIT                          5
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration item for task pools, which keep task control blocks and stacks reserved for short-lived workers
+ */
+#ifndef LOSCFG_BASE_CORE_TSK_POOL
+#define LOSCFG_BASE_CORE_TSK_POOL                           0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of task pools
+ */
+#ifndef LOSCFG_BASE_CORE_TSK_POOL_LIMIT
+#define LOSCFG_BASE_CORE_TSK_POOL_LIMIT                     4
+#endif
+
 /**
  * @ingroup los_config
  * Size of the idle task stack
@@ -229,6 +245,58 @@ extern "C" {
 #define LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT                  20000 /* 20ms */
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration item for per-task time slice lengths, and counters of slice expirations and yields per task
+ */
+#ifndef LOSCFG_BASE_CORE_TIMESLICE_PER_TASK
+#define LOSCFG_BASE_CORE_TIMESLICE_PER_TASK                 0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item for timer slack: task delays, timed pends and software timers may expire up to their
+ * slack late, so that deadlines falling within the slack share a single wakeup.
+ * LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK works earlier: it moves a task delay's own deadline onto an aligned
+ * software timer when the delay is queued. With both enabled, the moved deadline is then subject to this slack.
+ */
+#ifndef LOSCFG_KERNEL_SCHED_SLACK
+#define LOSCFG_KERNEL_SCHED_SLACK                           0
+#endif
+
+/**
+ * @ingroup los_config
+ * Default slack, in microseconds, of new tasks and software timers
+ */
+#ifndef LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US
+#define LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US                0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item to measure how long tasks stay ready before they run, per task and as a global histogram
+ */
+#ifndef LOSCFG_KERNEL_SCHED_LATENCY
+#define LOSCFG_KERNEL_SCHED_LATENCY                         0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item for the earliest-deadline-first scheduling class. Tasks put in it with LOS_TaskEdfSet run
+ * above all fixed priorities, ordered by deadline, and are throttled when they use up their budget of a period
+ */
+#ifndef LOSCFG_KERNEL_SCHED_EDF
+#define LOSCFG_KERNEL_SCHED_EDF                             0
+#endif
+
+/**
+ * @ingroup los_config
+ * Admission limit, in percent of the CPU, of the summed budget/period of all earliest-deadline-first tasks
+ */
+#ifndef LOSCFG_KERNEL_SCHED_EDF_UTIL_MAX
+#define LOSCFG_KERNEL_SCHED_EDF_UTIL_MAX                    90
+#endif
+
 /**
  * @ingroup los_config
  * Configuration item for task (stack) monitoring module tailoring
@@ -237,6 +305,32 @@ extern "C" {
 #define LOSCFG_BASE_CORE_TSK_MONITOR                        0
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration item to track the task stack high-water mark from the stack pointer saved at each context switch,
+ * so that reading it does not scan the stack
+ */
+#ifndef LOSCFG_BASE_CORE_TSK_STACK_TRACK
+#define LOSCFG_BASE_CORE_TSK_STACK_TRACK                    0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item to read the tracked high-water mark by scanning the stack for the unused pattern, which also
+ * catches the peaks between context switches. The scan stops at the tracked mark instead of the stack pointer.
+ */
+#ifndef LOSCFG_BASE_CORE_TSK_STACK_TRACK_PRECISE
+#define LOSCFG_BASE_CORE_TSK_STACK_TRACK_PRECISE            0
+#endif
+
+/**
+ * @ingroup los_config
+ * Stack usage percentage above which a tracked task reports a warning once, 0 to disable the warning
+ */
+#ifndef LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT
+#define LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT             80
+#endif
+
 /**
  * @ingroup los_config
  * Configuration item for task perf task filter hook
@@ -253,6 +347,19 @@ extern "C" {
 #define LOSCFG_BASE_CORE_TSK_SWITCH_HOOK()
 #endif
 
+/**
+ * @ingroup los_config
+ * Number of task priorities, 32 or a multiple of 32 up to 256. With more than 32 priorities the ready queues are
+ * found through a two-level bitmap, and every CMSIS priority maps to its own task priority.
+ */
+#ifndef LOSCFG_BASE_CORE_TSK_PRIORITY_NUM
+#define LOSCFG_BASE_CORE_TSK_PRIORITY_NUM                   32
+#endif
+
+#if ((LOSCFG_BASE_CORE_TSK_PRIORITY_NUM % 32) != 0) || (LOSCFG_BASE_CORE_TSK_PRIORITY_NUM > 256)
+#error "LOSCFG_BASE_CORE_TSK_PRIORITY_NUM must be 32, 64, 96, ... or 256!"
+#endif
+
 /**
  * @ingroup los_config
  * Define a usable task priority.Highest task priority.
@@ -266,7 +373,7 @@ extern "C" {
  * Define a usable task priority.Lowest task priority.
  */
 #ifndef LOS_TASK_PRIORITY_LOWEST
-#define LOS_TASK_PRIORITY_LOWEST                            31
+#define LOS_TASK_PRIORITY_LOWEST                            (LOSCFG_BASE_CORE_TSK_PRIORITY_NUM - 1)
 #endif
 
 /**
@@ -350,6 +457,23 @@ extern "C" {
 #define LOSCFG_BASE_IPC_QUEUE_LIMIT                         6
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration item for creating queues on the message memory provided by the caller
+ */
+#ifndef LOSCFG_BASE_IPC_QUEUE_STATIC
+#define LOSCFG_BASE_IPC_QUEUE_STATIC                        0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item for placing the control block tables of tasks, semaphores, mutexes, queues and software
+ * timers in the static section LITE_OS_SEC_BSS_KERNEL_CB instead of allocating them from the system heap
+ */
+#ifndef LOSCFG_KERNEL_STATIC_CB
+#define LOSCFG_KERNEL_STATIC_CB                             0
+#endif
+
 
 /* =============================================================================
                                        Software timer module configuration
@@ -386,6 +510,17 @@ extern "C" {
 #define LOSCFG_BASE_CORE_SWTMR_ALIGN                        0
 #endif
 
+/**
+ * @ingroup los_config
+ * Slack, in ticks, by which a task delay may be extended to expire together with an aligned software timer.
+ * Only the earliest few timer timeouts are considered, so that the task switch path stays bounded.
+ * 0 disables the coalescing of task delays. See LOSCFG_KERNEL_SCHED_SLACK for per task and per timer slack,
+ * which defers the wakeup instead of the deadline.
+ */
+#ifndef LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK
+#define LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK                  0
+#endif
+
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
     #if (LOSCFG_BASE_CORE_SWTMR == 0)
         #error "if LOSCFG_BASE_CORE_SWTMR_ALIGN is set to 1, then LOSCFG_BASE_CORE_SWTMR must also be set to 1"
@@ -394,7 +529,24 @@ extern "C" {
 
 /**
  * @ingroup los_config
- * Maximum size of a software timer queue
+ * Configuration item for the background software timer task. Timers moved to the background tier by
+ * LOS_SwtmrTierSet are handled by this task instead of the highest priority timer task.
+ */
+#ifndef LOSCFG_BASE_CORE_SWTMR_BACKGROUND
+#define LOSCFG_BASE_CORE_SWTMR_BACKGROUND                   0
+#endif
+
+/**
+ * @ingroup los_config
+ * Priority of the background software timer task
+ */
+#ifndef LOSCFG_BASE_CORE_SWTMR_BACKGROUND_PRIO
+#define LOSCFG_BASE_CORE_SWTMR_BACKGROUND_PRIO              LOSCFG_BASE_CORE_TSK_DEFAULT_PRIO
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum number of pending timeouts of each software timer task, further timeouts are counted as dropped
  */
 #ifndef OS_SWTMR_HANDLE_QUEUE_SIZE
 #define OS_SWTMR_HANDLE_QUEUE_SIZE                          (LOSCFG_BASE_CORE_SWTMR_LIMIT + 0)
@@ -413,6 +565,49 @@ extern "C" {
         #error "if LOSCFG_BASE_CORE_SWTMR is set to 1, then LOSCFG_BASE_IPC_QUEUE must also be set to 1"
     #endif
 #endif
+
+/* =============================================================================
+                                       Work queue module configuration
+============================================================================= */
+/**
+ * @ingroup los_config
+ * Configuration item for work queue module tailoring
+ */
+#ifndef LOSCFG_BASE_CORE_WORKQUEUE
+#define LOSCFG_BASE_CORE_WORKQUEUE                          0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of work queues, including the queue that runs threaded interrupt handlers
+ */
+#ifndef LOSCFG_BASE_CORE_WORKQUEUE_LIMIT
+#define LOSCFG_BASE_CORE_WORKQUEUE_LIMIT                    4
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of interrupts created with LOS_HWI_MODE_THREADED
+ */
+#ifndef LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT
+#define LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT                4
+#endif
+
+/**
+ * @ingroup los_config
+ * Priority of the task that runs threaded interrupt handlers
+ */
+#ifndef LOSCFG_BASE_CORE_WORKQUEUE_HWI_PRIO
+#define LOSCFG_BASE_CORE_WORKQUEUE_HWI_PRIO                 1
+#endif
+
+/**
+ * @ingroup los_config
+ * Stack size of the task that runs threaded interrupt handlers
+ */
+#ifndef LOSCFG_BASE_CORE_WORKQUEUE_HWI_STACK_SIZE
+#define LOSCFG_BASE_CORE_WORKQUEUE_HWI_STACK_SIZE           LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE
+#endif
 /* =============================================================================
                                        Memory module configuration ---- to be refactored
 ============================================================================= */
@@ -460,7 +655,9 @@ extern UINT8 *m_aucSysMem0;
 
 /**
  * @ingroup los_config
- * Configuration module tailoring of memory released by task id
+ * Configuration module tailoring of memory released by task id. The task id narrows the node size field, so a memory
+ * pool and each block must stay below 16MB, 8MB with LOSCFG_MEM_LEAKCHECK, 4MB with pool expansion and 2MB with
+ * LOSCFG_MEM_HANDLE, the lowest limit that applies.
  */
 #ifndef LOSCFG_MEM_FREE_BY_TASKID
 #define LOSCFG_MEM_FREE_BY_TASKID                           0
@@ -543,6 +740,51 @@ extern UINT8 *m_aucSysMem0;
 #define LOSCFG_MEM_MUL_REGIONS                              0
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration of memory pool fragmentation statistics
+ */
+#ifndef LOSCFG_MEM_FRAG_STAT
+#define LOSCFG_MEM_FRAG_STAT                                0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration of movable memory handles which can be compacted. The handle flag takes a bit of the node size field,
+ * a memory pool and each block must stay below 128MB, or 2MB with LOSCFG_MEM_FREE_BY_TASKID.
+ */
+#ifndef LOSCFG_MEM_HANDLE
+#define LOSCFG_MEM_HANDLE                                   0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of movable memory handles
+ */
+#ifndef LOSCFG_MEM_HANDLE_LIMIT
+#define LOSCFG_MEM_HANDLE_LIMIT                             32
+#endif
+
+#if (LOSCFG_MEM_HANDLE == 1) && (LOSCFG_MEM_HANDLE_LIMIT >= 0xFFFF)
+    #error "LOSCFG_MEM_HANDLE_LIMIT must be less than 0xFFFF"
+#endif
+
+/**
+ * @ingroup los_config
+ * Number of movable memory blocks of the system heap that the idle task compacts each time it runs, 0 to disable
+ */
+#ifndef LOSCFG_MEM_HANDLE_IDLE_COMPACT
+#define LOSCFG_MEM_HANDLE_IDLE_COMPACT                      0
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration of memory re-allocation statistics
+ */
+#ifndef LOSCFG_MEM_REALLOC_STAT
+#define LOSCFG_MEM_REALLOC_STAT                             0
+#endif
+
 /* =============================================================================
                                         Exception module configuration
 ============================================================================= */
@@ -619,6 +861,108 @@ extern UINT8 *m_aucSysMem0;
 #define LOSCFG_TASK_MEM_USED                                 0
 #endif
 
+/**
+ * @ingroup los_config
+ * Configuration item to record the time and the system heap consumed by every kernel initialization stage.
+ */
+#ifndef LOSCFG_KERNEL_BOOT_PROFILE
+#define LOSCFG_KERNEL_BOOT_PROFILE                           0
+#endif
+
+/**
+ * @ingroup los_config
+ * Maximum number of recorded initialization stages, including the stages recorded by the user.
+ */
+#ifndef LOSCFG_KERNEL_BOOT_PROFILE_STAGE_NUM
+#define LOSCFG_KERNEL_BOOT_PROFILE_STAGE_NUM                 24
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item to record per vector interrupt counts and durations, and the time interrupts stay masked by
+ * LOS_IntLock sections. It relies on the interrupt hooks.
+ */
+#ifndef LOSCFG_KERNEL_IRQSTAT
+#define LOSCFG_KERNEL_IRQSTAT                                0
+#endif
+
+/**
+ * @ingroup los_config
+ * Number of interrupt indexes with statistics. The index is the one passed to the interrupt hooks, which is the
+ * exception number on Cortex-M and so counts the 16 system exceptions.
+ */
+#ifndef LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT
+#define LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT                   (LOSCFG_PLATFORM_HWI_LIMIT + 16)
+#endif
+
+#if (LOSCFG_KERNEL_IRQSTAT == 1) && (LOSCFG_DEBUG_HOOK == 0)
+    #error "if LOSCFG_KERNEL_IRQSTAT is set to 1, then LOSCFG_DEBUG_HOOK must also be set to 1"
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item to keep the longest interrupt masked and scheduler locked sections, with the call stacks that
+ * closed them, and to fire LOS_HOOK_TYPE_CRITICAL_SECTION for the sections above a threshold. It relies on the
+ * interrupt statistics and on LOS_RecordLR.
+ */
+#ifndef LOSCFG_KERNEL_IRQSTAT_CRITICAL
+#define LOSCFG_KERNEL_IRQSTAT_CRITICAL                       0
+#endif
+
+/**
+ * @ingroup los_config
+ * Number of the longest sections kept per kind of critical section.
+ */
+#ifndef LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM
+#define LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM               8
+#endif
+
+/**
+ * @ingroup los_config
+ * Number of return addresses recorded for each kept section.
+ */
+#ifndef LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH
+#define LOSCFG_KERNEL_IRQSTAT_CRITICAL_LR_DEPTH              4
+#endif
+
+/**
+ * @ingroup los_config
+ * Default duration in microseconds above which a critical section fires LOS_HOOK_TYPE_CRITICAL_SECTION.
+ */
+#ifndef LOSCFG_KERNEL_IRQSTAT_CRITICAL_THRESHOLD_US
+#define LOSCFG_KERNEL_IRQSTAT_CRITICAL_THRESHOLD_US          100
+#endif
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1) && ((LOSCFG_KERNEL_IRQSTAT == 0) || (LOSCFG_BACKTRACE_TYPE == 0))
+    #error "if LOSCFG_KERNEL_IRQSTAT_CRITICAL is set to 1, then LOSCFG_KERNEL_IRQSTAT and LOSCFG_BACKTRACE_TYPE must also be set"
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item to run the modules registered by LOS_MODULE_INIT at the end of LOS_KernelInit, and the modules
+ * registered as deferred in a low priority task after LOS_Start. It relies on the __start_/__stop_ section symbols
+ * provided by GNU compatible linkers.
+ */
+#ifndef LOSCFG_KERNEL_MODULE_INIT
+#define LOSCFG_KERNEL_MODULE_INIT                            0
+#endif
+
+/**
+ * @ingroup los_config
+ * Priority of the task running the deferred module initialization
+ */
+#ifndef LOSCFG_KERNEL_MODULE_INIT_TASK_PRIO
+#define LOSCFG_KERNEL_MODULE_INIT_TASK_PRIO                  (LOS_TASK_PRIORITY_LOWEST - 1)
+#endif
+
+/**
+ * @ingroup los_config
+ * Stack size of the task running the deferred module initialization
+ */
+#ifndef LOSCFG_KERNEL_MODULE_INIT_STACK_SIZE
+#define LOSCFG_KERNEL_MODULE_INIT_STACK_SIZE                 LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE
+#endif
+
 /* *
  * @ingroup los_interrupt
  * Configuration item for interrupt with argument
@@ -254,6 +254,31 @@ extern UINT32 LOS_EventPoll(UINT32 *eventID, UINT32 eventMask, UINT32 mode);
  */
 extern UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UINT32 mode, UINT32 timeOut);
 
+/**
+ * @ingroup los_event
+ * @brief Read an event with a timeout in nanoseconds.
+ *
+ * @par Description:
+ * This API is the same as LOS_EventRead, except that the timeout is expressed in nanoseconds and is not rounded
+ * to Ticks.
+ * @attention
+ * <ul>
+ * <li>The same restrictions as LOS_EventRead apply.</li>
+ * </ul>
+ *
+ * @param eventCB      [IN/OUT] Pointer to the event control block to be checked.
+ * @param eventMask    [IN] Mask of the event expected to occur by the user, indicating the event obtained after
+ * it is logically processed that matches the ID pointed to by mode.
+ * @param mode         [IN] Event reading mode.
+ * @param timeOutNs    [IN] Timeout interval of event reading in nanoseconds, LOS_WAIT_FOREVER_NS to wait forever.
+ *
+ * @retval Same as LOS_EventRead.
+ * @par Dependency:
+ * <ul><li>los_event.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_EventRead
+ */
+extern UINT32 LOS_EventReadNs(PEVENT_CB_S eventCB, UINT32 eventMask, UINT32 mode, UINT64 timeOutNs);
+
 /**
  * @ingroup los_event
  * @brief Write an event.
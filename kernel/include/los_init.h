@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_init Module initialization
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_INIT_H
+#define _LOS_INIT_H
+
+#include "los_compiler.h"
+#include "los_config.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+/**
+ * @ingroup los_init
+ * Initialization levels. The modules of a lower level are initialized before the modules of a higher level.
+ */
+#define LOS_INIT_LEVEL_KERNEL           0
+#define LOS_INIT_LEVEL_PLATFORM         1
+#define LOS_INIT_LEVEL_COMPONENT        2
+#define LOS_INIT_LEVEL_FS               3
+#define LOS_INIT_LEVEL_NET              4
+#define LOS_INIT_LEVEL_APP              5
+#define LOS_INIT_LEVEL_NUM              6
+
+/**
+ * @ingroup los_init
+ * Module flag: the module is initialized by the deferred initialization task after LOS_Start.
+ */
+#define LOS_INIT_DEFERRED               0x1U
+
+/**
+ * @ingroup los_init
+ * Module state: the module has not been initialized yet.
+ */
+#define LOS_INIT_STATE_PENDING          0
+
+/**
+ * @ingroup los_init
+ * Module state: the initialization function of the module returned LOS_OK.
+ */
+#define LOS_INIT_STATE_DONE             1
+
+/**
+ * @ingroup los_init
+ * Module state: the initialization function of the module failed, or one of its dependencies could not be satisfied.
+ */
+#define LOS_INIT_STATE_FAILED           2
+
+/**
+ * @ingroup los_init
+ * Define the type of a module initialization function.
+ */
+typedef UINT32 (*LOS_INIT_HOOK)(VOID);
+
+/**
+ * @ingroup los_init
+ * Module initialization entry, placed in the los_init_table section by LOS_MODULE_INIT.
+ */
+typedef struct {
+    const CHAR *name;               /**< Module name, used to resolve dependencies      */
+    LOS_INIT_HOOK hook;             /**< Initialization function                        */
+    const CHAR *const *depends;     /**< NULL terminated names of the required modules  */
+    UINT16 level;                   /**< Initialization level                           */
+    UINT16 flags;                   /**< LOS_INIT_DEFERRED or 0                         */
+} LOS_INIT_ENTRY;
+
+#define OS_INIT_SECTION     __attribute__((used, section("los_init_table"), aligned(sizeof(VOID *))))
+
+#define OS_MODULE_INIT_ENTRY(name, hook, level, flags, depends) \
+    STATIC const LOS_INIT_ENTRY g_initEntry_##name OS_INIT_SECTION = { #name, (hook), (depends), (level), (flags) }
+
+/**
+ * @ingroup los_init
+ * Register the module name, initialized by hook at the end of LOS_KernelInit.
+ */
+#define LOS_MODULE_INIT(name, hook, level) \
+    OS_MODULE_INIT_ENTRY(name, hook, level, 0, NULL)
+
+/**
+ * @ingroup los_init
+ * Register the module name, initialized by hook in the deferred initialization task after LOS_Start.
+ */
+#define LOS_MODULE_INIT_DEFERRED(name, hook, level) \
+    OS_MODULE_INIT_ENTRY(name, hook, level, LOS_INIT_DEFERRED, NULL)
+
+/**
+ * @ingroup los_init
+ * Register the module name, initialized by hook once all the modules listed after flags are initialized.
+ * A module can only depend on modules of the same or a lower level, and a module that is not deferred can not depend
+ * on a deferred module.
+ */
+#define LOS_MODULE_INIT_DEPENDS(name, hook, level, flags, ...)                          \
+    STATIC const CHAR *const g_initDepends_##name[] = { __VA_ARGS__, NULL };            \
+    OS_MODULE_INIT_ENTRY(name, hook, level, flags, g_initDepends_##name)
+
+/**
+ * @ingroup los_init
+ * @brief Get the initialization state of a registered module.
+ *
+ * @par Description:
+ * This API is used to get the initialization state of the module registered under the name.
+ *
+ * @attention
+ * <ul>
+ * <li>The API returns LOS_NOK before the module initialization runs at the end of LOS_KernelInit.</li>
+ * </ul>
+ *
+ * @param name  [IN] Type #const CHAR * Module name.
+ * @param state [OUT] Type #UINT32 * #LOS_INIT_STATE_PENDING, #LOS_INIT_STATE_DONE or #LOS_INIT_STATE_FAILED.
+ *
+ * @retval #LOS_NOK The module is not registered, or the parameters are invalid.
+ * @retval #LOS_OK  The state is got successfully.
+ * @par Dependency:
+ * <ul><li>los_init.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_ModuleInitWait
+ */
+extern UINT32 LOS_ModuleInitStateGet(const CHAR *name, UINT32 *state);
+
+/**
+ * @ingroup los_init
+ * @brief Wait for the deferred module initialization.
+ *
+ * @par Description:
+ * This API is used to block the current task until all the deferred modules are initialized, or the timeout expires.
+ *
+ * @attention
+ * <ul>
+ * <li>The API can not be called in interrupt, by the deferred modules, or while the task scheduling is locked.</li>
+ * <li>A module that failed to initialize is considered as finished. Use LOS_ModuleInitStateGet to check it.</li>
+ * </ul>
+ *
+ * @param timeout [IN] Type #UINT32 Timeout in ticks, LOS_WAIT_FOREVER to wait forever.
+ *
+ * @retval #LOS_NOK The deferred initialization is not finished before the timeout expires.
+ * @retval #LOS_OK  All the deferred modules are initialized.
+ * @par Dependency:
+ * <ul><li>los_init.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_ModuleInitStateGet
+ */
+extern UINT32 LOS_ModuleInitWait(UINT32 timeout);
+#endif
+
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+/**
+ * @ingroup los_init
+ * Initialization stage information structure
+ */
+typedef struct {
+    const CHAR *name;   /**< Stage name                                                   */
+    UINT64 endCycle;    /**< System cycle at the end of the stage                         */
+    UINT32 cycles;      /**< Cycles spent by the stage                                    */
+    UINT32 heapUsed;    /**< Used size of the system heap at the end of the stage         */
+    INT32 heapDelta;    /**< Size of the system heap consumed by the stage                */
+} LOS_BOOT_STAGE_INFO;
+
+/**
+ * @ingroup los_init
+ * @brief Record the end of an initialization stage.
+ *
+ * @par Description:
+ * This API is used to record the system cycle and the used size of the system heap at the end of an initialization
+ * stage. The stage starts at the end of the previous recorded stage. LOS_KernelInit records its own stages, the
+ * user can record the stages of the board and the application the same way.
+ *
+ * @attention
+ * <ul>
+ * <li>The name is not copied, it must be a constant string.</li>
+ * <li>The stages recorded before the tick timer is initialized have no cycles.</li>
+ * <li>At most LOSCFG_KERNEL_BOOT_PROFILE_STAGE_NUM stages are recorded, the following ones are ignored.</li>
+ * </ul>
+ *
+ * @param name  [IN] Stage name.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_init.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_BootStageInfoGet
+ */
+extern VOID LOS_BootStageRecord(const CHAR *name);
+
+/**
+ * @ingroup los_init
+ * @brief Get the information of a recorded initialization stage.
+ *
+ * @par Description:
+ * This API is used to get the information of the recorded initialization stage specified by index.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param index  [IN]  Stage index, in the order the stages are recorded.
+ * @param info   [OUT] A pointer for storage the stage information.
+ *
+ * @retval #LOS_NOK  The index is out of the recorded stages, or info is NULL.
+ * @retval #LOS_OK   Success to get the stage information.
+ * @par Dependency:
+ * <ul><li>los_init.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_BootStageRecord
+ */
+extern UINT32 LOS_BootStageInfoGet(UINT32 index, LOS_BOOT_STAGE_INFO *info);
+
+/**
+ * @ingroup los_init
+ * @brief Show all the recorded initialization stages.
+ *
+ * @par Description:
+ * This API is used to print the time and the system heap consumed by all the recorded initialization stages.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_init.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_BootStageRecord
+ */
+extern VOID LOS_BootStageShow(VOID);
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_INIT_H */
@@ -213,6 +213,7 @@ typedef struct {
  * <li>The size parameter value should match the following two conditions :
  * 1) Be less than or equal to the Memory pool size;
  * 2) Be greater than the size of OS_MEM_MIN_POOL_SIZE.</li>
+ * <li>The size must fit in the node size field, which LOSCFG_MEM_FREE_BY_TASKID and LOSCFG_MEM_HANDLE narrow.</li>
  * <li>Call this API when dynamic memory needs to be initialized during the startup of Huawei LiteOS.</li>
  * <li>The parameter input must be four byte-aligned.</li>
  * <li>The init area [pool, pool + size] should not conflict with other pools.</li>
@@ -317,6 +318,37 @@ extern UINT32 LOS_MemFree(VOID *pool, VOID *ptr);
  */
 extern VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size);
 
+/**
+ * @ingroup los_memory
+ * @brief Re-allocate a memory block with a size hint for the following growth.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API works like LOS_MemRealloc, but the memory block may be given up to reserve bytes when it has to be
+ * resized, so a buffer that keeps growing can be extended in place by the next calls instead of being copied.</li>
+ * <li>The block is extended into the free node behind it first, then into the free node in front of it (the data is
+ * moved down), and a new block is allocated and the data copied only if both fail.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * <li>The input ptr parameter must be allocated by LOS_MemAlloc or LOS_MemAllocAlign or LOS_MemRealloc.</li>
+ * <li>A reserve parameter not greater than size is ignored, the call is the same as LOS_MemRealloc then.</li>
+ * </ul>
+ *
+ * @param  pool     [IN] Pointer to the memory pool that contains the original and new memory blocks.
+ * @param  ptr      [IN] Address of the original memory block.
+ * @param  size     [IN] Size of the new memory block.
+ * @param  reserve  [IN] Size the memory block is expected to grow to.
+ *
+ * @retval #NULL    The memory fails to be re-allocated.
+ * @retval #VOID*   The memory is successfully re-allocated with the starting address of the new memory block returned.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRealloc
+ */
+extern VOID *LOS_MemReallocHint(VOID *pool, VOID *ptr, UINT32 size, UINT32 reserve);
+
 /**
  * @ingroup los_memory
  * @brief Allocate aligned memory.
@@ -439,6 +471,217 @@ extern UINT32 LOS_MemInfoGet(VOID *pool, LOS_MEM_POOL_STATUS *poolStatus);
  */
 extern UINT32 LOS_MemFreeNodeShow(VOID *pool);
 
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+/**
+ * @ingroup los_memory
+ * Number of free node size buckets in the fragmentation histogram.
+ * Bucket 0 holds free nodes smaller than 128 bytes, bucket n holds free nodes of [2^(n + 6), 2^(n + 7)) bytes.
+ */
+#define LOS_MEM_FRAG_HIST_NUM   25
+
+/**
+ * @ingroup los_memory
+ * Memory pool fragmentation information structure
+ */
+typedef struct {
+    UINT32 totalFreeSize;                        /**< Total size of all free nodes                    */
+    UINT32 maxFreeNodeSize;                      /**< Size of the largest free node                    */
+    UINT32 freeNodeNum;                          /**< Number of free nodes                             */
+    UINT32 fragPercent;                          /**< 100 - maxFreeNodeSize * 100 / totalFreeSize      */
+    UINT32 freeNodeHist[LOS_MEM_FRAG_HIST_NUM];  /**< Number of free nodes in every size bucket        */
+} LOS_MEM_FRAG_INFO;
+
+/**
+ * @ingroup los_memory
+ * @brief Get the fragmentation information of memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get the fragmentation information of memory pool. The total free size and the free node
+ * number are tracked on every free list operation, the largest free node and the histogram are collected from the
+ * free lists only, so it is much cheaper than walking all nodes of the pool.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * </ul>
+ *
+ * @param  pool               [IN] A pointer pointed to the memory pool.
+ * @param  fragInfo           [OUT] A pointer for storage the fragmentation information.
+ *
+ * @retval #LOS_NOK           The incoming parameter pool is NULL or invalid, or fragInfo is NULL.
+ * @retval #LOS_OK            Success to get fragmentation information.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemInfoGet | LOS_MemFreeNodeShow
+ */
+extern UINT32 LOS_MemFragInfoGet(VOID *pool, LOS_MEM_FRAG_INFO *fragInfo);
+#endif
+
+#if (LOSCFG_MEM_HANDLE == 1)
+/**
+ * @ingroup los_memory
+ * Invalid movable memory handle.
+ */
+#define LOS_MEM_HANDLE_INVALID  0xFFFFFFFFU
+
+/**
+ * @ingroup los_memory
+ * @brief Allocate a movable memory block.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to allocate a memory block that is referenced by a handle instead of an address. While the
+ * block is unlocked, LOS_MemHandleCompact may move it to coalesce the free space of the pool.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * <li>The number of movable blocks is limited by LOSCFG_MEM_HANDLE_LIMIT.</li>
+ * </ul>
+ *
+ * @param  pool      [IN] Pointer to the memory pool that contains the memory block to be allocated.
+ * @param  size      [IN] Size of the memory block to be allocated (unit: byte).
+ * @param  handle    [OUT] Handle of the allocated memory block.
+ *
+ * @retval #LOS_NOK  The parameters are invalid, no handle is available or the memory fails to be allocated.
+ * @retval #LOS_OK   The memory block is successfully allocated.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemHandleLock | LOS_MemHandleUnlock | LOS_MemHandleFree
+ */
+extern UINT32 LOS_MemHandleAlloc(VOID *pool, UINT32 size, UINT32 *handle);
+
+/**
+ * @ingroup los_memory
+ * @brief Lock a movable memory block and get its address.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to pin a movable memory block. The returned address stays valid until the same number of
+ * LOS_MemHandleUnlock calls are made.</li>
+ * </ul>
+ *
+ * @param  handle    [IN] Handle of the memory block.
+ *
+ * @retval #NULL     The handle is invalid.
+ * @retval #VOID*    The current address of the memory block.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemHandleUnlock
+ */
+extern VOID *LOS_MemHandleLock(UINT32 handle);
+
+/**
+ * @ingroup los_memory
+ * @brief Unlock a movable memory block.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to unpin a movable memory block, the address got by LOS_MemHandleLock must not be used
+ * after the last unlock.</li>
+ * </ul>
+ *
+ * @param  handle    [IN] Handle of the memory block.
+ *
+ * @retval #LOS_NOK  The handle is invalid or the block is not locked.
+ * @retval #LOS_OK   The memory block is successfully unlocked.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemHandleLock
+ */
+extern UINT32 LOS_MemHandleUnlock(UINT32 handle);
+
+/**
+ * @ingroup los_memory
+ * @brief Free a movable memory block.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to free a movable memory block and release its handle.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>A locked memory block can not be freed.</li>
+ * </ul>
+ *
+ * @param  handle    [IN] Handle of the memory block.
+ *
+ * @retval #LOS_NOK  The handle is invalid or the block is still locked.
+ * @retval #LOS_OK   The memory block is successfully freed.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemHandleAlloc
+ */
+extern UINT32 LOS_MemHandleFree(UINT32 handle);
+
+/**
+ * @ingroup los_memory
+ * @brief Compact the movable memory blocks of a memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to slide unlocked movable memory blocks down into the free node in front of them, so that
+ * the free space of the pool is merged into larger nodes. Every move is done with the pool locked, and the pool
+ * is unlocked between two moves.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>It is expected to be called repeatedly from a low priority task until it returns 0. The system heap is also
+ * compacted by the idle task when LOSCFG_MEM_HANDLE_IDLE_COMPACT is not 0.</li>
+ * <li>A movable memory block can not be freed or reallocated by LOS_MemFree or LOS_MemRealloc.</li>
+ * <li>The memory blocks are not moved while LMS is enabled.</li>
+ * </ul>
+ *
+ * @param  pool      [IN] Pointer to the memory pool.
+ * @param  maxMoves  [IN] Maximum number of memory blocks to move in this call.
+ *
+ * @retval #UINT32   The number of memory blocks moved.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemHandleAlloc
+ */
+extern UINT32 LOS_MemHandleCompact(VOID *pool, UINT32 maxMoves);
+#endif
+
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+/**
+ * @ingroup los_memory
+ * Memory pool re-allocation statistics structure
+ */
+typedef struct {
+    UINT32 inPlaceCount;    /**< Number of blocks resized in place or grown into the next free node  */
+    UINT32 backwardCount;   /**< Number of blocks grown into the previous free node                 */
+    UINT32 copyCount;       /**< Number of blocks re-allocated and copied                           */
+    UINT32 failCount;       /**< Number of failed re-allocations                                    */
+} LOS_MEM_REALLOC_STAT;
+
+/**
+ * @ingroup los_memory
+ * @brief Get the re-allocation statistics of memory pool.
+ *
+ * @par Description:
+ * <ul>
+ * <li>This API is used to get how the LOS_MemRealloc and LOS_MemReallocHint calls of the memory pool were
+ * served.</li>
+ * </ul>
+ * @attention
+ * <ul>
+ * <li>The input pool parameter must be initialized via func LOS_MemInit.</li>
+ * </ul>
+ *
+ * @param  pool               [IN] A pointer pointed to the memory pool.
+ * @param  reallocStat        [OUT] A pointer for storage the re-allocation statistics.
+ *
+ * @retval #LOS_NOK           The incoming parameter pool is NULL or invalid, or reallocStat is NULL.
+ * @retval #LOS_OK            Success to get re-allocation statistics.
+ * @par Dependency:
+ * <ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRealloc | LOS_MemReallocHint
+ */
+extern UINT32 LOS_MemReallocStatGet(VOID *pool, LOS_MEM_REALLOC_STAT *reallocStat);
+#endif
+
 /**
  * @ingroup los_memory
  * @brief Check the memory pool integrity.
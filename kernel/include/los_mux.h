@@ -266,6 +266,29 @@ extern UINT32 LOS_MuxDelete(UINT32 muxHandle);
  */
 extern UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout);
 
+/**
+ * @ingroup los_mux
+ * @brief Wait to lock a mutex with a timeout in nanoseconds.
+ *
+ * @par Description:
+ * This API is the same as LOS_MuxPend, except that the timeout is expressed in nanoseconds and is not rounded
+ * to Ticks.
+ * @attention
+ * <ul>
+ * <li>The specified mutex id must be created first. </li>
+ * </ul>
+ *
+ * @param muxHandle   [IN] Handle of the mutex to be waited on.
+ * @param timeoutNs   [IN] Waiting time in nanoseconds. If the value is set to 0, the mutex is not waited on.
+ * If the value is set to LOS_WAIT_FOREVER_NS, the mutex is waited on forever.
+ *
+ * @retval Same as LOS_MuxPend.
+ * @par Dependency:
+ * <ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MuxPend
+ */
+extern UINT32 LOS_MuxPendNs(UINT32 muxHandle, UINT64 timeoutNs);
+
 /**
  * @ingroup los_mux
  * @brief Release a mutex.
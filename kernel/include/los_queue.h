@@ -403,6 +403,52 @@ extern UINT32 LOS_QueueCreate(const CHAR *queueName,
                               UINT32 flags,
                               UINT16 maxMsgSize);
 
+#if (LOSCFG_BASE_IPC_QUEUE_STATIC == 1)
+/**
+ * @ingroup los_queue
+ * Size of the message memory needed by a queue of len messages of maxMsgSize bytes.
+ */
+#define LOS_QUEUE_STATIC_MEM_SIZE(len, maxMsgSize)  ((UINT32)(len) * ((UINT32)(maxMsgSize) + sizeof(UINT32)))
+
+/**
+ * @ingroup los_queue
+ * @brief Create a message queue on the memory provided by the caller.
+ *
+ * @par Description:
+ * This API is used to create a message queue whose messages are stored in queueMem instead of the system heap.
+ * @attention
+ * <ul>
+ * <li>There are LOSCFG_BASE_IPC_QUEUE_LIMIT queues available, change it's value when necessary.</li>
+ * <li>The queueMem must stay valid until the queue is deleted, it is not freed by LOS_QueueDelete.</li>
+ * </ul>
+ * @param queueName        [IN]    Message queue name. Reserved parameter, not used for now.
+ * @param len              [IN]    Queue length. The value range is [1,0xffff].
+ * @param queueID          [OUT]   ID of the queue control structure that is successfully created.
+ * @param flags            [IN]    Queue mode. Reserved parameter, not used for now.
+ * @param maxMsgSize       [IN]    Node size. The value range is [1,0xffff-4].
+ * @param queueMem         [IN]    Message memory of the queue.
+ * @param memSize          [IN]    Size of queueMem, at least LOS_QUEUE_STATIC_MEM_SIZE(len, maxMsgSize).
+ *
+ * @retval   #LOS_OK                               The message queue is successfully created.
+ * @retval   #LOS_ERRNO_QUEUE_CB_UNAVAILABLE       The upper limit of the number of created queues is exceeded.
+ * @retval   #LOS_ERRNO_QUEUE_CREATE_NO_MEMORY     The memSize is too small for the queue.
+ * @retval   #LOS_ERRNO_QUEUE_CREAT_PTR_NULL       Null pointer, queueID or queueMem is NULL.
+ * @retval   #LOS_ERRNO_QUEUE_PARA_ISZERO          The queue length or message node size passed in during queue
+ * creation is 0.
+ * @retval   #LOS_ERRNO_QUEUE_SIZE_TOO_BIG         The parameter maxMsgSize is larger than 0xffff - 4.
+ * @par Dependency:
+ * <ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueCreate | LOS_QueueDelete
+ */
+extern UINT32 LOS_QueueCreateStatic(const CHAR *queueName,
+                                    UINT16 len,
+                                    UINT32 *queueID,
+                                    UINT32 flags,
+                                    UINT16 maxMsgSize,
+                                    VOID *queueMem,
+                                    UINT32 memSize);
+#endif
+
 /**
  * @ingroup los_queue
  * @brief Read a queue.
@@ -451,6 +497,33 @@ extern UINT32 LOS_QueueReadCopy(UINT32 queueID,
                                 UINT32 *bufferSize,
                                 UINT32 timeOut);
 
+/**
+ * @ingroup los_queue
+ * @brief Read a queue with a timeout in nanoseconds.
+ *
+ * @par Description:
+ * This API is the same as LOS_QueueReadCopy, except that the timeout is expressed in nanoseconds and is not rounded
+ * to Ticks.
+ * @attention
+ * <ul>
+ * <li>The same restrictions as LOS_QueueReadCopy apply.</li>
+ * </ul>
+ *
+ * @param queueID        [IN]     Queue ID created by LOS_QueueCreate.
+ * @param bufferAddr     [OUT]    Starting address that stores the obtained data.
+ * @param bufferSize     [IN/OUT] Where to maintain the buffer expected-size before read, and the real-size after read.
+ * @param timeOutNs      [IN]     Expiry time in nanoseconds, LOS_WAIT_FOREVER_NS to wait forever.
+ *
+ * @retval Same as LOS_QueueReadCopy.
+ * @par Dependency:
+ * <ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueReadCopy
+ */
+extern UINT32 LOS_QueueReadCopyNs(UINT32 queueID,
+                                  VOID *bufferAddr,
+                                  UINT32 *bufferSize,
+                                  UINT64 timeOutNs);
+
 /**
  * @ingroup los_queue
  * @brief Write data into a queue.
@@ -497,6 +570,33 @@ extern UINT32 LOS_QueueWriteCopy(UINT32 queueID,
                                  UINT32 bufferSize,
                                  UINT32 timeOut);
 
+/**
+ * @ingroup los_queue
+ * @brief Write a queue with a timeout in nanoseconds.
+ *
+ * @par Description:
+ * This API is the same as LOS_QueueWriteCopy, except that the timeout is expressed in nanoseconds and is not rounded
+ * to Ticks.
+ * @attention
+ * <ul>
+ * <li>The same restrictions as LOS_QueueWriteCopy apply.</li>
+ * </ul>
+ *
+ * @param queueID        [IN]        Queue ID created by LOS_QueueCreate.
+ * @param bufferAddr     [IN]        Starting address that stores the data to be written.
+ * @param bufferSize     [IN]        Passed-in buffer size.
+ * @param timeOutNs      [IN]        Expiry time in nanoseconds, LOS_WAIT_FOREVER_NS to wait forever.
+ *
+ * @retval Same as LOS_QueueWriteCopy.
+ * @par Dependency:
+ * <ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_QueueWriteCopy
+ */
+extern UINT32 LOS_QueueWriteCopyNs(UINT32 queueID,
+                                   VOID *bufferAddr,
+                                   UINT32 bufferSize,
+                                   UINT64 timeOutNs);
+
 /**
  * @ingroup los_queue
  * @brief Read a queue.
@@ -800,6 +900,12 @@ typedef struct {
   */
 #define OS_QUEUE_INUSED        1
 
+/**
+  *  @ingroup los_queue
+  *  Message queue state: used, the message memory is provided by the creator.
+  */
+#define OS_QUEUE_INUSED_STATIC 2
+
 /**
   *  @ingroup los_queue
   *  Not in use.
@@ -916,7 +1022,7 @@ extern UINT32 OsQueueInit(VOID);
  * @param operateType    [IN]       Operate type
  * @param bufferAddr     [IN]       Buffer address.
  * @param bufferSize     [IN]       Buffer size.
- * @param timeOut        [IN]       Timeout.
+ * @param timeOut        [IN]       Timeout in cycles, OS_SCHED_WAIT_FOREVER to wait forever.
  *
  * @retval   UINT32  Handle result.
  * @par Dependency:
@@ -924,7 +1030,7 @@ extern UINT32 OsQueueInit(VOID);
  * @see None.
  */
 extern UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT32 *bufferSize,
-                             UINT32 timeOut);
+                             UINT64 timeOut);
 
 #ifdef __cplusplus
 #if __cplusplus
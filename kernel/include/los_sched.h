@@ -46,6 +46,10 @@ extern "C" {
 #define OS_SCHED_MINI_PERIOD       (g_sysClock / LOSCFG_BASE_CORE_TICK_PER_SECOND_MINI)
 #define OS_SCHED_MAX_RESPONSE_TIME OS_SORT_LINK_UINT64_MAX
 
+/* Wait time in cycles meaning LOS_WAIT_FOREVER, and the largest finite wait time */
+#define OS_SCHED_WAIT_FOREVER      OS_SORT_LINK_UINT64_MAX
+#define OS_SCHED_WAIT_CYCLE_MAX    (OS_SORT_LINK_UINT64_MAX >> 1)
+
 extern UINT32 g_taskScheduled;
 typedef BOOL (*SchedScan)(VOID);
 
@@ -55,6 +59,10 @@ VOID OsSchedSetIdleTaskSchedParam(LosTaskCB *idleTask);
 
 UINT32 OsSchedSwtmrScanRegister(SchedScan func);
 
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+UINT32 OsSchedWorkScanRegister(SchedScan func);
+#endif
+
 VOID OsSchedUpdateExpireTime(VOID);
 
 UINT64 OsSchedGetNextExpireTime(UINT64 startTime);
@@ -65,11 +73,13 @@ VOID OsSchedTaskEnQueue(LosTaskCB *taskCB);
 
 VOID OsSchedTaskWait(LOS_DL_LIST *list, UINT32 timeout);
 
+VOID OsSchedTaskWaitCycle(LOS_DL_LIST *list, UINT64 timeout);
+
 VOID OsSchedTaskWake(LosTaskCB *resumedTask);
 
 BOOL OsSchedModifyTaskSchedParam(LosTaskCB *taskCB, UINT16 priority);
 
-VOID OsSchedDelay(LosTaskCB *runTask, UINT32 tick);
+VOID OsSchedDelay(LosTaskCB *runTask, UINT64 cycles);
 
 VOID OsSchedYield(VOID);
 
@@ -89,11 +99,177 @@ BOOL OsSchedTaskSwitch(VOID);
 
 LosTaskCB *OsGetTopTask(VOID);
 
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+UINT32 OsSchedEdfParamSet(LosTaskCB *taskCB, UINT32 periodUs, UINT32 budgetUs, BOOL *needSched);
+
+UINT64 OsSchedEdfJobEnd(LosTaskCB *runTask);
+#endif
+
 STATIC INLINE UINT64 OsGetCurrSchedTimeCycle(VOID)
 {
     return LOS_SysCycleGet();
 }
 
+STATIC INLINE UINT64 OsSchedTickToWaitCycle(UINT32 ticks)
+{
+    if (ticks == LOS_WAIT_FOREVER) {
+        return OS_SCHED_WAIT_FOREVER;
+    }
+    return OS_SYS_TICK_TO_CYCLE(ticks);
+}
+
+/* Round up, so that a timeout never expires before the requested time */
+STATIC INLINE UINT64 OsSchedNsToWaitCycle(UINT64 ns)
+{
+    UINT64 sec = ns / OS_SYS_NS_PER_SECOND;
+    UINT64 nsec = ns % OS_SYS_NS_PER_SECOND;
+
+    if (ns == LOS_WAIT_FOREVER_NS) {
+        return OS_SCHED_WAIT_FOREVER;
+    }
+    if (sec >= (OS_SCHED_WAIT_CYCLE_MAX / g_sysClock)) {
+        return OS_SCHED_WAIT_CYCLE_MAX;
+    }
+    return (sec * g_sysClock) + (((nsec * g_sysClock) + OS_SYS_NS_PER_SECOND - 1) / OS_SYS_NS_PER_SECOND);
+}
+
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+STATIC INLINE UINT32 OsSchedSlackUsToCycle(UINT32 slackUs)
+{
+    UINT64 cycles = OS_SYS_NS_TO_CYCLE((UINT64)slackUs * OS_SYS_NS_PER_US, g_sysClock);
+    return (cycles > OS_NULL_INT) ? OS_NULL_INT : (UINT32)cycles;
+}
+
+VOID OsSchedSlackExpired(const SortLinkList *sortList);
+
+/**
+ * @ingroup los_sched
+ * Timer slack statistics
+ */
+typedef struct {
+    UINT32 wakeups;     /**< Timer wakeups that scanned the expired tasks and software timers */
+    UINT32 expired;     /**< Task and software timer expirations handled by these wakeups */
+    UINT32 deferred;    /**< Expirations deferred by their slack to a later wakeup, each one saving at most
+                             one wakeup */
+} LOS_SCHED_SLACK_STAT_S;
+
+/**
+ * @ingroup los_sched
+ * @brief Obtain the timer slack statistics.
+ *
+ * @par Description:
+ * This API is used to obtain how many expirations were batched into a shared wakeup by their slack.
+ *
+ * @attention None.
+ *
+ * @param  stat [OUT] Timer slack statistics.
+ *
+ * @retval #LOS_NOK   The statistics pointer is NULL.
+ * @retval #LOS_OK    The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_sched.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskSlackSet | LOS_SwtmrSlackSet
+ */
+extern UINT32 LOS_SchedSlackStatGet(LOS_SCHED_SLACK_STAT_S *stat);
+#endif
+
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+/**
+ * @ingroup los_sched
+ * Number of latency histogram buckets. Bucket 0 counts latencies below 2^LOS_SCHED_LATENCY_HIST_SHIFT cycles,
+ * bucket n counts latencies in [2^(LOS_SCHED_LATENCY_HIST_SHIFT + n - 1), 2^(LOS_SCHED_LATENCY_HIST_SHIFT + n))
+ * cycles, and the last bucket also counts everything longer.
+ */
+#define LOS_SCHED_LATENCY_HIST_NUM      16
+#define LOS_SCHED_LATENCY_HIST_SHIFT    6
+
+/**
+ * @ingroup los_sched
+ * Ready-to-run latency statistics of all tasks
+ */
+typedef struct {
+    LOS_SCHED_LATENCY_S latency;                    /**< Statistics over all tasks */
+    UINT32 taskID;                                  /**< Task that waited the longest */
+    UINT32 hist[LOS_SCHED_LATENCY_HIST_NUM];        /**< log2 latency histogram */
+} LOS_SCHED_LATENCY_GLOBAL_S;
+
+/**
+ * @ingroup los_sched
+ * @brief Obtain the ready-to-run latency statistics of a task.
+ *
+ * @par Description:
+ * The latency runs from the moment the task is put in the ready queue, by a wakeup, a resume or a preemption, to
+ * the moment it is switched in. The idle task is not measured.
+ *
+ * @attention None.
+ *
+ * @param  taskID [IN] Task ID.
+ * @param  stat   [OUT] Latency statistics of the task.
+ *
+ * @retval #LOS_ERRNO_TSK_PTR_NULL    The statistics pointer is NULL.
+ * @retval #LOS_ERRNO_TSK_ID_INVALID  Invalid task ID.
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED The task is not created.
+ * @retval #LOS_OK                    The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_sched.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SchedLatencyGlobalGet
+ */
+extern UINT32 LOS_SchedLatencyGet(UINT32 taskID, LOS_SCHED_LATENCY_S *stat);
+
+/**
+ * @ingroup los_sched
+ * @brief Obtain the ready-to-run latency statistics of all tasks.
+ *
+ * @attention None.
+ *
+ * @param  stat   [OUT] Global latency statistics.
+ *
+ * @retval #LOS_ERRNO_TSK_PTR_NULL    The statistics pointer is NULL.
+ * @retval #LOS_OK                    The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_sched.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SchedLatencyGet
+ */
+extern UINT32 LOS_SchedLatencyGlobalGet(LOS_SCHED_LATENCY_GLOBAL_S *stat);
+
+/**
+ * @ingroup los_sched
+ * @brief Clear the latency statistics of all tasks.
+ */
+extern VOID LOS_SchedLatencyReset(VOID);
+
+/**
+ * @ingroup los_sched
+ * @brief Print the latency statistics of the tasks that were measured, and the global histogram.
+ */
+extern VOID LOS_SchedLatencyShow(VOID);
+#endif
+
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+/* Time slice length in cycles, 0 selects LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT */
+STATIC INLINE INT32 OsSchedTimeSliceUsToCycle(UINT32 sliceUs)
+{
+    UINT64 cycles;
+
+    if (sliceUs == 0) {
+        sliceUs = LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT;
+    }
+    cycles = OS_SYS_NS_TO_CYCLE((UINT64)sliceUs * OS_SYS_NS_PER_US, g_sysClock);
+    return (cycles > (OS_NULL_INT >> 1)) ? (INT32)(OS_NULL_INT >> 1) : (INT32)cycles;
+}
+#endif
+
+STATIC INLINE UINT32 OsSchedWaitCycleToTick(UINT64 cycles)
+{
+    UINT64 ticks;
+
+    if (cycles == OS_SCHED_WAIT_FOREVER) {
+        return LOS_WAIT_FOREVER;
+    }
+    ticks = (cycles + OS_CYCLE_PER_TICK - 1) / OS_CYCLE_PER_TICK;
+    return (ticks >= LOS_WAIT_FOREVER) ? (LOS_WAIT_FOREVER - 1) : (UINT32)ticks;
+}
+
 /**
  * @ingroup los_sched
  * @brief Get the time, in nanoseconds, remaining before the next tick interrupt response.
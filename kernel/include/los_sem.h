@@ -271,6 +271,29 @@ extern UINT32 LOS_SemDelete(UINT32 semHandle);
  */
 extern UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout);
 
+/**
+ * @ingroup los_sem
+ * @brief Request a semaphore with a timeout in nanoseconds.
+ *
+ * @par Description:
+ * This API is the same as LOS_SemPend, except that the timeout is expressed in nanoseconds and is not rounded
+ * to Ticks.
+ * @attention
+ * <ul>
+ * <li>The specified sem id must be created first. </li>
+ * </ul>
+ *
+ * @param semHandle   [IN] ID of the semaphore control structure to be requested.
+ * @param timeoutNs   [IN] Timeout interval in nanoseconds. If the value is set to 0, the semaphore is not waited on.
+ * If the value is set to LOS_WAIT_FOREVER_NS, the semaphore is waited on forever.
+ *
+ * @retval Same as LOS_SemPend.
+ * @par Dependency:
+ * <ul><li>los_sem.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SemPend
+ */
+extern UINT32 LOS_SemPendNs(UINT32 semHandle, UINT64 timeoutNs);
+
 /**
  * @ingroup los_sem
  * @brief Release a semaphore.
@@ -34,6 +34,7 @@
 
 #include "los_compiler.h"
 #include "los_list.h"
+#include "los_config.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -44,11 +45,16 @@ extern "C" {
 typedef enum {
     OS_SORT_LINK_TASK = 1,
     OS_SORT_LINK_SWTMR = 2,
+    OS_SORT_LINK_WORK = 3,
+    OS_SORT_LINK_EDF = 4,       /* Ready earliest-deadline-first tasks by deadline, not a timer list */
 } SortLinkType;
 
 typedef struct {
     LOS_DL_LIST sortLinkNode;
     UINT64      responseTime;
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+    UINT32      slack;          /* Cycles the expiry may be deferred by to share a wakeup */
+#endif
 } SortLinkList;
 
 typedef struct {
@@ -57,6 +63,12 @@ typedef struct {
 
 extern SortLinkAttribute g_taskSortLink;
 extern SortLinkAttribute g_swtmrSortLink;
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+extern SortLinkAttribute g_workSortLink;
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+extern SortLinkAttribute g_edfSortLink;
+#endif
 
 #define OS_SORT_LINK_INVALID_TIME ((UINT64)-1)
 #define SET_SORTLIST_VALUE(sortList, value) (((SortLinkList *)(sortList))->responseTime = (value))
@@ -96,23 +108,48 @@ STATIC INLINE UINT64 GetSortLinkNextExpireTime(SortLinkAttribute *sortHeader, UI
     }
 
     SortLinkList *listSorted = LOS_DL_LIST_ENTRY(list, SortLinkList, sortLinkNode);
-    if (listSorted->responseTime <= (startTime + tickPrecision)) {
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+    /* Wake at the earliest deadline plus slack, every node expiring before then is served by the same wakeup */
+    UINT64 expireTime = listSorted->responseTime + listSorted->slack;
+    list = list->pstNext;
+    while (list != head) {
+        SortLinkList *listNext = LOS_DL_LIST_ENTRY(list, SortLinkList, sortLinkNode);
+        if (listNext->responseTime >= expireTime) {
+            break;
+        }
+        if ((listNext->responseTime + listNext->slack) < expireTime) {
+            expireTime = listNext->responseTime + listNext->slack;
+        }
+        list = list->pstNext;
+    }
+#else
+    UINT64 expireTime = listSorted->responseTime;
+#endif
+    if (expireTime <= (startTime + tickPrecision)) {
         return (startTime + tickPrecision);
     }
 
-    return listSorted->responseTime;
+    return expireTime;
 }
 
 STATIC INLINE UINT64 OsGetNextExpireTime(UINT64 startTime, UINT32 tickPrecision)
 {
     UINT64 taskExpireTime = GetSortLinkNextExpireTime(&g_taskSortLink, startTime, tickPrecision);
     UINT64 swtmrExpireTime = GetSortLinkNextExpireTime(&g_swtmrSortLink, startTime, tickPrecision);
-    return (taskExpireTime < swtmrExpireTime) ? taskExpireTime : swtmrExpireTime;
+    UINT64 expireTime = (taskExpireTime < swtmrExpireTime) ? taskExpireTime : swtmrExpireTime;
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+    UINT64 workExpireTime = GetSortLinkNextExpireTime(&g_workSortLink, startTime, tickPrecision);
+    if (workExpireTime < expireTime) {
+        expireTime = workExpireTime;
+    }
+#endif
+    return expireTime;
 }
 
 SortLinkAttribute *OsGetSortLinkAttribute(SortLinkType type);
 UINT32 OsSortLinkInit(SortLinkAttribute *sortLinkHeader);
 VOID OsAdd2SortLink(SortLinkList *node, UINT64 startTime, UINT32 waitTicks, SortLinkType type);
+VOID OsAdd2SortLinkCycle(SortLinkList *node, UINT64 responseTime, SortLinkType type);
 VOID OsDeleteSortLink(SortLinkList *node);
 UINT64 OsSortLinkGetTargetExpireTime(UINT64 currTime, const SortLinkList *targetSortList);
 UINT64 OsSortLinkGetNextExpireTime(const SortLinkAttribute *sortLinkHeader);
@@ -213,6 +213,16 @@ extern "C" {
  */
 #define LOS_ERRNO_SWTMR_TICK_PTR_NULL               LOS_ERRNO_OS_ERROR(LOS_MOD_SWTMR, 0x10)
 
+/**
+ * @ingroup los_swtmr
+ * Software timer error code: Invalid software timer tier.
+ *
+ * Value: 0x02000313
+ *
+ * Solution: Use a tier defined in EnSwTmrTier.
+ */
+#define LOS_ERRNO_SWTMR_TIER_INVALID                LOS_ERRNO_OS_ERROR(LOS_MOD_SWTMR, 0x13)
+
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
 #define OS_ERRNO_SWTMR_ROUSES_INVALID               LOS_ERRNO_OS_ERROR(LOS_MOD_SWTMR, 0x11)
 #define OS_ERRNO_SWTMR_ALIGN_INVALID                LOS_ERRNO_OS_ERROR(LOS_MOD_SWTMR, 0x12)
@@ -241,6 +251,27 @@ enum EnSwTmrType {
                                         This mode is not supported temporarily. */
 };
 
+/**
+ * @ingroup los_swtmr
+ * Software timer tier, selecting the timer task that runs the callback function
+ */
+enum EnSwTmrTier {
+    LOS_SWTMR_TIER_HIGH,            /* Handled by the highest priority timer task */
+    LOS_SWTMR_TIER_BACKGROUND,      /* Handled by the background timer task */
+    LOS_SWTMR_TIER_NUM
+};
+
+/**
+ * @ingroup los_swtmr
+ * Timeout statistics of a software timer tier
+ */
+typedef struct {
+    UINT32 dispatched;  /**< Callback functions run by the timer task */
+    UINT32 dropped;     /**< Timeouts lost because the pending timeouts of the tier were full */
+    UINT32 late;        /**< Callback functions that started one tick or more after the timer expired */
+    UINT32 maxBatch;    /**< Largest number of timeouts handed over by a single scan */
+} SWTMR_TIER_STAT_S;
+
 /**
 * @ingroup  los_swtmr
 * @brief Define the type of a callback function that handles software timer timeout.
@@ -272,6 +303,7 @@ typedef struct tagSwTmrCtrl {
     UINT8               ucState;        /* Software timer state                                  */
     UINT8               ucMode;         /* Software timer mode                                   */
     UINT8               ucOverrun;      /* Times that a software timer repeats timing            */
+    UINT8               ucTier;         /* Timer task tier that runs the callback function       */
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
     UINT8               ucRouses;       /* wake up enable                                        */
     UINT8               ucSensitive;    /* align enable                                          */
@@ -431,6 +463,82 @@ extern UINT32 LOS_SwtmrCreate(UINT32 interval,
  */
 extern UINT32 LOS_SwtmrDelete(UINT32 swtmrID);
 
+/**
+ * @ingroup los_swtmr
+ * @brief Select the tier of a software timer.
+ *
+ * @par Description:
+ * This API is used to select which timer task runs the callback function of a software timer.
+ * Timers are created in the LOS_SWTMR_TIER_HIGH tier.
+ * @attention
+ * <ul>
+ * <li>The tier takes effect from the next timeout of the timer.</li>
+ * <li>Without LOSCFG_BASE_CORE_SWTMR_BACKGROUND, the background tier is handled by the highest priority
+ * timer task.</li>
+ * </ul>
+ *
+ * @param  swtmrID     [IN] Software timer ID created by LOS_SwtmrCreate.
+ * @param  tier        [IN] Software timer tier, see EnSwTmrTier.
+ *
+ * @retval #LOS_ERRNO_SWTMR_ID_INVALID        Invalid software timer ID.
+ * @retval #LOS_ERRNO_SWTMR_TIER_INVALID      Invalid software timer tier.
+ * @retval #LOS_ERRNO_SWTMR_NOT_CREATED       The software timer is not created.
+ * @retval #LOS_OK                            The software timer tier is successfully set.
+ * @par Dependency:
+ * <ul><li>los_swtmr.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SwtmrCreate
+ */
+extern UINT32 LOS_SwtmrTierSet(UINT32 swtmrID, UINT8 tier);
+
+/**
+ * @ingroup los_swtmr
+ * @brief Obtain the timeout statistics of a software timer tier.
+ *
+ * @par Description:
+ * This API is used to obtain how many timeouts a tier dispatched, dropped or ran late.
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  tier        [IN] Software timer tier, see EnSwTmrTier.
+ * @param  stat        [OUT] Statistics of the tier.
+ *
+ * @retval #LOS_ERRNO_SWTMR_TIER_INVALID      Invalid software timer tier.
+ * @retval #LOS_ERRNO_SWTMR_RET_PTR_NULL      The statistics pointer is NULL.
+ * @retval #LOS_OK                            The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_swtmr.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SwtmrTierSet
+ */
+extern UINT32 LOS_SwtmrTierStatGet(UINT8 tier, SWTMR_TIER_STAT_S *stat);
+
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+/**
+ * @ingroup los_swtmr
+ * @brief Set the slack of a software timer.
+ *
+ * @par Description:
+ * This API is used to let a software timer expire up to the slack late, so that its timeout can share a wakeup
+ * with other deadlines.
+ * @attention
+ * <ul>
+ * <li>Timers are created with LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US of slack.</li>
+ * </ul>
+ *
+ * @param  swtmrID     [IN] Software timer ID created by LOS_SwtmrCreate.
+ * @param  slackUs     [IN] Slack, in microseconds.
+ *
+ * @retval #LOS_ERRNO_SWTMR_ID_INVALID        Invalid software timer ID.
+ * @retval #LOS_ERRNO_SWTMR_NOT_CREATED       The software timer is not created.
+ * @retval #LOS_OK                            The slack is successfully set.
+ * @par Dependency:
+ * <ul><li>los_swtmr.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SchedSlackStatGet
+ */
+extern UINT32 LOS_SwtmrSlackSet(UINT32 swtmrID, UINT32 slackUs);
+#endif
+
 /**
  * @ingroup los_swtmr
  * Software timer state
@@ -450,6 +558,7 @@ typedef struct {
     UINT32              arg;            /**< Parameter passed in when the callback function
                                              that handles software timer timeout is called */
     UINT32              swtmrID;        /**< The id used to obtain the software timer handle */
+    UINT64              expireTime;     /**< Cycle at which the software timer expired */
 } SwtmrHandlerItem;
 
 extern SWTMR_CTRL_S *g_swtmrCBArray;
@@ -502,6 +611,10 @@ extern UINT32 OsSwtmrGetNextTimeout(VOID);
 
 extern VOID OsSwtmrResponseTimeReset(UINT64 startTime);
 
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1) && (LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK > 0)
+extern UINT64 OsSwtmrAlignDelayTime(UINT64 responseTime);
+#endif
+
 #ifdef __cplusplus
 #if __cplusplus
 }
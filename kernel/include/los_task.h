@@ -440,6 +440,96 @@ extern "C" {
  */
 #define LOS_ERRNO_TSK_PROCESS_SIGNAL                LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x29)
 
+/**
+ * @ingroup los_task
+ * Task error code: Invalid earliest-deadline-first period or budget.
+ *
+ * Value: 0x0200022a
+ *
+ * Solution: Use a budget of at least 50 microseconds that does not exceed the period.
+ */
+#define LOS_ERRNO_TSK_EDF_PARAM_INVALID             LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x2a)
+
+/**
+ * @ingroup los_task
+ * Task error code: The earliest-deadline-first admission test failed.
+ *
+ * Value: 0x0200022b
+ *
+ * Solution: Reduce the budgets of the earliest-deadline-first tasks, or raise LOSCFG_KERNEL_SCHED_EDF_UTIL_MAX.
+ */
+#define LOS_ERRNO_TSK_EDF_OVERLOAD                  LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x2b)
+
+/**
+ * @ingroup los_task
+ * Task error code: The task is not in the earliest-deadline-first scheduling class.
+ *
+ * Value: 0x0200022c
+ *
+ * Solution: Set a period for the task with LOS_TaskEdfSet first.
+ */
+#define LOS_ERRNO_TSK_NOT_EDF                       LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x2c)
+
+/**
+ * @ingroup los_task
+ * Task error code: Invalid time slice.
+ *
+ * Value: 0x0200022d
+ *
+ * Solution: Use 0 for the default time slice, or at least LOS_TASK_TIMESLICE_MIN_US microseconds.
+ */
+#define LOS_ERRNO_TSK_TIMESLICE_INVALID             LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x2d)
+
+/**
+ * @ingroup los_task
+ * Task error code: Invalid task pool parameter.
+ *
+ * Value: 0x0200022e
+ *
+ * Solution: Check that the pool ID pointer is not NULL and that the pool has at least one task.
+ */
+#define LOS_ERRNO_TSK_POOL_PARAM_INVALID            LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x2e)
+
+/**
+ * @ingroup los_task
+ * Task error code: No free task pool control block.
+ *
+ * Value: 0x0200022f
+ *
+ * Solution: Delete unused task pools or increase LOSCFG_BASE_CORE_TSK_POOL_LIMIT.
+ */
+#define LOS_ERRNO_TSK_POOL_UNAVAILABLE              LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x2f)
+
+/**
+ * @ingroup los_task
+ * Task error code: Invalid task pool ID, or the pool is not created.
+ *
+ * Value: 0x02000230
+ *
+ * Solution: Use the pool ID obtained from LOS_TaskPoolCreate.
+ */
+#define LOS_ERRNO_TSK_POOL_ID_INVALID               LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x30)
+
+/**
+ * @ingroup los_task
+ * Task error code: All tasks of the task pool are in use.
+ *
+ * Value: 0x02000231
+ *
+ * Solution: Wait for a worker of the pool to finish, or create the pool with more tasks.
+ */
+#define LOS_ERRNO_TSK_POOL_EMPTY                    LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x31)
+
+/**
+ * @ingroup los_task
+ * Task error code: The task pool cannot be deleted while tasks spawned from it exist.
+ *
+ * Value: 0x02000232
+ *
+ * Solution: Delete the pool after its workers have finished.
+ */
+#define LOS_ERRNO_TSK_POOL_BUSY                     LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x32)
+
 /**
  * @ingroup los_task
  * Define the type of the task entry function.
@@ -461,6 +551,10 @@ typedef struct tagTskInitParam {
     UINT32               uwStackSize;               /**< Task stack size                        */
     CHAR                 *pcName;                   /**< Task name                              */
     UINT32               uwResved;                  /**< Reserved                               */
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+    UINT32               timeSliceUs;               /**< Time slice in microseconds, 0 for
+                                                         LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT    */
+#endif
 } TSK_INIT_PARAM_S;
 
 /**
@@ -511,6 +605,12 @@ typedef struct tagTskInfo {
  */
 #define LOS_WAIT_FOREVER                 0xFFFFFFFF
 
+/**
+ * @ingroup los_task
+ * Define the timeout interval in nanoseconds as waiting forever.
+ */
+#define LOS_WAIT_FOREVER_NS              0xFFFFFFFFFFFFFFFFULL
+
 /**
  * @ingroup los_task
  * @brief Sleep the current task.
@@ -793,6 +893,33 @@ extern UINT32 LOS_TaskDelete(UINT32 taskID);
  */
 extern UINT32 LOS_TaskDelay(UINT32 tick);
 
+/**
+ * @ingroup  los_task
+ * @brief Delay a task in nanoseconds.
+ *
+ * @par Description:
+ * This API is used to delay the execution of the current task for a specified number of nanoseconds. The wake-up
+ * time is kept in cycles and is not rounded to Ticks, so the delay can be shorter than one Tick.
+ *
+ * @attention
+ * <ul>
+ * <li>The same restrictions as LOS_TaskDelay apply.</li>
+ * <li>The delay is rounded up to the tick timer cycle, and the actual wake-up is bounded by the minimum response
+ * period of the tick timer.</li>
+ * </ul>
+ *
+ * @param  nanoseconds [IN] Type #UINT64 Number of nanoseconds for which the task is delayed.
+ *
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_INT              The task delay occurs during an interrupt.
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_LOCK             The task delay occurs when the task scheduling is locked.
+ * @retval #LOS_ERRNO_TSK_YIELD_NOT_ENOUGH_TASK     No tasks with the same priority is available for scheduling.
+ * @retval #LOS_OK                                  The task is successfully delayed.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskDelay
+ */
+extern UINT32 LOS_TaskDelayNs(UINT64 nanoseconds);
+
 /**
  * @ingroup  los_task
  * @brief Lock the task scheduling.
@@ -869,6 +996,272 @@ extern VOID LOS_TaskUnlock(VOID);
  */
 extern UINT32 LOS_TaskPriSet(UINT32 taskID, UINT16 taskPrio);
 
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+/**
+ * @ingroup  los_task
+ * @brief Set the timer slack of a task.
+ *
+ * @par Description:
+ * This API is used to let the delays and timed pends of a task expire up to the slack late, so that
+ * they can share a wakeup with other deadlines.
+ *
+ * @attention
+ * <ul>
+ * <li>Tasks are created with LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US of slack.</li>
+ * </ul>
+ *
+ * @param  taskID   [IN] Type #UINT32 Task ID. The task id value is obtained from task creation.
+ * @param  slackUs  [IN] Type #UINT32 Slack, in microseconds.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID     Invalid Task ID
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED    The task is not created.
+ * @retval #LOS_OK                       The slack is successfully set.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SchedSlackStatGet
+ */
+extern UINT32 LOS_TaskSlackSet(UINT32 taskID, UINT32 slackUs);
+#endif
+
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+/**
+ * @ingroup  los_task
+ * @brief Create a task pool.
+ *
+ * @par Description:
+ * This API is used to reserve task control blocks and stacks for workers that are started often and run
+ * briefly. The workers are started with LOS_TaskPoolSpawn, which neither searches for a task control block nor
+ * allocates a stack, and a worker that returns or is deleted gives both back to the pool.
+ *
+ * @attention
+ * <ul>
+ * <li>The task control blocks are taken from the LOSCFG_BASE_CORE_TSK_LIMIT tasks of the system, and the stacks
+ * are allocated from the system heap in one block.</li>
+ * <li>All the workers of a pool share its name, priority and stack size.</li>
+ * </ul>
+ *
+ * @param  name      [IN] Type #CHAR * Name of the workers.
+ * @param  taskNum   [IN] Type #UINT16 Number of workers that can exist at the same time.
+ * @param  stackSize [IN] Type #UINT32 Stack size of each worker, 0 for LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE.
+ * @param  priority  [IN] Type #UINT16 Priority of the workers.
+ * @param  poolID    [OUT] Type #UINT32 * ID of the created pool.
+ *
+ * @retval #LOS_ERRNO_TSK_POOL_PARAM_INVALID The pool ID pointer is NULL or taskNum is 0.
+ * @retval #LOS_ERRNO_TSK_NAME_EMPTY         The name is NULL.
+ * @retval #LOS_ERRNO_TSK_PRIOR_ERROR        Incorrect priority.
+ * @retval #LOS_ERRNO_TSK_STKSZ_TOO_SMALL    The stack size is too small.
+ * @retval #LOS_ERRNO_TSK_POOL_UNAVAILABLE   No free task pool control block.
+ * @retval #LOS_ERRNO_TSK_TCB_UNAVAILABLE    Not enough free task control blocks.
+ * @retval #LOS_ERRNO_TSK_NO_MEMORY          Not enough memory for the stacks.
+ * @retval #LOS_OK                           The pool is successfully created.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPoolSpawn | LOS_TaskPoolDelete
+ */
+extern UINT32 LOS_TaskPoolCreate(CHAR *name, UINT16 taskNum, UINT32 stackSize, UINT16 priority, UINT32 *poolID);
+
+/**
+ * @ingroup  los_task
+ * @brief Start a worker task from a task pool.
+ *
+ * @par Description:
+ * This API is used to start a task with a task control block and a stack of the pool, it is then scheduled as
+ * a task created by LOS_TaskCreate.
+ *
+ * @attention
+ * <ul>
+ * <li>Workers that finished are handed back to the pool by the idle task, or by this API when the pool has no
+ * idle task control block left.</li>
+ * </ul>
+ *
+ * @param  poolID    [IN] Type #UINT32 Pool ID.
+ * @param  entry     [IN] Type #TSK_ENTRY_FUNC Entry of the worker.
+ * @param  arg       [IN] Type #UINT32 Parameter of the worker.
+ * @param  taskID    [OUT] Type #UINT32 * ID of the started task.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID         The task ID pointer is NULL.
+ * @retval #LOS_ERRNO_TSK_ENTRY_NULL         The entry is NULL.
+ * @retval #LOS_ERRNO_TSK_POOL_ID_INVALID    Invalid pool ID.
+ * @retval #LOS_ERRNO_TSK_POOL_EMPTY         All workers of the pool are in use.
+ * @retval #LOS_OK                           The worker is successfully started.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPoolCreate
+ */
+extern UINT32 LOS_TaskPoolSpawn(UINT32 poolID, TSK_ENTRY_FUNC entry, UINT32 arg, UINT32 *taskID);
+
+/**
+ * @ingroup  los_task
+ * @brief Delete a task pool.
+ *
+ * @par Description:
+ * This API is used to give the task control blocks of the pool back to the system and free its stacks.
+ *
+ * @param  poolID    [IN] Type #UINT32 Pool ID.
+ *
+ * @retval #LOS_ERRNO_TSK_POOL_ID_INVALID    Invalid pool ID.
+ * @retval #LOS_ERRNO_TSK_POOL_BUSY          Workers of the pool still exist.
+ * @retval #LOS_OK                           The pool is successfully deleted.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPoolCreate
+ */
+extern UINT32 LOS_TaskPoolDelete(UINT32 poolID);
+#endif
+
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+/**
+ * @ingroup los_task
+ * Shortest time slice, in microseconds, that can be given to a task.
+ */
+#define LOS_TASK_TIMESLICE_MIN_US                   100
+
+/**
+ * @ingroup los_task
+ * Time slice length and counters of a task, see LOS_TaskTimeSliceStatGet.
+ */
+typedef struct {
+    UINT32 sliceUs;             /**< Time slice length */
+    UINT32 expired;             /**< Time slices the task used up, each one letting tasks of the same priority run */
+    UINT32 yields;              /**< Times the task gave up the rest of its slice with LOS_TaskYield */
+} LOS_TASK_SLICE_STAT_S;
+
+/**
+ * @ingroup  los_task
+ * @brief Set the time slice length of a task.
+ *
+ * @par Description:
+ * This API is used to let a task run longer, or shorter, than LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT before a ready
+ * task of the same priority gets the CPU. The length can also be set at creation with
+ * TSK_INIT_PARAM_S.timeSliceUs.
+ *
+ * @attention
+ * <ul>
+ * <li>A slice in progress that is longer than the new length is cut to it.</li>
+ * </ul>
+ *
+ * @param  taskID   [IN] Type #UINT32 Task ID. The task id value is obtained from task creation.
+ * @param  sliceUs  [IN] Type #UINT32 Time slice in microseconds, 0 for LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID         Invalid Task ID
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED        The task is not created.
+ * @retval #LOS_ERRNO_TSK_TIMESLICE_INVALID  The time slice is shorter than LOS_TASK_TIMESLICE_MIN_US.
+ * @retval #LOS_OK                           The time slice is successfully set.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskTimeSliceStatGet
+ */
+extern UINT32 LOS_TaskTimeSliceSet(UINT32 taskID, UINT32 sliceUs);
+
+/**
+ * @ingroup  los_task
+ * @brief Obtain the time slice length and counters of a task.
+ *
+ * @param  taskID   [IN] Type #UINT32 Task ID.
+ * @param  stat     [OUT] Type #LOS_TASK_SLICE_STAT_S * Time slice length and counters of the task.
+ *
+ * @retval #LOS_ERRNO_TSK_PTR_NULL           The statistics pointer is NULL.
+ * @retval #LOS_ERRNO_TSK_ID_INVALID         Invalid Task ID
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED        The task is not created.
+ * @retval #LOS_OK                           The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskTimeSliceSet
+ */
+extern UINT32 LOS_TaskTimeSliceStatGet(UINT32 taskID, LOS_TASK_SLICE_STAT_S *stat);
+#endif
+
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+/**
+ * @ingroup los_task
+ * Earliest-deadline-first parameters and statistics of a task, see LOS_TaskEdfStatGet.
+ */
+typedef struct {
+    UINT32 periodUs;            /**< Period, 0 if the task is scheduled by fixed priority */
+    UINT32 budgetUs;            /**< CPU time the task may use in each period */
+    UINT32 jobs;                /**< Jobs completed with LOS_TaskEdfWait */
+    UINT32 misses;              /**< Jobs completed after their deadline */
+    UINT32 throttles;           /**< Times the task was stopped until the end of its period for using up its budget */
+} LOS_TASK_EDF_STAT_S;
+
+/**
+ * @ingroup  los_task
+ * @brief Put a task in the earliest-deadline-first scheduling class.
+ *
+ * @par Description:
+ * This API is used to give a task a period and a budget. The task then runs above all fixed priority tasks, in
+ * the order of its absolute deadline, which is the end of its current period. When the task has used up the
+ * budget of a period it is throttled until the period ends, so that it cannot take more than its share of the CPU.
+ *
+ * @attention
+ * <ul>
+ * <li>The task is admitted only if the summed budget/period of all earliest-deadline-first tasks stays within
+ * LOSCFG_KERNEL_SCHED_EDF_UTIL_MAX percent.</li>
+ * <li>The first period starts when this API is called, and the statistics of the task are cleared. A throttled task
+ * is made ready at once.</li>
+ * <li>A period of 0 returns the task to its fixed priority, and the budget is ignored.</li>
+ * <li>Priority inheritance of mutexes does not apply to earliest-deadline-first tasks.</li>
+ * </ul>
+ *
+ * @param  taskID   [IN] Type #UINT32 Task ID. The task id value is obtained from task creation.
+ * @param  periodUs [IN] Type #UINT32 Period and relative deadline, in microseconds.
+ * @param  budgetUs [IN] Type #UINT32 CPU time allowed in each period, in microseconds.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID         Invalid Task ID
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED        The task is not created.
+ * @retval #LOS_ERRNO_TSK_OPERATE_SYSTEM_TASK The task is a system task.
+ * @retval #LOS_ERRNO_TSK_EDF_PARAM_INVALID  Invalid period or budget.
+ * @retval #LOS_ERRNO_TSK_EDF_OVERLOAD       The admission test failed.
+ * @retval #LOS_OK                           The scheduling class is successfully set.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskEdfWait | LOS_TaskEdfStatGet
+ */
+extern UINT32 LOS_TaskEdfSet(UINT32 taskID, UINT32 periodUs, UINT32 budgetUs);
+
+/**
+ * @ingroup  los_task
+ * @brief Complete the current job of an earliest-deadline-first task.
+ *
+ * @par Description:
+ * This API is used by a periodic task at the end of each job. The job counts as a miss if it completes after its
+ * deadline. The task then sleeps until the next period starts, or goes on at once with the next job if it is late.
+ *
+ * @attention
+ * <ul>
+ * <li>This API cannot be called in an interrupt or with the task scheduling locked.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_INT       Called in an interrupt.
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_LOCK      Called with the task scheduling locked.
+ * @retval #LOS_ERRNO_TSK_NOT_EDF            The current task is not an earliest-deadline-first task.
+ * @retval #LOS_OK                           The next job is released.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskEdfSet
+ */
+extern UINT32 LOS_TaskEdfWait(VOID);
+
+/**
+ * @ingroup  los_task
+ * @brief Obtain the earliest-deadline-first parameters and statistics of a task.
+ *
+ * @param  taskID   [IN] Type #UINT32 Task ID.
+ * @param  stat     [OUT] Type #LOS_TASK_EDF_STAT_S * Parameters and statistics of the task.
+ *
+ * @retval #LOS_ERRNO_TSK_PTR_NULL           The statistics pointer is NULL.
+ * @retval #LOS_ERRNO_TSK_ID_INVALID         Invalid Task ID
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED        The task is not created.
+ * @retval #LOS_OK                           The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskEdfSet
+ */
+extern UINT32 LOS_TaskEdfStatGet(UINT32 taskID, LOS_TASK_EDF_STAT_S *stat);
+#endif
+
 /**
  * @ingroup  los_task
  * @brief Set the priority of the current running task to a specified priority.
@@ -1203,7 +1596,7 @@ extern UINT32 LOS_TaskDetach(UINT32 taskID);
  *
  * Lowest task priority.
  */
-#define OS_TASK_PRIORITY_LOWEST                     31
+#define OS_TASK_PRIORITY_LOWEST                     (LOSCFG_BASE_CORE_TSK_PRIORITY_NUM - 1)
 
 /**
  * @ingroup los_task
@@ -1285,6 +1678,14 @@ extern UINT32 LOS_TaskDetach(UINT32 taskID);
  */
 #define OS_TASK_FLAG_STACK_FREE                     0x0800
 
+/**
+ * @ingroup los_task
+ * Flag that indicates the task or task control block status.
+ *
+ * The task gave up the processor through LOS_TaskYield.
+ */
+#define OS_TASK_FLAG_YIELD                          0x0400
+
 /**
  * @ingroup los_task
  * Flag that indicates the task property.
@@ -1458,6 +1859,38 @@ extern UINT32 LOS_TaskDetach(UINT32 taskID);
 #define OS_IDLE_TASK_ENTRY                              ((TSK_ENTRY_FUNC)OsIdleTask)
 
 
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+/**
+ * @ingroup los_task
+ * Ready-to-run latency statistics of a task, see LOS_SchedLatencyGet.
+ */
+typedef struct {
+    UINT32 count;               /**< Number of times the task was switched in after being made ready */
+    UINT32 maxCycles;           /**< Longest time between being made ready and running */
+    UINT64 totalCycles;         /**< Sum of the latencies */
+    UINT32 blockerID;           /**< Task that was running until the longest latency ended */
+} LOS_SCHED_LATENCY_S;
+#endif
+
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+/**
+ * @ingroup los_task
+ * Earliest-deadline-first state of a task, times are in cycles.
+ */
+typedef struct {
+    SortLinkList                readyList;                /**< Node in the deadline ordered ready list */
+    UINT64                      period;                   /**< Period, 0 if the task is scheduled by priority */
+    UINT64                      deadline;                 /**< End of the current period, when the budget is
+                                                               replenished */
+    UINT64                      jobDeadline;              /**< Deadline of the job in progress */
+    INT32                       budget;
+    INT32                       budgetLeft;               /**< Budget left in the current period */
+    UINT32                      util;                     /**< Admitted budget/period, in millionths */
+    BOOL                        throttled;                /**< Delayed only until the budget is replenished */
+    LOS_TASK_EDF_STAT_S         stat;
+} SchedEdfCB;
+#endif
+
 /**
  * @ingroup los_task
  * Define the task control block structure.
@@ -1467,7 +1900,12 @@ typedef struct {
     UINT16                      taskStatus;
     UINT16                      priority;
     INT32                       timeSlice;
-    UINT32                      waitTimes;
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+    INT32                       sliceLen;                 /**< Time slice length in cycles */
+    UINT32                      sliceExpired;             /**< Time slices used up */
+    UINT32                      sliceYields;              /**< Time slices given up by yielding */
+#endif
+    UINT64                      waitTimes;                /**< Wait time in cycles */
     SortLinkList                sortList;
     UINT64                      startTime;
     UINT32                      stackSize;                /**< Task stack size */
@@ -1489,6 +1927,22 @@ typedef struct {
     INT32                       errorNo;
 #if (LOSCFG_KERNEL_SIGNAL == 1)
     VOID                        *sig;                     /**< Task signal */
+#endif
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+    UINT32                      stackLowest;              /**< Lowest stack pointer seen at context switches */
+    UINT32                      stackWarnMark;            /**< Stack pointer below which the usage warning is
+                                                               reported, 0 once reported */
+#endif
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+    UINT64                      readyTime;                /**< Time the task was made ready, 0 if not stamped */
+    LOS_SCHED_LATENCY_S         latency;
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    SchedEdfCB                  edf;
+#endif
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+    UINT16                      poolIndex;                /**< Task pool owning the task control block plus one,
+                                                               0 if none */
 #endif
     LOSCFG_TASK_STRUCT_EXTENSION                          /**< Task extension field */
 } LosTaskCB;
@@ -1718,6 +2172,24 @@ extern VOID OsTaskEntry(UINT32 taskID);
  */
 extern UINT32 OsGetTaskWaterLine(UINT32 taskID);
 
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+extern VOID OsTaskStackWarn(LosTaskCB *taskCB);
+
+/*
+ * Called with interrupts masked. The scheduler passes the stack pointer saved at the last switch out of the task
+ * it switches in, so each sample costs one compare.
+ */
+STATIC INLINE VOID OsTaskStackTrack(LosTaskCB *taskCB, UINT32 stackPointer)
+{
+    if (stackPointer < taskCB->stackLowest) {
+        taskCB->stackLowest = stackPointer;
+        if (stackPointer < taskCB->stackWarnMark) {
+            OsTaskStackWarn(taskCB);
+        }
+    }
+}
+#endif
+
 /**
  * @ingroup  los_task
  * @brief Convert task status to string.
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @defgroup los_workqueue Work queue
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_WORKQUEUE_H
+#define _LOS_WORKQUEUE_H
+
+#include "los_config.h"
+#include "los_list.h"
+#include "los_sortlink.h"
+#include "los_event.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The passed-in pointer is NULL.
+ *
+ * Value: 0x02002200
+ *
+ * Solution: Check whether the passed-in pointer is valid.
+ */
+#define LOS_ERRNO_WORKQUEUE_PTR_NULL                 LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x00)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: Invalid work queue ID.
+ *
+ * Value: 0x02002201
+ *
+ * Solution: Check whether the passed-in work queue ID is valid.
+ */
+#define LOS_ERRNO_WORKQUEUE_ID_INVALID               LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x01)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The work queue is not created.
+ *
+ * Value: 0x02002202
+ *
+ * Solution: Create the work queue before using it.
+ */
+#define LOS_ERRNO_WORKQUEUE_NOT_CREATED              LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x02)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: No free work queue is available.
+ *
+ * Value: 0x02002203
+ *
+ * Solution: Delete unused work queues or increase LOSCFG_BASE_CORE_WORKQUEUE_LIMIT.
+ */
+#define LOS_ERRNO_WORKQUEUE_UNAVAILABLE              LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x03)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The work is pending on another work queue.
+ *
+ * Value: 0x02002204
+ *
+ * Solution: Cancel the work before submitting it to another work queue.
+ */
+#define LOS_ERRNO_WORKQUEUE_WORK_BUSY                LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x04)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The work to be cancelled is not pending.
+ *
+ * Value: 0x02002205
+ *
+ * Solution: The work has already run or was never submitted, nothing needs to be done.
+ */
+#define LOS_ERRNO_WORKQUEUE_WORK_NOT_PENDING         LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x05)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The API is called in the interrupt context.
+ *
+ * Value: 0x02002206
+ *
+ * Solution: Create and delete work queues in the task context.
+ */
+#define LOS_ERRNO_WORKQUEUE_IN_INTERRUPT             LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x06)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: No threaded interrupt is available.
+ *
+ * Value: 0x02002207
+ *
+ * Solution: Increase LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT.
+ */
+#define LOS_ERRNO_WORKQUEUE_HWI_UNAVAILABLE          LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x07)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: Threaded interrupts are not supported.
+ *
+ * Value: 0x02002208
+ *
+ * Solution: Enable LOSCFG_PLATFORM_HWI_WITH_ARG, the threaded handler is located through the interrupt argument.
+ */
+#define LOS_ERRNO_WORKQUEUE_HWI_UNSUPPORTED          LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x08)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: A threaded interrupt was requested together with LOS_HWI_MODE_DIRECT.
+ *
+ * Value: 0x02002209
+ *
+ * Solution: Use either a threaded or a direct handler, a direct handler is entered from the vector table.
+ */
+#define LOS_ERRNO_WORKQUEUE_HWI_MODE_INVALID         LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x09)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: A threaded interrupt is deleted while the task scheduling is locked.
+ *
+ * Value: 0x0200220a
+ *
+ * Solution: Unlock the task scheduling, the deletion may have to wait for the running threaded handler.
+ */
+#define LOS_ERRNO_WORKQUEUE_PEND_IN_LOCK             LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQUEUE, 0x0a)
+
+/**
+ * @ingroup los_workqueue
+ * Define the type of a work handler function.
+ */
+typedef VOID (*WORK_PROC_FUNC)(VOID *arg);
+
+/**
+ * @ingroup los_workqueue
+ * Work states
+ */
+enum {
+    OS_WORK_IDLE,       /**< Not submitted, or already taken by the work queue task */
+    OS_WORK_PENDING,    /**< Waiting on the pending list of a work queue */
+    OS_WORK_DELAYED,    /**< Waiting on the work sort link for its delay to expire */
+};
+
+/**
+ * @ingroup los_workqueue
+ * Work item. The memory is owned by the caller and must stay valid while the work is pending.
+ */
+typedef struct {
+    LOS_DL_LIST     pendList;       /**< Node on the pending list of the work queue */
+    SortLinkList    sortList;       /**< Node on the work sort link while delayed */
+    WORK_PROC_FUNC  handler;        /**< Work handler */
+    VOID            *arg;           /**< Parameter passed to the handler */
+    UINT64          queueTime;      /**< Cycle at which the work became runnable */
+    UINT16          queueID;        /**< Work queue the work is pending on */
+    UINT16          state;          /**< OS_WORK_IDLE, OS_WORK_PENDING or OS_WORK_DELAYED */
+} LOS_WORK_S;
+
+/**
+ * @ingroup los_workqueue
+ * Work queue statistics
+ */
+typedef struct {
+    UINT32 executed;        /**< Works run by the work queue */
+    UINT32 pendingMax;      /**< Largest number of works waiting at once */
+    UINT32 latencyMaxUs;    /**< Longest time between a work becoming runnable and starting to run */
+    UINT64 latencySumUs;    /**< Sum of the latencies of all executed works */
+} LOS_WORKQUEUE_STAT_S;
+
+/**
+ * @ingroup los_workqueue
+ * @brief Create a work queue.
+ *
+ * @par Description:
+ * This API is used to create a work queue, served by a task of the given priority which runs the submitted works
+ * one by one in submission order.
+ * @attention
+ * <ul>
+ * <li>At most LOSCFG_BASE_CORE_WORKQUEUE_LIMIT work queues can be created.</li>
+ * </ul>
+ *
+ * @param  name         [IN] Name of the work queue task.
+ * @param  priority     [IN] Priority of the work queue task.
+ * @param  stackSize    [IN] Stack size of the work queue task.
+ * @param  queueID      [OUT] Work queue ID.
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_PTR_NULL          The passed-in queueID is NULL.
+ * @retval #LOS_ERRNO_WORKQUEUE_IN_INTERRUPT      The API is called in the interrupt context.
+ * @retval #LOS_ERRNO_WORKQUEUE_UNAVAILABLE       No free work queue is available.
+ * @retval Others                                 The error code of creating the work queue task.
+ * @retval #LOS_OK                                The work queue is successfully created.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkQueueDelete
+ */
+extern UINT32 LOS_WorkQueueCreate(const CHAR *name, UINT16 priority, UINT32 stackSize, UINT32 *queueID);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Delete a work queue.
+ *
+ * @par Description:
+ * This API is used to delete a work queue. Works still pending or delayed are dropped and become idle, a running
+ * work is allowed to finish before the work queue task exits.
+ *
+ * @param  queueID      [IN] Work queue ID.
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_IN_INTERRUPT      The API is called in the interrupt context.
+ * @retval #LOS_ERRNO_WORKQUEUE_ID_INVALID        Invalid work queue ID.
+ * @retval #LOS_ERRNO_WORKQUEUE_NOT_CREATED       The work queue is not created.
+ * @retval #LOS_OK                                The work queue is successfully deleted.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkQueueCreate
+ */
+extern UINT32 LOS_WorkQueueDelete(UINT32 queueID);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Initialize a work.
+ *
+ * @par Description:
+ * This API is used to initialize a work before it is submitted for the first time.
+ *
+ * @param  work         [IN] Work to be initialized.
+ * @param  handler      [IN] Work handler.
+ * @param  arg          [IN] Parameter passed to the handler.
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_PTR_NULL          The work or the handler is NULL.
+ * @retval #LOS_OK                                The work is successfully initialized.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkSubmit
+ */
+extern UINT32 LOS_WorkInit(LOS_WORK_S *work, WORK_PROC_FUNC handler, VOID *arg);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Submit a work.
+ *
+ * @par Description:
+ * This API is used to queue a work on a work queue. It can be called in the interrupt context.
+ * @attention
+ * <ul>
+ * <li>Submitting a work that is already pending on the same work queue does nothing, the work runs once.</li>
+ * <li>Submitting a delayed work makes it runnable immediately.</li>
+ * </ul>
+ *
+ * @param  queueID      [IN] Work queue ID.
+ * @param  work         [IN] Initialized work.
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_PTR_NULL          The work is NULL.
+ * @retval #LOS_ERRNO_WORKQUEUE_ID_INVALID        Invalid work queue ID.
+ * @retval #LOS_ERRNO_WORKQUEUE_NOT_CREATED       The work queue is not created.
+ * @retval #LOS_ERRNO_WORKQUEUE_WORK_BUSY         The work is pending on another work queue.
+ * @retval #LOS_OK                                The work is successfully submitted.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkSubmitDelayed | LOS_WorkCancel
+ */
+extern UINT32 LOS_WorkSubmit(UINT32 queueID, LOS_WORK_S *work);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Submit a work after a delay.
+ *
+ * @par Description:
+ * This API is used to queue a work on a work queue once the delay has expired. It can be called in the interrupt
+ * context.
+ * @attention
+ * <ul>
+ * <li>Submitting a work that is already pending or delayed on the same work queue does nothing.</li>
+ * <li>A delay of 0 is the same as LOS_WorkSubmit.</li>
+ * </ul>
+ *
+ * @param  queueID      [IN] Work queue ID.
+ * @param  work         [IN] Initialized work.
+ * @param  delayTicks   [IN] Delay, in ticks.
+ *
+ * @retval Same as LOS_WorkSubmit.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkSubmit | LOS_WorkCancel
+ */
+extern UINT32 LOS_WorkSubmitDelayed(UINT32 queueID, LOS_WORK_S *work, UINT32 delayTicks);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Cancel a work.
+ *
+ * @par Description:
+ * This API is used to remove a pending or delayed work from its work queue. It can be called in the interrupt
+ * context. A work that has already started running is not waited for.
+ *
+ * @param  work         [IN] Work to be cancelled.
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_PTR_NULL          The work is NULL.
+ * @retval #LOS_ERRNO_WORKQUEUE_WORK_NOT_PENDING  The work is neither pending nor delayed.
+ * @retval #LOS_OK                                The work is successfully cancelled.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkSubmit
+ */
+extern UINT32 LOS_WorkCancel(LOS_WORK_S *work);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Obtain the statistics of a work queue.
+ *
+ * @par Description:
+ * This API is used to obtain how many works a work queue has run and how long they waited before running.
+ *
+ * @param  queueID      [IN] Work queue ID.
+ * @param  stat         [OUT] Statistics of the work queue.
+ *
+ * @retval #LOS_ERRNO_WORKQUEUE_PTR_NULL          The stat is NULL.
+ * @retval #LOS_ERRNO_WORKQUEUE_ID_INVALID        Invalid work queue ID.
+ * @retval #LOS_ERRNO_WORKQUEUE_NOT_CREATED       The work queue is not created.
+ * @retval #LOS_OK                                The statistics are successfully obtained.
+ * @par Dependency:
+ * <ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_WorkQueueCreate
+ */
+extern UINT32 LOS_WorkQueueStatGet(UINT32 queueID, LOS_WORKQUEUE_STAT_S *stat);
+
+/**
+ * @ingroup los_workqueue
+ * @brief Initialize the work queue module.
+ */
+extern UINT32 OsWorkQueueInit(VOID);
+
+#endif /* LOSCFG_BASE_CORE_WORKQUEUE */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_WORKQUEUE_H */
@@ -109,7 +109,7 @@ LITE_OS_SEC_TEXT STATIC_INLINE UINT32 OsEventReadParamCheck(PEVENT_CB_S eventCB,
     return LOS_OK;
 }
 
-LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UINT32 mode, UINT32 timeOut)
+STATIC UINT32 OsEventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UINT32 mode, UINT64 timeOut, UINT32 tick)
 {
     UINT32 ret;
     UINT32 intSave;
@@ -130,7 +130,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UIN
     }
     intSave = LOS_IntLock();
     ret = LOS_EventPoll(&(eventCB->uwEventID), eventMask, mode);
-    OsHookCall(LOS_HOOK_TYPE_EVENT_READ, eventCB, eventMask, mode, timeOut);
+    OsHookCall(LOS_HOOK_TYPE_EVENT_READ, eventCB, eventMask, mode, tick);
     // ret == 0,表示事件没有发生，需要等待
     if (ret == 0) {
         // 不等待，直接返回
@@ -148,7 +148,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UIN
         runTsk->eventMode = mode;
 
         // 加入等待列表
-        OsSchedTaskWait(&eventCB->stEventList, timeOut);
+        OsSchedTaskWaitCycle(&eventCB->stEventList, timeOut);
         LOS_IntRestore(intSave);
         LOS_Schedule();
 
@@ -168,6 +168,18 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UIN
     return ret;
 }
 
+LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S eventCB, UINT32 eventMask, UINT32 mode, UINT32 timeOut)
+{
+    return OsEventRead(eventCB, eventMask, mode, OsSchedTickToWaitCycle(timeOut), timeOut);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_EventReadNs(PEVENT_CB_S eventCB, UINT32 eventMask, UINT32 mode, UINT64 timeOutNs)
+{
+    UINT64 timeOut = OsSchedNsToWaitCycle(timeOutNs);
+
+    return OsEventRead(eventCB, eventMask, mode, timeOut, OsSchedWaitCycleToTick(timeOut));
+}
+
 LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S eventCB, UINT32 events)
 {
     LosTaskCB *resumedTask = NULL;
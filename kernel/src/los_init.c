@@ -46,6 +46,10 @@
 #include "los_swtmr.h"
 #endif
 
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+#include "los_workqueue.h"
+#endif
+
 #if (LOSCFG_BASE_CORE_CPUP == 1)
 #include "los_cpup.h"
 #endif
@@ -74,6 +78,10 @@
 #include "los_lmk.h"
 #endif
 
+#if (LOSCFG_KERNEL_IRQSTAT == 1)
+#include "los_irqstat.h"
+#endif
+
 #if (LOSCFG_POSIX_PIPE_API == 1)
 #include "pipe_impl.h"
 #endif
@@ -82,6 +90,17 @@
 #include "los_signal.h"
 #endif
 
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+#include "los_hook.h"
+#endif
+
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+#include "string.h"
+#include "securec.h"
+#include "los_init.h"
+#include "los_event.h"
+#endif
+
 /*****************************************************************************
  Function    : LOS_Reboot
  Description : system exception, die in here, wait for watchdog.
@@ -122,8 +141,265 @@ LITE_OS_SEC_TEXT_INIT static VOID OsRegister(VOID)
     return;
 }
 
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+STATIC LOS_BOOT_STAGE_INFO g_bootStage[LOSCFG_KERNEL_BOOT_PROFILE_STAGE_NUM];
+STATIC UINT32 g_bootStageNum = 0;
+STATIC BOOL g_bootCycleValid = FALSE;
+
+#define OS_BOOT_STAGE_RECORD(name)  LOS_BootStageRecord(name)
+
+STATIC UINT32 OsBootHeapUsedGet(VOID)
+{
+    LOS_MEM_POOL_STATUS status;
+
+    if ((m_aucSysMem0 == NULL) || (LOS_MemInfoGet(m_aucSysMem0, &status) != LOS_OK)) {
+        return 0;
+    }
+    return status.totalUsedSize;
+}
+
+VOID LOS_BootStageRecord(const CHAR *name)
+{
+    LOS_BOOT_STAGE_INFO *stage = NULL;
+    UINT64 prevCycle = 0;
+    UINT32 prevHeapUsed = 0;
+    UINT64 cycle = g_bootCycleValid ? LOS_SysCycleGet() : 0;
+    UINT32 heapUsed = OsBootHeapUsedGet();
+    UINT32 index;
+    UINT32 intSave;
+
+    intSave = LOS_IntLock();
+    index = g_bootStageNum;
+    if (index >= LOSCFG_KERNEL_BOOT_PROFILE_STAGE_NUM) {
+        LOS_IntRestore(intSave);
+        return;
+    }
+    if (index > 0) {
+        prevCycle = g_bootStage[index - 1].endCycle;
+        prevHeapUsed = g_bootStage[index - 1].heapUsed;
+    }
+    stage = &g_bootStage[index];
+    stage->name = name;
+    stage->endCycle = cycle;
+    stage->cycles = (cycle > prevCycle) ? (UINT32)(cycle - prevCycle) : 0;
+    stage->heapUsed = heapUsed;
+    stage->heapDelta = (INT32)(heapUsed - prevHeapUsed);
+    g_bootStageNum++;
+    LOS_IntRestore(intSave);
+
+    OsHookCall(LOS_HOOK_TYPE_BOOT_STAGE, index, stage->cycles, heapUsed);
+}
+
+UINT32 LOS_BootStageInfoGet(UINT32 index, LOS_BOOT_STAGE_INFO *info)
+{
+    UINT32 intSave;
+
+    if (info == NULL) {
+        return LOS_NOK;
+    }
+
+    intSave = LOS_IntLock();
+    if (index >= g_bootStageNum) {
+        LOS_IntRestore(intSave);
+        return LOS_NOK;
+    }
+    *info = g_bootStage[index];
+    LOS_IntRestore(intSave);
+
+    return LOS_OK;
+}
+
+VOID LOS_BootStageShow(VOID)
+{
+    LOS_BOOT_STAGE_INFO info;
+    UINT32 index;
+
+    PRINTK("\r\n   stage            cycles          us    heapDelta     heapUsed\n");
+    PRINTK("   ----             ------          --    ---------     --------\n");
+    for (index = 0; LOS_BootStageInfoGet(index, &info) == LOS_OK; index++) {
+        PRINTK("   %-12s %10u  %10u  %11d   0x%-8x\n", info.name, info.cycles,
+               (g_sysClock == 0) ? 0 : (UINT32)(((UINT64)info.cycles * OS_SYS_US_PER_SECOND) / g_sysClock),
+               info.heapDelta, info.heapUsed);
+    }
+}
+#else
+#define OS_BOOT_STAGE_RECORD(name)
+#endif
+
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+#define OS_MODULE_INIT_DEFERRED_DONE    0x1U
+
+extern const LOS_INIT_ENTRY __start_los_init_table[] WEAK;
+extern const LOS_INIT_ENTRY __stop_los_init_table[] WEAK;
+
+STATIC UINT8 *g_moduleInitState = NULL;
+STATIC UINT32 g_moduleInitNum = 0;
+STATIC EVENT_CB_S g_moduleInitEvent;
+
+STATIC INT32 OsModuleIndexGet(const CHAR *name)
+{
+    UINT32 index;
+
+    for (index = 0; index < g_moduleInitNum; index++) {
+        if (strcmp(__start_los_init_table[index].name, name) == 0) {
+            return (INT32)index;
+        }
+    }
+    return -1;
+}
+
+STATIC UINT32 OsModuleDependsStateGet(const LOS_INIT_ENTRY *entry)
+{
+    const CHAR *const *depends = entry->depends;
+    const LOS_INIT_ENTRY *depEntry = NULL;
+    INT32 index;
+
+    if (depends == NULL) {
+        return LOS_INIT_STATE_DONE;
+    }
+
+    for (; *depends != NULL; depends++) {
+        index = OsModuleIndexGet(*depends);
+        if (index < 0) {
+            PRINT_ERR("module %s depends on unregistered module %s\n", entry->name, *depends);
+            return LOS_INIT_STATE_FAILED;
+        }
+        depEntry = &__start_los_init_table[index];
+        if ((depEntry->level > entry->level) ||
+            ((depEntry->flags & LOS_INIT_DEFERRED) && !(entry->flags & LOS_INIT_DEFERRED))) {
+            PRINT_ERR("module %s can not depend on module %s\n", entry->name, *depends);
+            return LOS_INIT_STATE_FAILED;
+        }
+        if (g_moduleInitState[index] != LOS_INIT_STATE_DONE) {
+            return g_moduleInitState[index];
+        }
+    }
+    return LOS_INIT_STATE_DONE;
+}
+
+/* Run the modules of one level, retrying until no more dependency can be satisfied. */
+STATIC VOID OsModuleInitLevel(UINT16 level, UINT16 deferred)
+{
+    const LOS_INIT_ENTRY *entry = NULL;
+    BOOL progress;
+    UINT32 state;
+    UINT32 index;
+
+    do {
+        progress = FALSE;
+        for (index = 0; index < g_moduleInitNum; index++) {
+            entry = &__start_los_init_table[index];
+            if ((entry->level != level) || ((entry->flags & LOS_INIT_DEFERRED) != deferred) ||
+                (g_moduleInitState[index] != LOS_INIT_STATE_PENDING)) {
+                continue;
+            }
+            state = OsModuleDependsStateGet(entry);
+            if (state == LOS_INIT_STATE_PENDING) {
+                continue;
+            }
+            if ((state == LOS_INIT_STATE_DONE) && (entry->hook() != LOS_OK)) {
+                PRINT_ERR("module %s init failed\n", entry->name);
+                state = LOS_INIT_STATE_FAILED;
+            }
+            g_moduleInitState[index] = (UINT8)state;
+            OS_BOOT_STAGE_RECORD(entry->name);
+            progress = TRUE;
+        }
+    } while (progress);
+
+    for (index = 0; index < g_moduleInitNum; index++) {
+        entry = &__start_los_init_table[index];
+        if ((entry->level == level) && ((entry->flags & LOS_INIT_DEFERRED) == deferred) &&
+            (g_moduleInitState[index] == LOS_INIT_STATE_PENDING)) {
+            PRINT_ERR("module %s has circular dependencies\n", entry->name);
+            g_moduleInitState[index] = LOS_INIT_STATE_FAILED;
+        }
+    }
+}
+
+STATIC VOID OsModuleInitRun(UINT16 deferred)
+{
+    UINT16 level;
+
+    for (level = 0; level < LOS_INIT_LEVEL_NUM; level++) {
+        OsModuleInitLevel(level, deferred);
+    }
+}
+
+STATIC VOID OsModuleInitTask(VOID)
+{
+    OsModuleInitRun(LOS_INIT_DEFERRED);
+    (VOID)LOS_EventWrite(&g_moduleInitEvent, OS_MODULE_INIT_DEFERRED_DONE);
+}
+
+STATIC UINT32 OsModuleInit(VOID)
+{
+    TSK_INIT_PARAM_S initTask;
+    UINT32 taskID;
+    UINT32 index;
+    UINT32 ret;
+
+    ret = LOS_EventInit(&g_moduleInitEvent);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    if (__start_los_init_table == NULL) {
+        return LOS_EventWrite(&g_moduleInitEvent, OS_MODULE_INIT_DEFERRED_DONE);
+    }
+    g_moduleInitNum = (UINT32)(__stop_los_init_table - __start_los_init_table);
+    g_moduleInitState = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, g_moduleInitNum);
+    if (g_moduleInitState == NULL) {
+        g_moduleInitNum = 0;
+        return LOS_NOK;
+    }
+    (VOID)memset_s(g_moduleInitState, g_moduleInitNum, LOS_INIT_STATE_PENDING, g_moduleInitNum);
+
+    OsModuleInitRun(0);
+
+    for (index = 0; index < g_moduleInitNum; index++) {
+        if (__start_los_init_table[index].flags & LOS_INIT_DEFERRED) {
+            break;
+        }
+    }
+    if (index == g_moduleInitNum) {
+        return LOS_EventWrite(&g_moduleInitEvent, OS_MODULE_INIT_DEFERRED_DONE);
+    }
+
+    (VOID)memset_s(&initTask, sizeof(TSK_INIT_PARAM_S), 0, sizeof(TSK_INIT_PARAM_S));
+    initTask.pfnTaskEntry = (TSK_ENTRY_FUNC)OsModuleInitTask;
+    initTask.uwStackSize  = LOSCFG_KERNEL_MODULE_INIT_STACK_SIZE;
+    initTask.pcName       = "ModuleInit";
+    initTask.usTaskPrio   = LOSCFG_KERNEL_MODULE_INIT_TASK_PRIO;
+    return LOS_TaskCreate(&taskID, &initTask);
+}
+
+UINT32 LOS_ModuleInitStateGet(const CHAR *name, UINT32 *state)
+{
+    INT32 index;
+
+    if ((name == NULL) || (state == NULL)) {
+        return LOS_NOK;
+    }
+
+    index = OsModuleIndexGet(name);
+    if (index < 0) {
+        return LOS_NOK;
+    }
+    *state = g_moduleInitState[index];
+    return LOS_OK;
+}
+
+UINT32 LOS_ModuleInitWait(UINT32 timeout)
+{
+    UINT32 ret = LOS_EventRead(&g_moduleInitEvent, OS_MODULE_INIT_DEFERRED_DONE, LOS_WAITMODE_AND, timeout);
+    return (ret == OS_MODULE_INIT_DEFERRED_DONE) ? LOS_OK : LOS_NOK;
+}
+#endif
+
 LITE_OS_SEC_TEXT_INIT UINT32 LOS_Start(VOID)
 {
+    OS_BOOT_STAGE_RECORD("start");
     return ArchStartSchedule();
 }
 
@@ -154,9 +430,11 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsMemSystemInit error %d\n", ret);
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("mem");
 
     // 中断初始化
     ArchInit();
+    OS_BOOT_STAGE_RECORD("arch");
 
     // 硬件时钟初始化，时钟中断函数绑定
     ret = OsTickTimerInit();
@@ -164,6 +442,10 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsTickTimerInit error! 0x%x\n", ret);
         return ret;
     }
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+    g_bootCycleValid = TRUE;
+#endif
+    OS_BOOT_STAGE_RECORD("tick");
 
     // task相关结构初始化
     ret = OsTaskInit();
@@ -171,6 +453,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsTaskInit error\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("task");
 
 #if (LOSCFG_BASE_CORE_TSK_MONITOR == 1)
     OsTaskMonInit();
@@ -182,6 +465,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsCpupInit error\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("cpup");
 #endif
 
 #if (LOSCFG_BASE_IPC_SEM == 1)
@@ -189,6 +473,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
     if (ret != LOS_OK) {
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("sem");
 #endif
 
 #if (LOSCFG_BASE_IPC_MUX == 1)
@@ -196,6 +481,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
     if (ret != LOS_OK) {
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("mux");
 #endif
 
 #if (LOSCFG_BASE_IPC_QUEUE == 1)
@@ -204,6 +490,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsQueueInit error\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("queue");
 #endif
 
 #if (LOSCFG_BASE_CORE_SWTMR == 1)
@@ -213,12 +500,23 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsSwtmrInit error\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("swtmr");
+#endif
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+    ret = OsWorkQueueInit();
+    if (ret != LOS_OK) {
+        PRINT_ERR("OsWorkQueueInit error\n");
+        return ret;
+    }
+    OS_BOOT_STAGE_RECORD("workqueue");
 #endif
     // 创建Idle task
     ret = OsIdleTaskCreate();
     if (ret != LOS_OK) {
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("idle");
 
 #if (LOSCFG_KERNEL_TRACE == 1)
     ret = OsTraceInit(LOSCFG_TRACE_BUFFER_SIZE);
@@ -226,6 +524,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("OsTraceInit error\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("trace");
 #endif
 
 #if (LOSCFG_KERNEL_PM == 1)
@@ -234,21 +533,32 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("Pm init failed!\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("pm");
 #endif
 
 #if (LOSCFG_KERNEL_LMK == 1)
     OsLmkInit();
 #endif
 
+#if (LOSCFG_KERNEL_IRQSTAT == 1)
+    ret = OsIrqStatInit();
+    if (ret != LOS_OK) {
+        PRINT_ERR("OsIrqStatInit error\n");
+        return ret;
+    }
+    OS_BOOT_STAGE_RECORD("irqstat");
+#endif
+
 #if (LOSCFG_PLATFORM_EXC == 1)
     OsExcMsgDumpInit();
 #endif
 
-#if (LOSCFG_DYNLINK == 1)
+#if (LOSCFG_DYNLINK == 1) && (LOSCFG_KERNEL_MODULE_INIT == 0)
     ret = LOS_DynlinkInit();
     if (ret != LOS_OK) {
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("dynlink");
 #endif
 
 #if (LOSCFG_POSIX_PIPE_API == 1)
@@ -257,6 +567,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("Pipe init failed!\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("pipe");
 #endif
 
 #if (LOSCFG_KERNEL_SIGNAL == 1)
@@ -265,6 +576,15 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_KernelInit(VOID)
         PRINT_ERR("Signal init failed!\n");
         return ret;
     }
+    OS_BOOT_STAGE_RECORD("signal");
+#endif
+
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+    ret = OsModuleInit();
+    if (ret != LOS_OK) {
+        PRINT_ERR("Module init failed!\n");
+        return ret;
+    }
 #endif
 
     return LOS_OK;
@@ -42,6 +42,9 @@
 
 LITE_OS_SEC_BSS       LosMuxCB*   g_allMux = NULL;
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST g_unusedMuxList;
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+LITE_OS_SEC_BSS_KERNEL_CB STATIC LosMuxCB g_muxCBTable[LOSCFG_BASE_IPC_MUX_LIMIT];
+#endif
 
 /*****************************************************************************
  Function      : OsMuxInit
@@ -62,11 +65,15 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsMuxInit(VOID)
         return LOS_ERRNO_MUX_MAXNUM_ZERO;
     }
 
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+    g_allMux = g_muxCBTable;
+#else
     // 从动态内存中申请空间，共10个mutex
     g_allMux = (LosMuxCB *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_MUX_LIMIT * sizeof(LosMuxCB)));
     if (g_allMux == NULL) {
         return LOS_ERRNO_MUX_NO_MEMORY;
     }
+#endif
 
     // 初始化，并使用尾插法插入g_unusedMuxList链表
     for (index = 0; index < LOSCFG_BASE_IPC_MUX_LIMIT; index++) {
@@ -206,14 +213,15 @@ STATIC_INLINE UINT32 OsMuxValidCheck(LosMuxCB *muxPended)
 }
 
 /*****************************************************************************
- Function     : LOS_MuxPend
+ Function     : OsMuxPend
  Description  : Specify the mutex P operation
  Input        : muxHandle ------ Mutex operation handleone
-              : timeOut   ------- waiting time
+              : timeOut   ------- waiting time in cycles
+              : tick      ------- waiting time in ticks, reported to the hooks
  Output       : None
  Return       : LOS_OK on success, or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout)
+STATIC UINT32 OsMuxPend(UINT32 muxHandle, UINT64 timeout, UINT32 tick)
 {
     UINT32 intSave;
     LosMuxCB *muxPended = NULL;
@@ -267,10 +275,10 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout)
     }
 
     // 将runTask加入muxPended等待队列
-    OsSchedTaskWait(&muxPended->muxList, timeout);
+    OsSchedTaskWaitCycle(&muxPended->muxList, timeout);
 
     LOS_IntRestore(intSave);
-    OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, timeout);
+    OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, tick);
     // 调度
     LOS_Schedule();
 
@@ -285,7 +293,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout)
     return LOS_OK;
 
 HOOK:
-    OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, timeout);
+    OsHookCall(LOS_HOOK_TYPE_MUX_PEND, muxPended, tick);
     return LOS_OK;
 
 ERROR_MUX_PEND:
@@ -293,6 +301,18 @@ ERROR_MUX_PEND:
     OS_RETURN_ERROR(retErr);
 }
 
+LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 muxHandle, UINT32 timeout)
+{
+    return OsMuxPend(muxHandle, OsSchedTickToWaitCycle(timeout), timeout);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_MuxPendNs(UINT32 muxHandle, UINT64 timeoutNs)
+{
+    UINT64 timeout = OsSchedNsToWaitCycle(timeoutNs);
+
+    return OsMuxPend(muxHandle, timeout, OsSchedWaitCycleToTick(timeout));
+}
+
 /*****************************************************************************
  Function     : LOS_MuxPost
  Description  : Specify the mutex V operation,
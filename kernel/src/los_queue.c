@@ -46,6 +46,9 @@
 
 LITE_OS_SEC_BSS LosQueueCB *g_allQueue = NULL ;
 LITE_OS_SEC_BSS LOS_DL_LIST g_freeQueueList;
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+LITE_OS_SEC_BSS_KERNEL_CB STATIC LosQueueCB g_queueCBTable[LOSCFG_BASE_IPC_QUEUE_LIMIT];
+#endif
 
 /**************************************************************************
  Function    : OsQueueInit
@@ -63,6 +66,10 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsQueueInit(VOID)
         return LOS_ERRNO_QUEUE_MAXNUM_ZERO;
     }
 
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+    /* The static table is zeroed by the startup code. */
+    g_allQueue = g_queueCBTable;
+#else
     // 初始化队列，共有6个Queue CB
     g_allQueue = (LosQueueCB *)LOS_MemAlloc(m_aucSysMem0, LOSCFG_BASE_IPC_QUEUE_LIMIT * sizeof(LosQueueCB));
     if (g_allQueue == NULL) {
@@ -72,6 +79,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsQueueInit(VOID)
     // 初始化为0值
     (VOID)memset_s(g_allQueue, LOSCFG_BASE_IPC_QUEUE_LIMIT * sizeof(LosQueueCB),
                    0, LOSCFG_BASE_IPC_QUEUE_LIMIT * sizeof(LosQueueCB));
+#endif
 
     // 使用g_freeQueueList作为头结点管理所有队列，index为[0:5]
     LOS_ListInit(&g_freeQueueList);
@@ -84,31 +92,8 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsQueueInit(VOID)
     return LOS_OK;
 }
 
-/*****************************************************************************
- Function    : LOS_QueueCreate
- Description : Create a queue
- Input       : queueName  --- Queue name, less than 4 characters
-             : len        --- Queue length
-             : flags      --- Queue type, FIFO or PRIO
-             : maxMsgSize --- Maximum message size in byte
- Output      : queueID    --- Queue ID
- Return      : LOS_OK on success or error code on failure
- *****************************************************************************/
-LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(const CHAR *queueName,
-                                             UINT16 len,
-                                             UINT32 *queueID,
-                                             UINT32 flags,
-                                             UINT16 maxMsgSize)
+STATIC INLINE UINT32 OsQueueCreateParameterCheck(UINT16 len, const UINT32 *queueID, UINT16 maxMsgSize)
 {
-    LosQueueCB *queueCB = NULL;
-    UINT32 intSave;
-    LOS_DL_LIST *unusedQueue = NULL;
-    UINT8 *queue = NULL;
-    UINT16 msgSize;
-
-    (VOID)queueName;
-    (VOID)flags;
-
     // 参数合法性验证
     if (queueID == NULL) {
         return LOS_ERRNO_QUEUE_CREAT_PTR_NULL;
@@ -122,26 +107,23 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(const CHAR *queueName,
         return LOS_ERRNO_QUEUE_PARA_ISZERO;
     }
 
-    // 消息大小为最大消息大小+4字节
-    msgSize = maxMsgSize + sizeof(UINT32);
-
-    /* Memory allocation is time-consuming, to shorten the time of disable interrupt,
-       move the memory allocation to here. */
     // 如果消息个数*每个消息的大小大于32位最大值，则消息队列中消息的大小可能会太大，不允许
-    if ((UINT32_MAX / msgSize) < len) {
+    if ((UINT32_MAX / (maxMsgSize + sizeof(UINT32))) < len) {
         return LOS_ERRNO_QUEUE_SIZE_TOO_BIG;
     }
-    // 申请空间，消息队列中的消息是一个数组，一次申请全部所需空间
-    queue = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, (UINT32)len * msgSize);
-    if (queue == NULL) {
-        return LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
-    }
+
+    return LOS_OK;
+}
+
+STATIC UINT32 OsQueueCreate(UINT16 len, UINT32 *queueID, UINT16 msgSize, UINT8 *queue, UINT16 queueState)
+{
+    LosQueueCB *queueCB = NULL;
+    UINT32 intSave;
+    LOS_DL_LIST *unusedQueue = NULL;
 
     intSave = LOS_IntLock();
-    // 如果没有可用的QueueCB,释放内存，返回错误
     if (LOS_ListEmpty(&g_freeQueueList)) {
         LOS_IntRestore(intSave);
-        (VOID)LOS_MemFree(m_aucSysMem0, queue);
         return LOS_ERRNO_QUEUE_CB_UNAVAILABLE;
     }
 
@@ -152,7 +134,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(const CHAR *queueName,
     queueCB->queueLen = len;
     queueCB->queueSize = msgSize;
     queueCB->queue = queue;
-    queueCB->queueState = OS_QUEUE_INUSED;
+    queueCB->queueState = queueState;
     queueCB->readWriteableCnt[OS_QUEUE_READ] = 0;  // 表示可读的元素数量 0
     queueCB->readWriteableCnt[OS_QUEUE_WRITE] = len; // 表示可写的元素数量 6
     queueCB->queueHead = 0;
@@ -169,6 +151,96 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(const CHAR *queueName,
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function    : LOS_QueueCreate
+ Description : Create a queue
+ Input       : queueName  --- Queue name, less than 4 characters
+             : len        --- Queue length
+             : flags      --- Queue type, FIFO or PRIO
+             : maxMsgSize --- Maximum message size in byte
+ Output      : queueID    --- Queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(const CHAR *queueName,
+                                             UINT16 len,
+                                             UINT32 *queueID,
+                                             UINT32 flags,
+                                             UINT16 maxMsgSize)
+{
+    UINT8 *queue = NULL;
+    UINT16 msgSize;
+    UINT32 ret;
+
+    (VOID)queueName;
+    (VOID)flags;
+
+    ret = OsQueueCreateParameterCheck(len, queueID, maxMsgSize);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    // 消息大小为最大消息大小+4字节
+    msgSize = maxMsgSize + sizeof(UINT32);
+
+    /* Memory allocation is time-consuming, to shorten the time of disable interrupt,
+       move the memory allocation to here. */
+    // 申请空间，消息队列中的消息是一个数组，一次申请全部所需空间
+    queue = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, (UINT32)len * msgSize);
+    if (queue == NULL) {
+        return LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+    }
+
+    ret = OsQueueCreate(len, queueID, msgSize, queue, OS_QUEUE_INUSED);
+    if (ret != LOS_OK) {
+        // 如果没有可用的QueueCB,释放内存，返回错误
+        (VOID)LOS_MemFree(m_aucSysMem0, queue);
+    }
+    return ret;
+}
+
+#if (LOSCFG_BASE_IPC_QUEUE_STATIC == 1)
+/*****************************************************************************
+ Function    : LOS_QueueCreateStatic
+ Description : Create a queue on the message memory provided by the caller
+ Input       : queueName  --- Queue name, less than 4 characters
+             : len        --- Queue length
+             : flags      --- Queue type, FIFO or PRIO
+             : maxMsgSize --- Maximum message size in byte
+             : queueMem   --- Message memory of the queue
+             : memSize    --- Size of the message memory
+ Output      : queueID    --- Queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreateStatic(const CHAR *queueName,
+                                                   UINT16 len,
+                                                   UINT32 *queueID,
+                                                   UINT32 flags,
+                                                   UINT16 maxMsgSize,
+                                                   VOID *queueMem,
+                                                   UINT32 memSize)
+{
+    UINT32 ret;
+
+    (VOID)queueName;
+    (VOID)flags;
+
+    ret = OsQueueCreateParameterCheck(len, queueID, maxMsgSize);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    if (queueMem == NULL) {
+        return LOS_ERRNO_QUEUE_CREAT_PTR_NULL;
+    }
+
+    if (memSize < LOS_QUEUE_STATIC_MEM_SIZE(len, maxMsgSize)) {
+        return LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+    }
+
+    return OsQueueCreate(len, queueID, maxMsgSize + sizeof(UINT32), (UINT8 *)queueMem, OS_QUEUE_INUSED_STATIC);
+}
+#endif
+
 static INLINE LITE_OS_SEC_TEXT UINT32 OsQueueReadParameterCheck(UINT32 queueID, VOID *bufferAddr,
                                                                 UINT32 *bufferSize, UINT32 timeOut)
 {
@@ -294,7 +366,7 @@ static INLINE UINT32 OsQueueOperateParamCheck(const LosQueueCB *queueCB, UINT32
     return LOS_OK;
 }
 
-UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT32 *bufferSize, UINT32 timeOut)
+UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT32 *bufferSize, UINT64 timeOut)
 {
     LosQueueCB *queueCB = NULL;
     LosTaskCB *resumedTask = NULL;
@@ -324,7 +396,7 @@ UINT32 OsQueueOperate(UINT32 queueID, UINT32 operateType, VOID *bufferAddr, UINT
         }
 
         LosTaskCB *runTsk = (LosTaskCB *)g_losTask.runTask;
-        OsSchedTaskWait(&queueCB->readWriteList[readWrite], timeOut);
+        OsSchedTaskWaitCycle(&queueCB->readWriteList[readWrite], timeOut);
         LOS_IntRestore(intSave);
         LOS_Schedule();
 
@@ -370,6 +442,24 @@ LITE_OS_SEC_TEXT UINT32 LOS_QueueReadCopy(UINT32 queueID,
         return ret;
     }
 
+    operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_READ, OS_QUEUE_HEAD, OS_QUEUE_NOT_POINT);
+    return OsQueueOperate(queueID, operateType, bufferAddr, bufferSize, OsSchedTickToWaitCycle(timeOut));
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_QueueReadCopyNs(UINT32 queueID,
+                                            VOID *bufferAddr,
+                                            UINT32 *bufferSize,
+                                            UINT64 timeOutNs)
+{
+    UINT32 ret;
+    UINT32 operateType;
+    UINT64 timeOut = OsSchedNsToWaitCycle(timeOutNs);
+
+    ret = OsQueueReadParameterCheck(queueID, bufferAddr, bufferSize, OsSchedWaitCycleToTick(timeOut));
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
     operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_READ, OS_QUEUE_HEAD, OS_QUEUE_NOT_POINT);
     return OsQueueOperate(queueID, operateType, bufferAddr, bufferSize, timeOut);
 }
@@ -388,7 +478,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteHeadCopy(UINT32 queueID,
     }
 
     operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_WRITE, OS_QUEUE_HEAD, OS_QUEUE_NOT_POINT);
-    return OsQueueOperate(queueID, operateType, bufferAddr, &bufferSize, timeOut);
+    return OsQueueOperate(queueID, operateType, bufferAddr, &bufferSize, OsSchedTickToWaitCycle(timeOut));
 }
 
 LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteCopy(UINT32 queueID,
@@ -404,6 +494,24 @@ LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteCopy(UINT32 queueID,
         return ret;
     }
 
+    operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_WRITE, OS_QUEUE_TAIL, OS_QUEUE_NOT_POINT);
+    return OsQueueOperate(queueID, operateType, bufferAddr, &bufferSize, OsSchedTickToWaitCycle(timeOut));
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteCopyNs(UINT32 queueID,
+                                             VOID *bufferAddr,
+                                             UINT32 bufferSize,
+                                             UINT64 timeOutNs)
+{
+    UINT32 ret;
+    UINT32 operateType;
+    UINT64 timeOut = OsSchedNsToWaitCycle(timeOutNs);
+
+    ret = OsQueueWriteParameterCheck(queueID, bufferAddr, &bufferSize, OsSchedWaitCycleToTick(timeOut));
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
     operateType = OS_QUEUE_OPERATE_TYPE(OS_QUEUE_WRITE, OS_QUEUE_TAIL, OS_QUEUE_NOT_POINT);
     return OsQueueOperate(queueID, operateType, bufferAddr, &bufferSize, timeOut);
 }
@@ -422,7 +530,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_QueueRead(UINT32 queueID, VOID *bufferAddr, UINT32 b
 
     OsHookCall(LOS_HOOK_TYPE_QUEUE_READ, (LosQueueCB *)GET_QUEUE_HANDLE(queueID), operateType, bufferSize, timeOut);
 
-    return OsQueueOperate(queueID, operateType, bufferAddr, &bufferSize, timeOut);
+    return OsQueueOperate(queueID, operateType, bufferAddr, &bufferSize, OsSchedTickToWaitCycle(timeOut));
 }
 
 LITE_OS_SEC_TEXT UINT32 LOS_QueueWrite(UINT32 queueID, VOID *bufferAddr, UINT32 bufferSize, UINT32 timeOut)
@@ -441,7 +549,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_QueueWrite(UINT32 queueID, VOID *bufferAddr, UINT32
 
     OsHookCall(LOS_HOOK_TYPE_QUEUE_WRITE, (LosQueueCB *)GET_QUEUE_HANDLE(queueID), operateType, size, timeOut);
 
-    return OsQueueOperate(queueID, operateType, &bufferAddr, &size, timeOut);
+    return OsQueueOperate(queueID, operateType, &bufferAddr, &size, OsSchedTickToWaitCycle(timeOut));
 }
 
 LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteHead(UINT32 queueID,
@@ -590,6 +698,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueDelete(UINT32 queueID)
 {
     LosQueueCB *queueCB = NULL;
     UINT8 *queue = NULL;
+    UINT16 queueState;
     UINT32 intSave;
     UINT32 ret;
 
@@ -626,6 +735,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueDelete(UINT32 queueID)
     }
 
     queue = queueCB->queue;
+    queueState = queueCB->queueState;
     queueCB->queue = (UINT8 *)NULL;
     queueCB->queueState = OS_QUEUE_UNUSED;
     LOS_ListAdd(&g_freeQueueList, &queueCB->readWriteList[OS_QUEUE_WRITE]);
@@ -633,6 +743,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueDelete(UINT32 queueID)
 
     OsHookCall(LOS_HOOK_TYPE_QUEUE_DELETE, queueCB);
 
+    if (queueState == OS_QUEUE_INUSED_STATIC) {
+        return LOS_OK;
+    }
     ret = LOS_MemFree(m_aucSysMem0, (VOID *)queue);
     return ret;
 
@@ -38,6 +38,9 @@
 #if (LOSCFG_KERNEL_PM == 1)
 #include "los_pm.h"
 #endif
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+#include "securec.h"
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -45,8 +48,10 @@ extern "C" {
 #endif /* __cplusplus */
 #endif /* __cplusplus */
 
-#define OS_PRIORITY_QUEUE_NUM      32
+#define OS_PRIORITY_QUEUE_NUM      LOSCFG_BASE_CORE_TSK_PRIORITY_NUM
 #define PRIQUEUE_PRIOR0_BIT        0x80000000U
+#define OS_PRIORITY_BITMAP_BITS    32
+#define OS_PRIORITY_BITMAP_NUM     (OS_PRIORITY_QUEUE_NUM / OS_PRIORITY_BITMAP_BITS)
 #define OS_SCHED_TIME_SLICES       ((LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT * OS_SYS_NS_PER_US) / OS_NS_PER_CYCLE)
 #define OS_TIME_SLICE_MIN          (INT32)((50 * OS_SYS_NS_PER_US) / OS_NS_PER_CYCLE) /* 50us */
 #define OS_TICK_RESPONSE_TIME_MAX  LOSCFG_BASE_CORE_TICK_RESPONSE_MAX
@@ -59,13 +64,35 @@ extern "C" {
                                 OS_TASK_STATUS_EXIT | OS_TASK_STATUS_UNUSED)
 
 STATIC SchedScan  g_swtmrScan = NULL;
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+STATIC SchedScan  g_workScan = NULL;
+#endif
 STATIC SortLinkAttribute *g_taskSortLinkList = NULL;
 STATIC LOS_DL_LIST g_priQueueList[OS_PRIORITY_QUEUE_NUM];
+#if (OS_PRIORITY_BITMAP_NUM > 1)
+/* Bit n of g_queueBitmapGroup is set when g_queueBitmap[n] has a ready priority */
+STATIC UINT32 g_queueBitmapGroup;
+STATIC UINT32 g_queueBitmap[OS_PRIORITY_BITMAP_NUM];
+#else
 STATIC UINT32 g_queueBitmap;
+#endif
 
 STATIC UINT32 g_schedResponseID = 0;
 STATIC UINT16 g_tickIntLock = 0;
 STATIC UINT64 g_schedResponseTime = OS_SCHED_MAX_RESPONSE_TIME;
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+STATIC UINT64 g_schedWakeTime = OS_SCHED_MAX_RESPONSE_TIME;
+STATIC LOS_SCHED_SLACK_STAT_S g_schedSlackStat;
+#endif
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+STATIC LOS_SCHED_LATENCY_GLOBAL_S g_schedLatency;
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+#define OS_SCHED_EDF_UTIL_SCALE    1000000U /* Utilisation is kept in millionths */
+#define OS_SCHED_EDF_UTIL_MAX      (LOSCFG_KERNEL_SCHED_EDF_UTIL_MAX * (OS_SCHED_EDF_UTIL_SCALE / 100))
+STATIC SortLinkAttribute *g_edfSortLinkList = NULL;
+STATIC UINT32 g_schedEdfUtil;
+#endif
 
 /**
  * @brief 重置g_schedResponseTime ，如果responseTime <= g_schedResponseTime
@@ -91,10 +118,43 @@ STATIC INLINE VOID OsTimeSliceUpdate(LosTaskCB *taskCB, UINT64 currTime)
     INT32 incTime = currTime - taskCB->startTime;
     if (taskCB->taskID != g_idleTaskID) {
         taskCB->timeSlice -= incTime;
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+        /* Counted when the slice runs out, a yield empties the slice at once and is not counted here */
+        if ((taskCB->timeSlice <= OS_TIME_SLICE_MIN) && ((taskCB->timeSlice + incTime) > OS_TIME_SLICE_MIN)) {
+            taskCB->sliceExpired++;
+        }
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+        if (taskCB->edf.period != 0) {
+            taskCB->edf.budgetLeft -= incTime;
+        }
+#endif
     }
     taskCB->startTime = currTime;
 }
 
+/* Length of a full time slice of the task */
+STATIC INLINE INT32 OsSchedTimeSliceLen(const LosTaskCB *taskCB)
+{
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+    return taskCB->sliceLen;
+#else
+    (VOID)taskCB;
+    return (INT32)OS_SCHED_TIME_SLICES;
+#endif
+}
+
+/* Time the task may run before it is preempted, an EDF task runs until its budget is used up */
+STATIC INLINE INT32 OsSchedTimeSliceGet(const LosTaskCB *taskCB)
+{
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    if (taskCB->edf.period != 0) {
+        return taskCB->edf.budgetLeft;
+    }
+#endif
+    return taskCB->timeSlice;
+}
+
 STATIC INLINE VOID OsSchedSetNextExpireTime(UINT32 responseID, UINT64 taskEndTime)
 {
     UINT64 nextResponseTime;
@@ -142,7 +202,10 @@ VOID OsSchedUpdateExpireTime(VOID)
     isPmMode = OsIsPmMode();
 #endif
     if ((runTask->taskID != g_idleTaskID) && !isPmMode) {
-        INT32 timeSlice = (runTask->timeSlice <= OS_TIME_SLICE_MIN) ? (INT32)OS_SCHED_TIME_SLICES : runTask->timeSlice;
+        INT32 timeSlice = OsSchedTimeSliceGet(runTask);
+        if (timeSlice <= OS_TIME_SLICE_MIN) {
+            timeSlice = OsSchedTimeSliceLen(runTask);
+        }
         endTime = runTask->startTime + timeSlice;
     } else {
         endTime = OS_SCHED_MAX_RESPONSE_TIME - OS_TICK_RESPONSE_PRECISION;
@@ -150,6 +213,51 @@ VOID OsSchedUpdateExpireTime(VOID)
     OsSchedSetNextExpireTime(runTask->taskID, endTime);
 }
 
+STATIC INLINE VOID OsSchedPriBitmapSet(UINT32 priority)
+{
+#if (OS_PRIORITY_BITMAP_NUM > 1)
+    UINT32 group = priority / OS_PRIORITY_BITMAP_BITS;
+
+    g_queueBitmap[group] |= PRIQUEUE_PRIOR0_BIT >> (priority % OS_PRIORITY_BITMAP_BITS);
+    g_queueBitmapGroup |= PRIQUEUE_PRIOR0_BIT >> group;
+#else
+    g_queueBitmap |= PRIQUEUE_PRIOR0_BIT >> priority;
+#endif
+}
+
+STATIC INLINE VOID OsSchedPriBitmapClear(UINT32 priority)
+{
+#if (OS_PRIORITY_BITMAP_NUM > 1)
+    UINT32 group = priority / OS_PRIORITY_BITMAP_BITS;
+
+    g_queueBitmap[group] &= ~(PRIQUEUE_PRIOR0_BIT >> (priority % OS_PRIORITY_BITMAP_BITS));
+    if (g_queueBitmap[group] == 0) {
+        g_queueBitmapGroup &= ~(PRIQUEUE_PRIOR0_BIT >> group);
+    }
+#else
+    g_queueBitmap &= ~(PRIQUEUE_PRIOR0_BIT >> priority);
+#endif
+}
+
+/* Highest priority with a ready task, OS_PRIORITY_QUEUE_NUM if there is none */
+STATIC INLINE UINT32 OsSchedPriBitmapTop(VOID)
+{
+#if (OS_PRIORITY_BITMAP_NUM > 1)
+    UINT32 group;
+
+    if (g_queueBitmapGroup == 0) {
+        return OS_PRIORITY_QUEUE_NUM;
+    }
+    group = CLZ(g_queueBitmapGroup);
+    return (group * OS_PRIORITY_BITMAP_BITS) + CLZ(g_queueBitmap[group]);
+#else
+    if (g_queueBitmap == 0) {
+        return OS_PRIORITY_QUEUE_NUM;
+    }
+    return CLZ(g_queueBitmap);
+#endif
+}
+
 STATIC INLINE VOID OsSchedPriQueueEnHead(LOS_DL_LIST *priqueueItem, UINT32 priority)
 {
     /*
@@ -159,7 +267,7 @@ STATIC INLINE VOID OsSchedPriQueueEnHead(LOS_DL_LIST *priqueueItem, UINT32 prior
      */
     if (LOS_ListEmpty(&g_priQueueList[priority])) {
         // 意思是优先级为priority的队列要加入元素，不空
-        g_queueBitmap |= PRIQUEUE_PRIOR0_BIT >> priority;
+        OsSchedPriBitmapSet(priority);
     }
 
     // 把task加入优先级为priority的队列头部
@@ -170,7 +278,7 @@ STATIC INLINE VOID OsSchedPriQueueEnTail(LOS_DL_LIST *priqueueItem, UINT32 prior
 {
     if (LOS_ListEmpty(&g_priQueueList[priority])) {
         // 意思是优先级为priority的队列要加入元素，不空
-        g_queueBitmap |= PRIQUEUE_PRIOR0_BIT >> priority;
+        OsSchedPriBitmapSet(priority);
     }
 
     // 把task加入优先级为priority的队列尾部
@@ -185,7 +293,7 @@ STATIC INLINE VOID OsSchedPriQueueDelete(LOS_DL_LIST *priqueueItem, UINT32 prior
 {
     LOS_ListDelete(priqueueItem);
     if (LOS_ListEmpty(&g_priQueueList[priority])) {
-        g_queueBitmap &= ~(PRIQUEUE_PRIOR0_BIT >> priority);
+        OsSchedPriBitmapClear(priority);
     }
 }
 
@@ -246,6 +354,9 @@ STATIC INLINE BOOL OsSchedScanTimerList(VOID)
     // 遍历链表直到sortList->responseTime > 当前时间，从sortlist中删除，并添加到就绪队列中
     while (sortList->responseTime <= currTime) {
         LosTaskCB *taskCB = LOS_DL_LIST_ENTRY(sortList, LosTaskCB, sortList);
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+        OsSchedSlackExpired(sortList);
+#endif
         OsDeleteNodeSortLink(&taskCB->sortList);
         OsSchedWakePendTimeTask(taskCB, &needSchedule);
         if (LOS_ListEmpty(listObject)) {
@@ -258,6 +369,44 @@ STATIC INLINE BOOL OsSchedScanTimerList(VOID)
     return needSchedule;
 }
 
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+/* Start the period containing currTime, the periods stay aligned to the first one */
+STATIC INLINE VOID OsSchedEdfReplenish(SchedEdfCB *edf, UINT64 currTime)
+{
+    edf->deadline += (((currTime - edf->deadline) / edf->period) + 1) * edf->period;
+    edf->budgetLeft = edf->budget;
+}
+
+STATIC VOID OsSchedEdfTaskEnQueue(LosTaskCB *taskCB)
+{
+    SchedEdfCB *edf = &taskCB->edf;
+    UINT64 currTime = OsGetCurrSchedTimeCycle();
+
+    taskCB->taskStatus &= ~(OS_TASK_STATUS_PEND | OS_TASK_STATUS_SUSPEND |
+                            OS_TASK_STATUS_DELAY | OS_TASK_STATUS_PEND_TIME);
+    edf->throttled = FALSE;
+
+    if (currTime >= edf->deadline) {
+        OsSchedEdfReplenish(edf, currTime);
+    } else if (edf->budgetLeft <= OS_TIME_SLICE_MIN) {
+        /* Budget used up, wait on the timer list for the replenishment at the end of the period */
+        edf->stat.throttles++;
+        edf->throttled = TRUE;
+        taskCB->taskStatus |= OS_TASK_STATUS_DELAY;
+        OsAdd2SortLinkCycle(&taskCB->sortList, edf->deadline, OS_SORT_LINK_TASK);
+        OsHookCall(LOS_HOOK_TYPE_MOVEDTASKTODELAYEDLIST, taskCB);
+        return;
+    }
+
+    OsAdd2SortLinkCycle(&edf->readyList, edf->deadline, OS_SORT_LINK_EDF);
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+    taskCB->readyTime = g_taskScheduled ? currTime : 0;
+#endif
+    OsHookCall(LOS_HOOK_TYPE_MOVEDTASKTOREADYSTATE, taskCB);
+    taskCB->taskStatus |= OS_TASK_STATUS_READY;
+}
+#endif
+
 /// @brief 将任务加入优先级队列中，如果时间片大于最小时间片，插入头部，否则（时间片用完）插入尾部，保证同级别的其他任务可以执行
 /// @param taskCB 
 /// @return VOID
@@ -266,14 +415,23 @@ VOID OsSchedTaskEnQueue(LosTaskCB *taskCB)
     // 断言：task状态应该是非ready
     LOS_ASSERT(!(taskCB->taskStatus & OS_TASK_STATUS_READY));
 
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    if (taskCB->edf.period != 0) {
+        OsSchedEdfTaskEnQueue(taskCB);
+        return;
+    }
+#endif
     if (taskCB->taskID != g_idleTaskID) {
         if (taskCB->timeSlice > OS_TIME_SLICE_MIN) {
             // 如果时间片大于最小时间片，则把task加入优先级为priority的队列中。
             OsSchedPriQueueEnHead(&taskCB->pendList, taskCB->priority);
         } else { // 时间片用完
-            taskCB->timeSlice = OS_SCHED_TIME_SLICES;
+            taskCB->timeSlice = OsSchedTimeSliceLen(taskCB);
             OsSchedPriQueueEnTail(&taskCB->pendList, taskCB->priority);
         }
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+        taskCB->readyTime = g_taskScheduled ? OsGetCurrSchedTimeCycle() : 0;
+#endif
         OsHookCall(LOS_HOOK_TYPE_MOVEDTASKTOREADYSTATE, taskCB);
     }
 
@@ -291,7 +449,15 @@ VOID OsSchedTaskDeQueue(LosTaskCB *taskCB)
     // 如果任务是就绪态，将任务从优先级队列删除
     if (taskCB->taskStatus & OS_TASK_STATUS_READY) {
         if (taskCB->taskID != g_idleTaskID) {
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+            if (taskCB->edf.period != 0) {
+                OsDeleteNodeSortLink(&taskCB->edf.readyList);
+            } else {
+                OsSchedPriQueueDelete(&taskCB->pendList, taskCB->priority);
+            }
+#else
             OsSchedPriQueueDelete(&taskCB->pendList, taskCB->priority);
+#endif
         }
         // 取消就绪态
         taskCB->taskStatus &= ~OS_TASK_STATUS_READY;
@@ -311,6 +477,13 @@ VOID OsSchedTaskExit(LosTaskCB *taskCB)
         OsDeleteSortLink(&taskCB->sortList);
         taskCB->taskStatus &= ~(OS_TASK_STATUS_DELAY | OS_TASK_STATUS_PEND_TIME);
     }
+
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    /* Give the admitted bandwidth back */
+    g_schedEdfUtil -= taskCB->edf.util;
+    taskCB->edf.util = 0;
+    taskCB->edf.period = 0;
+#endif
 }
 
 /**
@@ -323,32 +496,40 @@ VOID OsSchedYield(VOID)
     LosTaskCB *runTask = g_losTask.runTask;
 
     runTask->timeSlice = 0;
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+    runTask->sliceYields++;
+#endif
 }
 
 /**
  * @brief 设置状态为DELAY，设置等待时间
  * 
  * @param runTask 
- * @param tick 
+ * @param cycles 
  * @return VOID 
  */
-VOID OsSchedDelay(LosTaskCB *runTask, UINT32 tick)
+VOID OsSchedDelay(LosTaskCB *runTask, UINT64 cycles)
 {
     runTask->taskStatus |= OS_TASK_STATUS_DELAY;
-    runTask->waitTimes = tick;
+    runTask->waitTimes = cycles;
 }
 
 VOID OsSchedTaskWait(LOS_DL_LIST *list, UINT32 ticks)
+{
+    OsSchedTaskWaitCycle(list, OsSchedTickToWaitCycle(ticks));
+}
+
+VOID OsSchedTaskWaitCycle(LOS_DL_LIST *list, UINT64 timeout)
 {
     LosTaskCB *runTask = g_losTask.runTask;
 
     runTask->taskStatus |= OS_TASK_STATUS_PEND;
     LOS_ListTailInsert(list, &runTask->pendList);
 
-    // ticks != LOS_WAIT_FOREVER, ticks有效，设置runtask的waittimes
-    if (ticks != LOS_WAIT_FOREVER) {
+    // timeout != OS_SCHED_WAIT_FOREVER, timeout有效，设置runtask的waittimes(cycle)
+    if (timeout != OS_SCHED_WAIT_FOREVER) {
         runTask->taskStatus |= OS_TASK_STATUS_PEND_TIME;
-        runTask->waitTimes = ticks;
+        runTask->waitTimes = timeout;
     }
 }
 
@@ -399,14 +580,12 @@ STATIC VOID OsSchedFreezeTask(LosTaskCB *taskCB)
 STATIC VOID OsSchedUnfreezeTask(LosTaskCB *taskCB)
 {
     UINT64 currTime, responseTime;
-    UINT32 remainTick;
 
     taskCB->taskStatus &= ~OS_TASK_FLAG_FREEZE;
     currTime = OsGetCurrSchedTimeCycle();
     responseTime = GET_SORTLIST_VALUE(&taskCB->sortList);
     if (responseTime > currTime) {
-        remainTick = ((responseTime - currTime) + OS_CYCLE_PER_TICK - 1) / OS_CYCLE_PER_TICK;
-        OsAdd2SortLink(&taskCB->sortList, currTime, remainTick, OS_SORT_LINK_TASK);
+        OsAdd2SortLinkCycle(&taskCB->sortList, responseTime, OS_SORT_LINK_TASK);
         return;
     }
 
@@ -494,6 +673,89 @@ BOOL OsSchedModifyTaskSchedParam(LosTaskCB *taskCB, UINT16 priority)
     return FALSE;
 }
 
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+UINT32 OsSchedEdfParamSet(LosTaskCB *taskCB, UINT32 periodUs, UINT32 budgetUs, BOOL *needSched)
+{
+    SchedEdfCB *edf = &taskCB->edf;
+    UINT64 period = 0;
+    UINT64 budget = 0;
+    UINT32 util = 0;
+    BOOL isReady = FALSE;
+
+    if (periodUs != 0) {
+        period = OS_SYS_NS_TO_CYCLE((UINT64)periodUs * OS_SYS_NS_PER_US, g_sysClock);
+        budget = OS_SYS_NS_TO_CYCLE((UINT64)budgetUs * OS_SYS_NS_PER_US, g_sysClock);
+        if ((budgetUs > periodUs) || (budget <= (UINT64)OS_TIME_SLICE_MIN) || (budget > (UINT64)OS_NULL_INT >> 1)) {
+            return LOS_ERRNO_TSK_EDF_PARAM_INVALID;
+        }
+
+        util = (UINT32)(((UINT64)budgetUs * OS_SCHED_EDF_UTIL_SCALE) / periodUs);
+        if ((g_schedEdfUtil - edf->util + util) > OS_SCHED_EDF_UTIL_MAX) {
+            return LOS_ERRNO_TSK_EDF_OVERLOAD;
+        }
+    }
+
+    /*
+     * A ready task is moved between the priority queues and the deadline ordered list. A throttled task only waits
+     * for the replenishment of the budget being replaced, so it is taken off the timer list and made ready at once.
+     */
+    if (taskCB->taskStatus & OS_TASK_STATUS_READY) {
+        OsSchedTaskDeQueue(taskCB);
+        isReady = TRUE;
+    } else if (edf->throttled && (taskCB->taskStatus & OS_TASK_STATUS_DELAY)) {
+        OsDeleteSortLink(&taskCB->sortList);
+        taskCB->taskStatus &= ~OS_TASK_STATUS_DELAY;
+        isReady = !(taskCB->taskStatus & OS_TASK_STATUS_SUSPEND);
+    }
+
+    g_schedEdfUtil = g_schedEdfUtil - edf->util + util;
+    edf->util = util;
+    edf->period = period;
+    edf->budget = (INT32)budget;
+    edf->budgetLeft = (INT32)budget;
+    edf->deadline = OsGetCurrSchedTimeCycle() + period;
+    edf->jobDeadline = edf->deadline;
+    edf->throttled = FALSE;
+    edf->stat.periodUs = periodUs;
+    edf->stat.budgetUs = (periodUs != 0) ? budgetUs : 0;
+    edf->stat.jobs = 0;
+    edf->stat.misses = 0;
+    edf->stat.throttles = 0;
+
+    if (isReady) {
+        OsSchedTaskEnQueue(taskCB);
+    }
+    *needSched = isReady || (taskCB->taskStatus & OS_TASK_STATUS_RUNNING);
+    if (taskCB->taskStatus & OS_TASK_STATUS_RUNNING) {
+        OsSchedUpdateExpireTime();
+    }
+    return LOS_OK;
+}
+
+/* Complete the current job of an EDF task, return the cycles until the next job is released */
+UINT64 OsSchedEdfJobEnd(LosTaskCB *runTask)
+{
+    SchedEdfCB *edf = &runTask->edf;
+    UINT64 currTime = OsGetCurrSchedTimeCycle();
+
+    edf->stat.jobs++;
+    if (currTime > edf->jobDeadline) {
+        edf->stat.misses++;
+    } else if (currTime < edf->jobDeadline) {
+        /* The next job is released when this period ends, and is due at the end of the next one */
+        edf->jobDeadline += edf->period;
+        return edf->jobDeadline - edf->period - currTime;
+    }
+
+    /* Late, the next job is released at once and is due at the end of the current period */
+    if (currTime >= edf->deadline) {
+        OsSchedEdfReplenish(edf, currTime);
+    }
+    edf->jobDeadline = edf->deadline;
+    return 0;
+}
+#endif
+
 VOID OsSchedSetIdleTaskSchedParam(LosTaskCB *idleTask)
 {
     OsSchedTaskEnQueue(idleTask);
@@ -509,6 +771,18 @@ UINT32 OsSchedSwtmrScanRegister(SchedScan func)
     return LOS_OK;
 }
 
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+UINT32 OsSchedWorkScanRegister(SchedScan func)
+{
+    if (func == NULL) {
+        return LOS_NOK;
+    }
+
+    g_workScan = func;
+    return LOS_OK;
+}
+#endif
+
 UINT32 OsTaskNextSwitchTimeGet(VOID)
 {
     UINT32 intSave = LOS_IntLock();
@@ -523,7 +797,7 @@ UINT64 OsSchedGetNextExpireTime(UINT64 startTime)
 }
 
 /**
- * @brief 初始化优先级队列（32个）
+ * @brief 初始化优先级队列（LOSCFG_BASE_CORE_TSK_PRIORITY_NUM个）
  * 
  * @return UINT32 
  */
@@ -535,7 +809,14 @@ UINT32 OsSchedInit(VOID)
         LOS_ListInit(&g_priQueueList[pri]);
     }
     // 某一位为1表示该下标优先级队列有任务
+#if (OS_PRIORITY_BITMAP_NUM > 1)
+    g_queueBitmapGroup = 0;
+    for (pri = 0; pri < OS_PRIORITY_BITMAP_NUM; pri++) {
+        g_queueBitmap[pri] = 0;
+    }
+#else
     g_queueBitmap = 0;
+#endif
 
     // g_taskSortLinkList = g_taskSortLink
     g_taskSortLinkList = OsGetSortLinkAttribute(OS_SORT_LINK_TASK);
@@ -545,6 +826,14 @@ UINT32 OsSchedInit(VOID)
 
     // 初始化成员 sortLink， g_taskSortLinkList 中只有一个成员 LOS_DL_LIST sortLink;
     OsSortLinkInit(g_taskSortLinkList);
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    g_edfSortLinkList = OsGetSortLinkAttribute(OS_SORT_LINK_EDF);
+    if (g_edfSortLinkList == NULL) {
+        return LOS_NOK;
+    }
+    OsSortLinkInit(g_edfSortLinkList);
+    g_schedEdfUtil = 0;
+#endif
     // 初始化调度响应时间为最大值，设置 g_schedResponseTime 为 ((UINT64)-1)
     g_schedResponseTime = OS_SCHED_MAX_RESPONSE_TIME;
 
@@ -553,7 +842,7 @@ UINT32 OsSchedInit(VOID)
 
 /**
  * @brief 选取一个任务
- *        1. 如果g_queueBitmap不为0,则获取优先级最高的队列中的一个任务（pendlist），从优先级队列（32个优先级）中
+ *        1. 如果g_queueBitmap不为0,则获取优先级最高的队列中的一个任务（pendlist），从优先级队列（LOSCFG_BASE_CORE_TSK_PRIORITY_NUM个优先级）中
  *        2. 否则根据TaskId（下标）从task数组中获取一个task
  * 
  * @return LosTaskCB* 
@@ -562,9 +851,15 @@ LosTaskCB *OsGetTopTask(VOID)
 {
     UINT32 priority;
     LosTaskCB *newTask = NULL;
-    if (g_queueBitmap) {
-        // CLZ 统计最高位0的个数
-        priority = CLZ(g_queueBitmap);
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    /* EDF tasks run above all priorities, the earliest deadline first */
+    if (!LOS_ListEmpty(&g_edfSortLinkList->sortLink)) {
+        SortLinkList *readyList = LOS_DL_LIST_ENTRY(g_edfSortLinkList->sortLink.pstNext, SortLinkList, sortLinkNode);
+        return LOS_DL_LIST_ENTRY(readyList, LosTaskCB, edf.readyList);
+    }
+#endif
+    priority = OsSchedPriBitmapTop();
+    if (priority < OS_PRIORITY_QUEUE_NUM) {
         newTask = LOS_DL_LIST_ENTRY(((LOS_DL_LIST *)&g_priQueueList[priority])->pstNext, LosTaskCB, pendList);
     } else {
         newTask = OS_TCB_FROM_TID(g_idleTaskID);
@@ -602,9 +897,51 @@ VOID OsSchedStart(VOID)
     g_schedResponseTime = OS_SCHED_MAX_RESPONSE_TIME;
     g_schedResponseID = OS_INVALID;
     // 设置task过期时间
-    OsSchedSetNextExpireTime(newTask->taskID, newTask->startTime + newTask->timeSlice);
+    OsSchedSetNextExpireTime(newTask->taskID, newTask->startTime + OsSchedTimeSliceGet(newTask));
+}
+
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+STATIC INLINE VOID OsSchedLatencyUpdate(LOS_SCHED_LATENCY_S *latency, UINT32 cycles, UINT32 blockerID)
+{
+    latency->count++;
+    latency->totalCycles += cycles;
+    if (cycles > latency->maxCycles) {
+        latency->maxCycles = cycles;
+        latency->blockerID = blockerID;
+    }
 }
 
+/* Called at switch in, runTask->startTime has just been set to the current time */
+STATIC INLINE VOID OsSchedLatencyRecord(LosTaskCB *newTask, const LosTaskCB *runTask)
+{
+    UINT64 wait;
+    UINT32 cycles;
+    UINT32 index = 0;
+
+    if (newTask->readyTime == 0) {
+        return;
+    }
+
+    wait = runTask->startTime - newTask->readyTime;
+    newTask->readyTime = 0;
+    cycles = (wait > OS_NULL_INT) ? OS_NULL_INT : (UINT32)wait;
+
+    if ((cycles >> LOS_SCHED_LATENCY_HIST_SHIFT) != 0) {
+        index = 32 - CLZ(cycles >> LOS_SCHED_LATENCY_HIST_SHIFT); /* 32, bits of UINT32 */
+        if (index >= LOS_SCHED_LATENCY_HIST_NUM) {
+            index = LOS_SCHED_LATENCY_HIST_NUM - 1;
+        }
+    }
+    g_schedLatency.hist[index]++;
+
+    if (cycles > g_schedLatency.latency.maxCycles) {
+        g_schedLatency.taskID = newTask->taskID;
+    }
+    OsSchedLatencyUpdate(&g_schedLatency.latency, cycles, runTask->taskID);
+    OsSchedLatencyUpdate(&newTask->latency, cycles, runTask->taskID);
+}
+#endif
+
 /**
  * @brief 判断是否需要进行task switch，首先把runtask插入就绪队列（如果不处于PEND_TIME,DELAY,BLOCK状态），
  *        然后选择最高优先级的任务作为newtask，如果runtask和newtask相同则不需要切换，否则，切换，
@@ -616,6 +953,7 @@ VOID OsSchedStart(VOID)
 BOOL OsSchedTaskSwitch(VOID)
 {
     UINT64 endTime;
+    UINT64 responseTime;
     BOOL isTaskSwitch = FALSE;
     LosTaskCB *runTask = g_losTask.runTask;
     // 更新runtask的时间片，减去运行的时间片，开始时间设置为当前时间
@@ -624,7 +962,13 @@ BOOL OsSchedTaskSwitch(VOID)
     // 如果任务处于pend_time或delay状态
     if (runTask->taskStatus & (OS_TASK_STATUS_PEND_TIME | OS_TASK_STATUS_DELAY)) {
         // 按task responseTime大小顺序插入g_taskSortLink有序链表，head->next 是最小的
-        OsAdd2SortLink(&runTask->sortList, runTask->startTime, runTask->waitTimes, OS_SORT_LINK_TASK);
+        responseTime = runTask->startTime + runTask->waitTimes;
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1) && (LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK > 0)
+        if (runTask->taskStatus & OS_TASK_STATUS_DELAY) {
+            responseTime = OsSwtmrAlignDelayTime(responseTime);
+        }
+#endif
+        OsAdd2SortLinkCycle(&runTask->sortList, responseTime, OS_SORT_LINK_TASK);
     } else if (!(runTask->taskStatus & OS_TASK_BLOCKED_STATUS)) { // 阻塞状态的任务不加入就绪队列
         // 将任务加入优先级队列中，如果时间片大于最小时间片，插入头部，否则插入尾部
         OsSchedTaskEnQueue(runTask);
@@ -645,6 +989,12 @@ BOOL OsSchedTaskSwitch(VOID)
         newTask->taskStatus |= OS_TASK_STATUS_RUNNING;
         newTask->startTime = runTask->startTime;   // 新任务的开始时间设置为runtask的开始时间，在599行更新过
         isTaskSwitch = TRUE;
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+        OsSchedLatencyRecord(newTask, runTask);
+#endif
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+        OsTaskStackTrack(newTask, (UINT32)(UINTPTR)newTask->stackPointer);
+#endif
 
         OsHookCall(LOS_HOOK_TYPE_TASK_SWITCHEDIN);
     }
@@ -654,7 +1004,7 @@ BOOL OsSchedTaskSwitch(VOID)
 
     // 计算newtask的运行结束时间，开始时间+时间片大小
     if (newTask->taskID != g_idleTaskID) {
-        endTime = newTask->startTime + newTask->timeSlice;
+        endTime = newTask->startTime + OsSchedTimeSliceGet(newTask);
     } else {
         endTime = OS_SCHED_MAX_RESPONSE_TIME - OS_TICK_RESPONSE_PRECISION;
     }
@@ -669,6 +1019,121 @@ BOOL OsSchedTaskSwitch(VOID)
     return isTaskSwitch;
 }
 
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+/* Called by the timer scans with interrupts masked, for every expired task or software timer */
+VOID OsSchedSlackExpired(const SortLinkList *sortList)
+{
+    g_schedSlackStat.expired++;
+    if ((g_schedWakeTime != OS_SCHED_MAX_RESPONSE_TIME) &&
+        ((sortList->responseTime + OS_TICK_RESPONSE_PRECISION) < g_schedWakeTime)) {
+        g_schedSlackStat.deferred++;
+    }
+}
+
+UINT32 LOS_SchedSlackStatGet(LOS_SCHED_SLACK_STAT_S *stat)
+{
+    UINT32 intSave;
+
+    if (stat == NULL) {
+        return LOS_NOK;
+    }
+
+    intSave = LOS_IntLock();
+    *stat = g_schedSlackStat;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+#endif
+
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+UINT32 LOS_SchedLatencyGet(UINT32 taskID, LOS_SCHED_LATENCY_S *stat)
+{
+    UINT32 intSave;
+    LosTaskCB *taskCB = NULL;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    if (OS_TSK_GET_INDEX(taskID) >= g_taskMaxNum) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCB = OS_TCB_FROM_TID(taskID);
+    intSave = LOS_IntLock();
+    if (taskCB->taskStatus & OS_TASK_STATUS_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+    *stat = taskCB->latency;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+UINT32 LOS_SchedLatencyGlobalGet(LOS_SCHED_LATENCY_GLOBAL_S *stat)
+{
+    UINT32 intSave;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    intSave = LOS_IntLock();
+    *stat = g_schedLatency;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+VOID LOS_SchedLatencyReset(VOID)
+{
+    UINT32 intSave;
+    UINT32 taskID;
+    LosTaskCB *taskCB = NULL;
+
+    intSave = LOS_IntLock();
+    (VOID)memset_s(&g_schedLatency, sizeof(g_schedLatency), 0, sizeof(g_schedLatency));
+    for (taskID = 0; taskID <= g_taskMaxNum; taskID++) {
+        taskCB = OS_TCB_FROM_TID(taskID);
+        (VOID)memset_s(&taskCB->latency, sizeof(taskCB->latency), 0, sizeof(taskCB->latency));
+    }
+    LOS_IntRestore(intSave);
+}
+
+#define OS_SCHED_CYCLE_TO_US(cycle)     ((UINT32)(OS_SYS_CYCLE_TO_NS(cycle, g_sysClock) / OS_SYS_NS_PER_US))
+
+VOID LOS_SchedLatencyShow(VOID)
+{
+    UINT32 taskID;
+    UINT32 index;
+    LOS_SCHED_LATENCY_S stat;
+    LOS_SCHED_LATENCY_GLOBAL_S global;
+
+    PRINTK("\n%-6s%-16s%-10s%-10s%-10s%-8s\n", "TID", "Name", "Count", "Max(us)", "Avg(us)", "Blocker");
+    for (taskID = 0; taskID < g_taskMaxNum; taskID++) {
+        if ((LOS_SchedLatencyGet(taskID, &stat) != LOS_OK) || (stat.count == 0)) {
+            continue;
+        }
+        PRINTK("%-6u%-16s%-10u%-10u%-10u%-8u\n", taskID, OS_TCB_FROM_TID(taskID)->taskName, stat.count,
+               OS_SCHED_CYCLE_TO_US(stat.maxCycles), OS_SCHED_CYCLE_TO_US(stat.totalCycles / stat.count),
+               stat.blockerID);
+    }
+
+    (VOID)LOS_SchedLatencyGlobalGet(&global);
+    if (global.latency.count == 0) {
+        return;
+    }
+    PRINTK("all: count %u, max %uus by task %u blocked by task %u, avg %uus\n", global.latency.count,
+           OS_SCHED_CYCLE_TO_US(global.latency.maxCycles), global.taskID, global.latency.blockerID,
+           OS_SCHED_CYCLE_TO_US(global.latency.totalCycles / global.latency.count));
+    PRINTK("hist:");
+    for (index = 0; index < LOS_SCHED_LATENCY_HIST_NUM; index++) {
+        PRINTK(" %u", global.hist[index]);
+    }
+    PRINTK("\nhist: log2 buckets of latency, the first bucket counts below %u cycles\n",
+           1U << LOS_SCHED_LATENCY_HIST_SHIFT);
+}
+#endif
+
 UINT64 LOS_SchedTickTimeoutNsGet(VOID)
 {
     UINT32 intSave;
@@ -704,11 +1169,20 @@ VOID LOS_SchedTickHandler(VOID)
     UINT32 intSave = LOS_IntLock();
     UINT64 tickStartTime = OsGetCurrSchedTimeCycle();
     if (g_schedResponseID == OS_INVALID) {
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+        g_schedWakeTime = g_schedResponseTime;
+        g_schedSlackStat.wakeups++;
+#endif
         g_tickIntLock++;
         if (g_swtmrScan != NULL) {
             // 调用软件timer的scan函数
             (VOID)g_swtmrScan();
         }
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+        if (g_workScan != NULL) {
+            (VOID)g_workScan();
+        }
+#endif
         // 检查sortlist，处理超时的任务
         (VOID)OsSchedScanTimerList();
         g_tickIntLock--;
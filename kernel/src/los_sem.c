@@ -42,6 +42,9 @@
 
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST g_unusedSemList;
 LITE_OS_SEC_BSS LosSemCB *g_allSem = NULL;
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+LITE_OS_SEC_BSS_KERNEL_CB STATIC LosSemCB g_semCBTable[LOSCFG_BASE_IPC_SEM_LIMIT];
+#endif
 
 /*****************************************************************************
  Function     : OsSemInit
@@ -62,11 +65,15 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsSemInit(VOID)
         return LOS_ERRNO_SEM_MAXNUM_ZERO;
     }
 
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+    g_allSem = g_semCBTable;
+#else
     // 申请空间，48个semCB
     g_allSem = (LosSemCB *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_SEM_LIMIT * sizeof(LosSemCB)));
     if (g_allSem == NULL) {
         return LOS_ERRNO_SEM_NO_MEMORY;
     }
+#endif
 
     // 使用数组形式初始化，semID为数组下标，状态为unused，尾插法插入空闲链表
     /* Connect all the semaphore CBs in a doubly linked list. */
@@ -228,14 +235,15 @@ STATIC_INLINE UINT32 OsSemValidCheck(LosSemCB *semPended)
 }
 
 /*****************************************************************************
- Function     : LOS_SemPend
+ Function     : OsSemPend
  Description  : Specified semaphore P operation
  Input        : semHandle --------- semaphore operation handle
-              : timeout   --------- waitting time
+              : timeout   --------- waitting time in cycles
+              : tick      --------- waitting time in ticks, reported to the hooks
  Output       : None
  Return       : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
+STATIC UINT32 OsSemPend(UINT32 semHandle, UINT64 timeout, UINT32 tick)
 {
     UINT32 intSave;
     LosSemCB *semPended = NULL;
@@ -261,7 +269,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
     if (semPended->semCount > 0) {
         semPended->semCount--;
         LOS_IntRestore(intSave);
-        OsHookCall(LOS_HOOK_TYPE_SEM_PEND, semPended, runningTask, timeout);
+        OsHookCall(LOS_HOOK_TYPE_SEM_PEND, semPended, runningTask, tick);
         return LOS_OK;
     }
     // 2. else semCount == 0
@@ -274,9 +282,9 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
     // 在当前任务的taskSem记录当前等待的semCB
     runningTask->taskSem = (VOID *)semPended;
     // 加入等待队列
-    OsSchedTaskWait(&semPended->semList, timeout);
+    OsSchedTaskWaitCycle(&semPended->semList, timeout);
     LOS_IntRestore(intSave);
-    OsHookCall(LOS_HOOK_TYPE_SEM_PEND, semPended, runningTask, timeout);
+    OsHookCall(LOS_HOOK_TYPE_SEM_PEND, semPended, runningTask, tick);
     // 主动调度,等待sem可用
     LOS_Schedule();
 
@@ -297,6 +305,18 @@ ERROR_SEM_PEND:
     OS_RETURN_ERROR(retErr);
 }
 
+LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 semHandle, UINT32 timeout)
+{
+    return OsSemPend(semHandle, OsSchedTickToWaitCycle(timeout), timeout);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_SemPendNs(UINT32 semHandle, UINT64 timeoutNs)
+{
+    UINT64 timeout = OsSchedNsToWaitCycle(timeoutNs);
+
+    return OsSemPend(semHandle, timeout, OsSchedWaitCycleToTick(timeout));
+}
+
 /*****************************************************************************
  Function     : LOS_SemPost
  Description  : Specified semaphore V operation
@@ -41,6 +41,12 @@ extern "C" {
 
 SortLinkAttribute g_taskSortLink;
 SortLinkAttribute g_swtmrSortLink;
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+SortLinkAttribute g_workSortLink;
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+SortLinkAttribute g_edfSortLink;
+#endif
 
 UINT32 OsSortLinkInit(SortLinkAttribute *sortLinkHeader)
 {
@@ -89,6 +95,17 @@ STATIC INLINE VOID OsAddNode2SortLink(SortLinkAttribute *sortLinkHeader, SortLin
 /// @param type 
 /// @return 
 VOID OsAdd2SortLink(SortLinkList *node, UINT64 startTime, UINT32 waitTicks, SortLinkType type)
+{
+    // 计算node 的 responseTime，responseTime = (startTime + (((UINT64)(waitTicks) * g_sysClock) / 1000)))
+    OsAdd2SortLinkCycle(node, startTime + OS_SYS_TICK_TO_CYCLE(waitTicks), type);
+}
+
+/// @brief 按responseTime(cycle)大小顺序插入有序链表，用于不按tick取整的超时
+/// @param node 
+/// @param responseTime 
+/// @param type 
+/// @return 
+VOID OsAdd2SortLinkCycle(SortLinkList *node, UINT64 responseTime, SortLinkType type)
 {
     UINT32 intSave;
     SortLinkAttribute *sortLinkHeader = NULL;
@@ -97,13 +114,20 @@ VOID OsAdd2SortLink(SortLinkList *node, UINT64 startTime, UINT32 waitTicks, Sort
         sortLinkHeader = &g_taskSortLink;
     } else if (type == OS_SORT_LINK_SWTMR) {
         sortLinkHeader = &g_swtmrSortLink;
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+    } else if (type == OS_SORT_LINK_WORK) {
+        sortLinkHeader = &g_workSortLink;
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    } else if (type == OS_SORT_LINK_EDF) {
+        sortLinkHeader = &g_edfSortLink;
+#endif
     } else {
         LOS_Panic("Sort link type error : %u\n", type);
     }
 
     intSave = LOS_IntLock();
-    // 计算node 的 responseTime，responseTime = (startTime + (((UINT64)(waitTicks) * g_sysClock) / 1000)))
-    SET_SORTLIST_VALUE(node, startTime + OS_SYS_TICK_TO_CYCLE(waitTicks));
+    SET_SORTLIST_VALUE(node, responseTime);
     // 按responseTime大小顺序插入链表，head->next 是最小的
     OsAddNode2SortLink(sortLinkHeader, node);
     LOS_IntRestore(intSave);
@@ -139,6 +163,14 @@ SortLinkAttribute *OsGetSortLinkAttribute(SortLinkType type)
         return &g_taskSortLink;
     } else if (type == OS_SORT_LINK_SWTMR) {
         return &g_swtmrSortLink;
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+    } else if (type == OS_SORT_LINK_WORK) {
+        return &g_workSortLink;
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    } else if (type == OS_SORT_LINK_EDF) {
+        return &g_edfSortLink;
+#endif
     }
 
     PRINT_ERR("Invalid sort link type!\n");
@@ -42,8 +42,10 @@
 
 #if (LOSCFG_BASE_CORE_SWTMR == 1)
 
-LITE_OS_SEC_BSS UINT32            g_swtmrHandlerQueue;           /* Software Timer timeout queue ID */
 LITE_OS_SEC_BSS SWTMR_CTRL_S      *g_swtmrCBArray = NULL;        /* first address in Timer memory space */
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+LITE_OS_SEC_BSS_KERNEL_CB STATIC SWTMR_CTRL_S g_swtmrCBTable[LOSCFG_BASE_CORE_SWTMR_LIMIT];
+#endif
 LITE_OS_SEC_BSS SWTMR_CTRL_S      *g_swtmrFreeList = NULL;       /* Free list of Software Timer */
 LITE_OS_SEC_BSS SortLinkAttribute *g_swtmrSortLinkList = NULL;       /* The software timer count list */
 
@@ -56,66 +58,135 @@ typedef struct SwtmrAlignDataStr {
     UINT32 isAligned : 1;
 } SwtmrAlignData;
 LITE_OS_SEC_BSS SwtmrAlignData      g_swtmrAlignID[LOSCFG_BASE_CORE_SWTMR_LIMIT] = {0};   /* store swtmr align */
+
+#define OS_SWTMR_ALIGN_HASH_SIZE        16
+#define OS_SWTMR_ALIGN_HASH(interval)   ((interval) & (OS_SWTMR_ALIGN_HASH_SIZE - 1))
+#define OS_SWTMR_ALIGN_RATIO_MIN        2
+#define OS_SWTMR_ALIGN_RATIO_MAX        16   /* Largest interval ratio searched by multiple alignment */
+#define OS_SWTMR_ALIGN_DELAY_SCAN_MAX   4    /* Timer timeouts a task delay is compared against */
+
+/* Aligned ticking timers indexed by interval, so that starting a timer does not scan the sort link */
+typedef struct {
+    LOS_DL_LIST list;       /* Hash chain or free list */
+    UINT32      interval;
+    UINT32      count;      /* Aligned ticking timers of this interval */
+    UINT32      times;      /* Interval in LOS_COMMON_DIVISOR units, 0 if the group takes no multiple alignment */
+    UINT64      anchor;     /* The timeouts of the group fall on anchor + n * interval */
+} SwtmrAlignBucket;
+
+LITE_OS_SEC_BSS STATIC SwtmrAlignBucket g_swtmrAlignBucket[LOSCFG_BASE_CORE_SWTMR_LIMIT];
+LITE_OS_SEC_BSS STATIC LOS_DL_LIST      g_swtmrAlignHash[OS_SWTMR_ALIGN_HASH_SIZE];
+LITE_OS_SEC_BSS STATIC LOS_DL_LIST      g_swtmrAlignFree;
 #endif
 
 #define SWTMR_MAX_RUNNING_TICKS 2
 #define OS_SWTMR_MAX_TIMERID    ((0xFFFFFFFF / LOSCFG_BASE_CORE_SWTMR_LIMIT) * LOSCFG_BASE_CORE_SWTMR_LIMIT)
 
+#if (LOSCFG_BASE_CORE_SWTMR_BACKGROUND == 1)
+#define OS_SWTMR_TIER_TASK_NUM  LOS_SWTMR_TIER_NUM
+#else
+#define OS_SWTMR_TIER_TASK_NUM  1
+#endif
+/* The tier ring holds the timeouts, so one pending message is enough to wake the task */
+#define OS_SWTMR_TIER_QUEUE_SIZE 1
+
+typedef struct {
+    SwtmrHandlerItem  item[OS_SWTMR_HANDLE_QUEUE_SIZE];   /* Ring of pending timeouts */
+    UINT16            head;
+    UINT16            count;
+    UINT16            batch;                              /* Timeouts added by the current scan */
+    UINT32            queueID;                            /* Queue waking the tier task */
+    UINT32            taskID;
+    SWTMR_TIER_STAT_S stat;
+} OsSwtmrTier;
+
+LITE_OS_SEC_BSS STATIC OsSwtmrTier g_swtmrTier[OS_SWTMR_TIER_TASK_NUM];
+
 STATIC VOID OsSwtmrDelete(SWTMR_CTRL_S *swtmr);
 
+STATIC BOOL OsSwtmrTierPop(OsSwtmrTier *tier, SwtmrHandlerItem *swtmrHandle)
+{
+    UINT32 intSave = LOS_IntLock();
+    if (tier->count == 0) {
+        LOS_IntRestore(intSave);
+        return FALSE;
+    }
+
+    *swtmrHandle = tier->item[tier->head];
+    tier->head = (tier->head + 1) % OS_SWTMR_HANDLE_QUEUE_SIZE;
+    tier->count--;
+    LOS_IntRestore(intSave);
+    return TRUE;
+}
+
+STATIC VOID OsSwtmrHandlerRun(OsSwtmrTier *tier, const SwtmrHandlerItem *swtmrHandle)
+{
+    SWTMR_CTRL_S *swtmr = NULL;
+    UINT32 intSave;
+    UINT64 tick;
+
+    if ((swtmrHandle->handler == NULL) || (swtmrHandle->swtmrID >= OS_SWTMR_MAX_TIMERID)) {
+        return;
+    }
+
+    intSave = LOS_IntLock();
+    swtmr = g_swtmrCBArray + swtmrHandle->swtmrID % LOSCFG_BASE_CORE_SWTMR_LIMIT;
+    if (swtmr->usTimerID != swtmrHandle->swtmrID) {
+        LOS_IntRestore(intSave);
+        return;
+    }
+    if (swtmr->ucMode == LOS_SWTMR_MODE_ONCE) {
+        OsSwtmrDelete(swtmr);
+    }
+    tier->stat.dispatched++;
+    if ((OsGetCurrSchedTimeCycle() - swtmrHandle->expireTime) >= OS_SYS_TICK_TO_CYCLE(1)) {
+        tier->stat.late++;
+    }
+    LOS_IntRestore(intSave);
+
+    tick = LOS_TickCountGet();
+    swtmrHandle->handler(swtmrHandle->arg);
+    tick = LOS_TickCountGet() - tick;
+
+    if (tick >= SWTMR_MAX_RUNNING_TICKS) {
+        PRINT_WARN("timer_handler(%p) cost too many ms(%d)\n",
+                   swtmrHandle->handler,
+                   (UINT32)((tick * OS_SYS_MS_PER_SECOND) / LOSCFG_BASE_CORE_TICK_PER_SECOND));
+    }
+}
+
 /*****************************************************************************
 Function    : OsSwtmrTask
-Description : Swtmr task main loop, handle time-out timer.
-Input       : None
+Description : Swtmr task main loop, handle the time-out timers of one tier.
+Input       : tierID --- Tier served by this task
 Output      : None
 Return      : None
 *****************************************************************************/
-LITE_OS_SEC_TEXT VOID OsSwtmrTask(VOID)
+LITE_OS_SEC_TEXT VOID OsSwtmrTask(UINT32 tierID)
 {
+    OsSwtmrTier *tier = &g_swtmrTier[tierID];
     SwtmrHandlerItem swtmrHandle;
-    SWTMR_CTRL_S *swtmr = NULL;
-    UINT32 intSave;
+    UINT32 batch;
     UINT32 readSize;
     UINT32 ret;
-    UINT64 tick;
 
     for (;;) {
-        readSize = sizeof(SwtmrHandlerItem);
-        // g_swtmrHandlerQueue在OsSwtmrInit被赋值，表示其管理的队列ID
-        // LOS_WAIT_FOREVER表示，如果队列为空，进入阻塞状态，加入等待队列，直到被唤醒
-        ret = LOS_QueueReadCopy(g_swtmrHandlerQueue, &swtmrHandle, &readSize, LOS_WAIT_FOREVER);
-        if ((ret == LOS_OK) && (readSize == sizeof(SwtmrHandlerItem))) {
-            if ((swtmrHandle.handler == NULL) || (swtmrHandle.swtmrID >= OS_SWTMR_MAX_TIMERID)) {
-                continue;
-            }
-
-            intSave = LOS_IntLock();
-            swtmr = g_swtmrCBArray + swtmrHandle.swtmrID % LOSCFG_BASE_CORE_SWTMR_LIMIT;
-            if (swtmr->usTimerID != swtmrHandle.swtmrID) {
-                LOS_IntRestore(intSave);
-                continue;
-            }
-            if (swtmr->ucMode == LOS_SWTMR_MODE_ONCE) {
-                OsSwtmrDelete(swtmr);
-            }
-            LOS_IntRestore(intSave);
-
-            tick = LOS_TickCountGet();
-            swtmrHandle.handler(swtmrHandle.arg);
-            tick = LOS_TickCountGet() - tick;
+        readSize = sizeof(UINT32);
+        /* One message per scan, the task then drains every timeout pending on its tier */
+        ret = LOS_QueueReadCopy(tier->queueID, &batch, &readSize, LOS_WAIT_FOREVER);
+        if (ret != LOS_OK) {
+            continue;
+        }
 
-            if (tick >= SWTMR_MAX_RUNNING_TICKS) {
-                PRINT_WARN("timer_handler(%p) cost too many ms(%d)\n",
-                           swtmrHandle.handler,
-                           (UINT32)((tick * OS_SYS_MS_PER_SECOND) / LOSCFG_BASE_CORE_TICK_PER_SECOND));
-            }
+        while (OsSwtmrTierPop(tier, &swtmrHandle)) {
+            OsSwtmrHandlerRun(tier, &swtmrHandle);
         }
     }
 }
 
 /*****************************************************************************
 Function    : OsSwtmrTaskCreate
-Description : Create Software Timer
+Description : Create the Software Timer tasks
 Input       : None
 Output      : None
 Return      : LOS_OK on success or error code on failure
@@ -123,102 +194,185 @@ Return      : LOS_OK on success or error code on failure
 LITE_OS_SEC_TEXT_INIT UINT32 OsSwtmrTaskCreate(VOID)
 {
     UINT32 ret;
+    UINT32 tierID;
     TSK_INIT_PARAM_S swtmrTask;
+    STATIC CHAR *const taskName[] = { "Swt_Task", "Swt_Bg_Task" };
+    STATIC const UINT16 taskPrio[] = { 0, LOSCFG_BASE_CORE_SWTMR_BACKGROUND_PRIO };
+
+    for (tierID = 0; tierID < OS_SWTMR_TIER_TASK_NUM; tierID++) {
+        // Ignore the return code when matching CSEC rule 6.6(4).
+        (VOID)memset_s(&swtmrTask, sizeof(TSK_INIT_PARAM_S), 0, sizeof(TSK_INIT_PARAM_S));
+
+        swtmrTask.pfnTaskEntry    = (TSK_ENTRY_FUNC)OsSwtmrTask;
+        swtmrTask.uwStackSize     = LOSCFG_BASE_CORE_TSK_SWTMR_STACK_SIZE;
+        swtmrTask.pcName          = taskName[tierID];
+        swtmrTask.usTaskPrio      = taskPrio[tierID];
+        swtmrTask.uwArg           = tierID;
+        ret = LOS_TaskCreate(&g_swtmrTier[tierID].taskID, &swtmrTask);
+        if (ret != LOS_OK) {
+            return ret;
+        }
+        OS_TCB_FROM_TID(g_swtmrTier[tierID].taskID)->taskStatus |= OS_TASK_FLAG_SYSTEM_TASK;
+    }
 
-    // Ignore the return code when matching CSEC rule 6.6(4).
-    (VOID)memset_s(&swtmrTask, sizeof(TSK_INIT_PARAM_S), 0, sizeof(TSK_INIT_PARAM_S));
+    g_swtmrTaskID = g_swtmrTier[LOS_SWTMR_TIER_HIGH].taskID;
+    return LOS_OK;
+}
 
-    swtmrTask.pfnTaskEntry    = (TSK_ENTRY_FUNC)OsSwtmrTask;
-    swtmrTask.uwStackSize     = LOSCFG_BASE_CORE_TSK_SWTMR_STACK_SIZE;
-    swtmrTask.pcName          = "Swt_Task";
-    swtmrTask.usTaskPrio      = 0;
-    ret = LOS_TaskCreate(&g_swtmrTaskID, &swtmrTask);
-    if (ret == LOS_OK) {
-        OS_TCB_FROM_TID(g_swtmrTaskID)->taskStatus |= OS_TASK_FLAG_SYSTEM_TASK;
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
+STATIC VOID OsSwtmrAlignIndexInit(VOID)
+{
+    UINT32 index;
+
+    LOS_ListInit(&g_swtmrAlignFree);
+    for (index = 0; index < OS_SWTMR_ALIGN_HASH_SIZE; index++) {
+        LOS_ListInit(&g_swtmrAlignHash[index]);
+    }
+
+    for (index = 0; index < LOSCFG_BASE_CORE_SWTMR_LIMIT; index++) {
+        LOS_ListTailInsert(&g_swtmrAlignFree, &g_swtmrAlignBucket[index].list);
     }
-    return ret;
 }
 
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
-STATIC UINT64 OsSwtmrCalcStartTime(UINT64 currTime, SWTMR_CTRL_S *swtmr, const SWTMR_CTRL_S *alignSwtmr)
+STATIC SwtmrAlignBucket *OsSwtmrAlignBucketFind(UINT32 interval)
+{
+    SwtmrAlignBucket *bucket = NULL;
+
+    LOS_DL_LIST_FOR_EACH_ENTRY(bucket, &g_swtmrAlignHash[OS_SWTMR_ALIGN_HASH(interval)], SwtmrAlignBucket, list) {
+        if (bucket->interval == interval) {
+            return bucket;
+        }
+    }
+
+    return NULL;
+}
+
+/* The first aligned timer of an interval anchors the group, later ones share its timeouts */
+STATIC VOID OsSwtmrAlignJoin(const SWTMR_CTRL_S *swtmr)
+{
+    SwtmrAlignBucket *bucket = OsSwtmrAlignBucketFind(swtmr->uwInterval);
+
+    if (bucket == NULL) {
+        if (LOS_ListEmpty(&g_swtmrAlignFree)) {
+            return;
+        }
+        bucket = LOS_DL_LIST_ENTRY(g_swtmrAlignFree.pstNext, SwtmrAlignBucket, list);
+        LOS_ListDelete(&bucket->list);
+        bucket->interval = swtmr->uwInterval;
+        bucket->count = 0;
+        bucket->times = g_swtmrAlignID[swtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT].times;
+        bucket->anchor = swtmr->startTime;
+        LOS_ListTailInsert(&g_swtmrAlignHash[OS_SWTMR_ALIGN_HASH(bucket->interval)], &bucket->list);
+    }
+    bucket->count++;
+}
+
+STATIC VOID OsSwtmrAlignLeave(const SWTMR_CTRL_S *swtmr)
+{
+    SwtmrAlignData *alignData = &g_swtmrAlignID[swtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT];
+    SwtmrAlignBucket *bucket = NULL;
+
+    if (alignData->isAligned == 0) {
+        return;
+    }
+    alignData->isAligned = 0;
+
+    bucket = OsSwtmrAlignBucketFind(swtmr->uwInterval);
+    if (bucket == NULL) {
+        return;
+    }
+
+    bucket->count--;
+    if (bucket->count == 0) {
+        LOS_ListDelete(&bucket->list);
+        LOS_ListTailInsert(&g_swtmrAlignFree, &bucket->list);
+    }
+}
+
+STATIC UINT64 OsSwtmrCalcStartTime(UINT64 currTime, const SWTMR_CTRL_S *swtmr, const SwtmrAlignBucket *bucket)
 {
-    UINT64 usedTime, startTime;
-    UINT64 alignEnd = OS_SYS_TICK_TO_CYCLE(alignSwtmr->uwInterval);
     UINT64 swtmrTime = OS_SYS_TICK_TO_CYCLE(swtmr->uwInterval);
-    UINT64 remainTime = OsSortLinkGetRemainTime(currTime, &alignSwtmr->stSortList);
-    if (remainTime == 0) {
-        startTime = GET_SORTLIST_VALUE(&alignSwtmr->stSortList);
-    } else {
-        usedTime = alignEnd - remainTime;
-        startTime = alignSwtmr->startTime + (usedTime / swtmrTime) * swtmrTime;
+
+    if (currTime <= bucket->anchor) {
+        return bucket->anchor;
     }
 
-    return startTime;
+    return bucket->anchor + ((currTime - bucket->anchor) / swtmrTime) * swtmrTime;
 }
 
 UINT64 OsSwtmrFindAlignPos(UINT64 currTime, SWTMR_CTRL_S *swtmr)
 {
-    SWTMR_CTRL_S *minInLarge = (SWTMR_CTRL_S *)NULL;
-    SWTMR_CTRL_S *maxInLittle = (SWTMR_CTRL_S *)NULL;
-    UINT32 minInLargeVal = OS_NULL_INT;
-    UINT32 maxInLittleVal = OS_NULL_INT;
-    LOS_DL_LIST *listHead = &g_swtmrSortLinkList->sortLink;
     SwtmrAlignData swtmrAlgInfo = g_swtmrAlignID[swtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT];
-    LOS_DL_LIST *listObject = listHead->pstNext;
+    SwtmrAlignBucket *bucket = NULL;
+    UINT32 ratio;
 
-    if (LOS_ListEmpty(listHead)) {
-        goto RETURN_PERIOD;
+    /* find same interval timer, directly return */
+    bucket = OsSwtmrAlignBucketFind(swtmr->uwInterval);
+    if (bucket != NULL) {
+        return OsSwtmrCalcStartTime(currTime, swtmr, bucket);
     }
 
-    do {
-        SortLinkList *sortList = LOS_DL_LIST_ENTRY(listObject, SortLinkList, sortLinkNode);
-        SWTMR_CTRL_S *swtmrListNode = LOS_DL_LIST_ENTRY(sortList, SWTMR_CTRL_S, stSortList);
-        SwtmrAlignData alignListNode = g_swtmrAlignID[swtmrListNode->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT];
+    if ((swtmrAlgInfo.canMultiple != 1) || (swtmrAlgInfo.times == 0)) {
+        return currTime;
+    }
 
-        /* swtmr not start */
-        if ((alignListNode.isAligned == 0) || (alignListNode.canAlign == 0)) {
-            goto CONTINUE_NEXT_NODE;
+    /* prefer the smallest multiple of the interval, then the largest divisor */
+    for (ratio = OS_SWTMR_ALIGN_RATIO_MIN; ratio <= OS_SWTMR_ALIGN_RATIO_MAX; ratio++) {
+        if (swtmr->uwInterval > (OS_NULL_INT / ratio)) {
+            break;
         }
-
-        /* find same interval timer, directly return */
-        if (swtmrListNode->uwInterval == swtmr->uwInterval) {
-            return OsSwtmrCalcStartTime(currTime, swtmr, swtmrListNode);
+        bucket = OsSwtmrAlignBucketFind(swtmr->uwInterval * ratio);
+        if ((bucket != NULL) && (bucket->times != 0)) {
+            return OsSwtmrCalcStartTime(currTime, swtmr, bucket);
         }
+    }
 
-        if ((swtmrAlgInfo.canMultiple != 1) || (alignListNode.times == 0)) {
-            goto CONTINUE_NEXT_NODE;
+    for (ratio = OS_SWTMR_ALIGN_RATIO_MIN; ratio <= OS_SWTMR_ALIGN_RATIO_MAX; ratio++) {
+        if ((swtmrAlgInfo.times % ratio) != 0) {
+            continue;
         }
-
-        if (swtmrAlgInfo.times == 0) {
-            goto RETURN_PERIOD;
+        bucket = OsSwtmrAlignBucketFind(swtmr->uwInterval / ratio);
+        if ((bucket != NULL) && (bucket->times != 0)) {
+            return OsSwtmrCalcStartTime(currTime, swtmr, bucket);
         }
+    }
 
-        if ((alignListNode.times >= swtmrAlgInfo.times) && ((alignListNode.times % swtmrAlgInfo.times) == 0)) {
-            if (minInLargeVal > (alignListNode.times / swtmrAlgInfo.times)) {
-                minInLargeVal = alignListNode.times / swtmrAlgInfo.times;
-                minInLarge = swtmrListNode;
-            }
-        } else if ((alignListNode.times < swtmrAlgInfo.times) && ((swtmrAlgInfo.times % alignListNode.times) == 0)) {
-            if (maxInLittleVal > (swtmrAlgInfo.times / alignListNode.times)) {
-                maxInLittleVal = swtmrAlgInfo.times / alignListNode.times;
-                maxInLittle = swtmrListNode;
+    return currTime;
+}
+
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK > 0)
+/*****************************************************************************
+Function    : OsSwtmrAlignDelayTime
+Description : Defer a task delay onto a timer timeout falling within the slack window,
+              so that both are served by one wakeup. Runs in the task switch path with
+              interrupts masked, so only the earliest timeouts are looked at
+Input       : responseTime --- Response time of the task delay
+Output      : None
+Return      : Response time to use for the task delay
+*****************************************************************************/
+UINT64 OsSwtmrAlignDelayTime(UINT64 responseTime)
+{
+    UINT64 slack = OS_SYS_TICK_TO_CYCLE(LOSCFG_BASE_CORE_SWTMR_ALIGN_SLACK);
+    LOS_DL_LIST *listHead = &g_swtmrSortLinkList->sortLink;
+    LOS_DL_LIST *listObject = listHead->pstNext;
+    UINT32 scan = 0;
+
+    while ((listObject != listHead) && (scan < OS_SWTMR_ALIGN_DELAY_SCAN_MAX)) {
+        SortLinkList *sortList = LOS_DL_LIST_ENTRY(listObject, SortLinkList, sortLinkNode);
+        if (sortList->responseTime >= responseTime) {
+            if ((sortList->responseTime - responseTime) <= slack) {
+                return sortList->responseTime;
             }
+            break;
         }
-
-CONTINUE_NEXT_NODE:
         listObject = listObject->pstNext;
-    } while (listObject != listHead);
-
-    if (minInLarge != NULL) {
-        return OsSwtmrCalcStartTime(currTime, swtmr, minInLarge);
-    } else if (maxInLittle != NULL) {
-        return OsSwtmrCalcStartTime(currTime, swtmr, maxInLittle);
+        scan++;
     }
 
-RETURN_PERIOD:
-    return currTime;
+    return responseTime;
 }
 #endif
+#endif
 
 /*****************************************************************************
 Function    : OsSwtmrStart
@@ -237,6 +391,7 @@ LITE_OS_SEC_TEXT VOID OsSwtmrStart(UINT64 currTime, SWTMR_CTRL_S *swtmr)
         (g_swtmrAlignID[swtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT].isAligned == 0)) {
         g_swtmrAlignID[swtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT].isAligned = 1;
         swtmr->startTime = OsSwtmrFindAlignPos(currTime, swtmr);
+        OsSwtmrAlignJoin(swtmr);
     }
 #endif
     OsAdd2SortLink(&swtmr->stSortList, swtmr->startTime, swtmr->uwInterval, OS_SORT_LINK_SWTMR);
@@ -283,21 +438,32 @@ LITE_OS_SEC_TEXT VOID OsSwtmrStop(SWTMR_CTRL_S *swtmr)
     swtmr->ucOverrun = 0;
     OsSchedUpdateExpireTime();
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
-    g_swtmrAlignID[swtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT].isAligned = 0;
+    OsSwtmrAlignLeave(swtmr);
 #endif
 }
 
-STATIC VOID OsSwtmrTimeoutHandle(UINT64 currTime, SWTMR_CTRL_S *swtmr)
+STATIC INLINE OsSwtmrTier *OsSwtmrTierGet(const SWTMR_CTRL_S *swtmr)
 {
-    SwtmrHandlerItem swtmrHandler;
-
-    // swtmr 赋值给 swtmrHandler
-    swtmrHandler.handler = swtmr->pfnHandler;
-    swtmrHandler.arg = swtmr->uwArg;
-    swtmrHandler.swtmrID = swtmr->usTimerID;
+    return &g_swtmrTier[(swtmr->ucTier < OS_SWTMR_TIER_TASK_NUM) ? swtmr->ucTier : LOS_SWTMR_TIER_HIGH];
+}
 
-    // 将swtmrHandler写入swtmr维护的消息队列
-    (VOID)LOS_QueueWriteCopy(g_swtmrHandlerQueue, &swtmrHandler, sizeof(SwtmrHandlerItem), LOS_NO_WAIT);
+STATIC VOID OsSwtmrTimeoutHandle(UINT64 currTime, SWTMR_CTRL_S *swtmr)
+{
+    OsSwtmrTier *tier = OsSwtmrTierGet(swtmr);
+    SwtmrHandlerItem *swtmrHandler = NULL;
+
+    // 将超时记录追加到该timer所属层级的环形缓冲区，由OsSwtmrScan统一通知处理任务
+    if (tier->count < OS_SWTMR_HANDLE_QUEUE_SIZE) {
+        swtmrHandler = &tier->item[(tier->head + tier->count) % OS_SWTMR_HANDLE_QUEUE_SIZE];
+        swtmrHandler->handler = swtmr->pfnHandler;
+        swtmrHandler->arg = swtmr->uwArg;
+        swtmrHandler->swtmrID = swtmr->usTimerID;
+        swtmrHandler->expireTime = swtmr->startTime;
+        tier->count++;
+        tier->batch++;
+    } else {
+        tier->stat.dropped++;
+    }
     // 如果该timer是一个周期性的任务，则把该timer加入到g_swtmrSortLink有序链表中
     if (swtmr->ucMode == LOS_SWTMR_MODE_PERIOD) {
         swtmr->ucOverrun++;
@@ -307,6 +473,29 @@ STATIC VOID OsSwtmrTimeoutHandle(UINT64 currTime, SWTMR_CTRL_S *swtmr)
     }
 }
 
+/* Hand all timeouts collected by one scan over to each tier task with a single message */
+STATIC VOID OsSwtmrTierNotify(VOID)
+{
+    OsSwtmrTier *tier = NULL;
+    UINT32 batch;
+    UINT32 tierID;
+
+    for (tierID = 0; tierID < OS_SWTMR_TIER_TASK_NUM; tierID++) {
+        tier = &g_swtmrTier[tierID];
+        if (tier->batch == 0) {
+            continue;
+        }
+
+        batch = tier->batch;
+        tier->batch = 0;
+        if (batch > tier->stat.maxBatch) {
+            tier->stat.maxBatch = batch;
+        }
+        /* A message still pending means the task has not drained the ring yet */
+        (VOID)LOS_QueueWriteCopy(tier->queueID, &batch, sizeof(UINT32), LOS_NO_WAIT);
+    }
+}
+
 STATIC BOOL OsSwtmrScan(VOID)
 {
     BOOL needSchedule = FALSE;
@@ -324,6 +513,9 @@ STATIC BOOL OsSwtmrScan(VOID)
         SWTMR_CTRL_S *swtmr = LOS_DL_LIST_ENTRY(sortList, SWTMR_CTRL_S, stSortList);
         swtmr->startTime = GET_SORTLIST_VALUE(sortList);
 
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+        OsSchedSlackExpired(sortList);
+#endif
         OsDeleteNodeSortLink(sortList);
         OsHookCall(LOS_HOOK_TYPE_SWTMR_EXPIRED, swtmr);
         // 对swtmr进行超时处理
@@ -337,6 +529,9 @@ STATIC BOOL OsSwtmrScan(VOID)
         sortList = LOS_DL_LIST_ENTRY(listObject->pstNext, SortLinkList, sortLinkNode);
     }
 
+    if (needSchedule) {
+        OsSwtmrTierNotify();
+    }
     return needSchedule;
 }
 
@@ -345,6 +540,10 @@ LITE_OS_SEC_TEXT VOID OsSwtmrResponseTimeReset(UINT64 startTime)
     LOS_DL_LIST *listHead = &g_swtmrSortLinkList->sortLink;
     LOS_DL_LIST *listNext = listHead->pstNext;
 
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
+    /* The anchors belong to the previous time base, every timer aligns again */
+    OsSwtmrAlignIndexInit();
+#endif
     while (listNext != listHead) {
         SortLinkList *sortList = LOS_DL_LIST_ENTRY(listNext, SortLinkList, sortLinkNode);
         SWTMR_CTRL_S *swtmr = LOS_DL_LIST_ENTRY(sortList, SWTMR_CTRL_S, stSortList);
@@ -405,8 +604,14 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsSwtmrInit(VOID)
     // g_swtmrAlignID初始化为0值
     (VOID)memset_s((VOID *)g_swtmrAlignID, sizeof(SwtmrAlignData) * LOSCFG_BASE_CORE_SWTMR_LIMIT,
                    0, sizeof(SwtmrAlignData) * LOSCFG_BASE_CORE_SWTMR_LIMIT);
+    OsSwtmrAlignIndexInit();
 #endif
 
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+    (VOID)size;
+    /* The static table is zeroed by the startup code. */
+    SWTMR_CTRL_S *swtmr = g_swtmrCBTable;
+#else
     size = sizeof(SWTMR_CTRL_S) * LOSCFG_BASE_CORE_SWTMR_LIMIT;
     // 为swtmr 申请空间，6个结构体大小的空间
     SWTMR_CTRL_S *swtmr = (SWTMR_CTRL_S *)LOS_MemAlloc(m_aucSysMem0, size);
@@ -416,6 +621,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsSwtmrInit(VOID)
     // Ignore the return code when matching CSEC rule 6.6(3).
     // 初始化为0值
     (VOID)memset_s((VOID *)swtmr, size, 0, size);
+#endif
     g_swtmrCBArray = swtmr;
     g_swtmrFreeList = swtmr;
     swtmr->usTimerID = 0;
@@ -428,12 +634,17 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsSwtmrInit(VOID)
         temp = swtmr;
     }
 
-    // 初始化1个队列，队列中的包含一个读链表和一个写链表，g_swtmrHandlerQueue记录队列的ID
-    ret = LOS_QueueCreate((CHAR *)NULL, OS_SWTMR_HANDLE_QUEUE_SIZE,
-                          &g_swtmrHandlerQueue, 0, sizeof(SwtmrHandlerItem));
-    if (ret != LOS_OK) {
-        (VOID)LOS_MemFree(m_aucSysMem0, swtmr);
-        return LOS_ERRNO_SWTMR_QUEUE_CREATE_FAILED;
+    // 每个层级创建1个队列，用于唤醒该层级的处理任务
+    (VOID)memset_s((VOID *)g_swtmrTier, sizeof(g_swtmrTier), 0, sizeof(g_swtmrTier));
+    for (index = 0; index < OS_SWTMR_TIER_TASK_NUM; index++) {
+        ret = LOS_QueueCreate((CHAR *)NULL, OS_SWTMR_TIER_QUEUE_SIZE,
+                              &g_swtmrTier[index].queueID, 0, sizeof(UINT32));
+        if (ret != LOS_OK) {
+#if (LOSCFG_KERNEL_STATIC_CB == 0)
+            (VOID)LOS_MemFree(m_aucSysMem0, g_swtmrCBArray);
+#endif
+            return LOS_ERRNO_SWTMR_QUEUE_CREATE_FAILED;
+        }
     }
 
     ret = OsSwtmrTaskCreate();
@@ -541,8 +752,12 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SwtmrCreate(UINT32 interval,
 #endif
     swtmr->ucState       = OS_SWTMR_STATUS_CREATED;
     swtmr->ucOverrun     = 0;
+    swtmr->ucTier        = LOS_SWTMR_TIER_HIGH;
     *swtmrId = swtmr->usTimerID;
     SET_SORTLIST_VALUE(&swtmr->stSortList, OS_SORT_LINK_INVALID_TIME);
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+    swtmr->stSortList.slack = OsSchedSlackUsToCycle(LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US);
+#endif
     OsHookCall(LOS_HOOK_TYPE_SWTMR_CREATE, swtmr);
     return LOS_OK;
 }
@@ -732,4 +947,96 @@ LITE_OS_SEC_TEXT UINT32 LOS_SwtmrDelete(UINT32 swtmrId)
     return ret;
 }
 
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+/*****************************************************************************
+Function    : LOS_SwtmrSlackSet
+Description : Set how late a software timer may expire to share a wakeup
+Input       : swtmrId ------- Software timer ID
+              slackUs ------- Slack in microseconds
+Output      : None
+Return      : LOS_OK on success or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_SwtmrSlackSet(UINT32 swtmrId, UINT32 slackUs)
+{
+    SWTMR_CTRL_S *swtmr = NULL;
+    UINT32 intSave;
+
+    if (swtmrId >= OS_SWTMR_MAX_TIMERID) {
+        return LOS_ERRNO_SWTMR_ID_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    swtmr = g_swtmrCBArray + swtmrId % LOSCFG_BASE_CORE_SWTMR_LIMIT;
+    if ((swtmr->usTimerID != swtmrId) || (swtmr->ucState == OS_SWTMR_STATUS_UNUSED)) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_SWTMR_NOT_CREATED;
+    }
+    swtmr->stSortList.slack = OsSchedSlackUsToCycle(slackUs);
+    OsSchedUpdateExpireTime();
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+#endif
+
+/*****************************************************************************
+Function    : LOS_SwtmrTierSet
+Description : Select the timer task tier of a software timer
+Input       : swtmrId ------- Software timer ID
+              tier ---------- Software timer tier
+Output      : None
+Return      : LOS_OK on success or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_SwtmrTierSet(UINT32 swtmrId, UINT8 tier)
+{
+    SWTMR_CTRL_S *swtmr = NULL;
+    UINT32 intSave;
+
+    if (swtmrId >= OS_SWTMR_MAX_TIMERID) {
+        return LOS_ERRNO_SWTMR_ID_INVALID;
+    }
+
+    if (tier >= LOS_SWTMR_TIER_NUM) {
+        return LOS_ERRNO_SWTMR_TIER_INVALID;
+    }
+
+    intSave = LOS_IntLock();
+    swtmr = g_swtmrCBArray + swtmrId % LOSCFG_BASE_CORE_SWTMR_LIMIT;
+    if ((swtmr->usTimerID != swtmrId) || (swtmr->ucState == OS_SWTMR_STATUS_UNUSED)) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_SWTMR_NOT_CREATED;
+    }
+    swtmr->ucTier = tier;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+/*****************************************************************************
+Function    : LOS_SwtmrTierStatGet
+Description : Get the timeout statistics of a software timer tier
+Input       : tier ---------- Software timer tier
+Output      : stat
+Return      : LOS_OK on success or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_SwtmrTierStatGet(UINT8 tier, SWTMR_TIER_STAT_S *stat)
+{
+    UINT32 intSave;
+
+    if (tier >= LOS_SWTMR_TIER_NUM) {
+        return LOS_ERRNO_SWTMR_TIER_INVALID;
+    }
+
+    if (stat == NULL) {
+        return LOS_ERRNO_SWTMR_RET_PTR_NULL;
+    }
+
+    if (tier >= OS_SWTMR_TIER_TASK_NUM) {
+        tier = LOS_SWTMR_TIER_HIGH;
+    }
+
+    intSave = LOS_IntLock();
+    *stat = g_swtmrTier[tier].stat;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
 #endif /* (LOSCFG_BASE_CORE_SWTMR == 1) */
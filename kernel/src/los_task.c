@@ -47,6 +47,9 @@
 #if (LOSCFG_KERNEL_PM == 1)
 #include "los_pm.h"
 #endif
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+#include "los_irqstat.h"
+#endif
 
 /**
  * @ingroup los_task
@@ -98,6 +101,10 @@
 #endif
 
 LITE_OS_SEC_BSS  LosTaskCB                           *g_taskCBArray = NULL;
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+/* Reserved 1 for IDLE and 1 for the dummy running task before the scheduler starts. */
+LITE_OS_SEC_BSS_KERNEL_CB STATIC LosTaskCB g_taskCBTable[LOSCFG_BASE_CORE_TSK_LIMIT + 2];
+#endif
 LITE_OS_SEC_BSS  LosTask                             g_losTask;
 LITE_OS_SEC_BSS  UINT16                              g_losTaskLock;
 LITE_OS_SEC_BSS  UINT32                              g_taskMaxNum;
@@ -107,6 +114,28 @@ LITE_OS_SEC_DATA_INIT LOS_DL_LIST                    g_losFreeTask;
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST                    g_taskRecycleList;
 LITE_OS_SEC_BSS  BOOL                                g_taskScheduled = FALSE;
 
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+typedef struct {
+    LOS_DL_LIST freeList;   /* idle task control blocks of the pool, linked by pendList */
+    UINTPTR     stackBase;  /* memory holding the stacks of all the workers */
+    UINT32      stackSize;  /* stack size of each worker */
+    CHAR        *name;
+    UINT16      taskNum;    /* 0 if the pool is not created */
+    UINT16      freeNum;
+    UINT16      priority;
+} TaskPoolCB;
+
+LITE_OS_SEC_BSS STATIC TaskPoolCB g_taskPool[LOSCFG_BASE_CORE_TSK_POOL_LIMIT];
+
+#if (LOSCFG_EXC_HARDWARE_STACK_PROTECTION == 1)
+#define OS_TASK_POOL_STACK_OFFSET               OS_TASK_STACK_PROTECT_SIZE
+#define OS_TASK_POOL_STACK_ALIGN                OS_TASK_STACK_PROTECT_SIZE
+#else
+#define OS_TASK_POOL_STACK_OFFSET               0
+#define OS_TASK_POOL_STACK_ALIGN                LOSCFG_STACK_POINT_ALIGN_SIZE
+#endif
+#endif
+
 STATIC VOID (*PmEnter)(VOID) = NULL;
 
 #if (LOSCFG_BASE_CORE_EXC_TSK_SWITCH == 1)
@@ -142,9 +171,24 @@ STATIC_INLINE UINT32 OsCheckTaskIDValid(UINT32 taskID)
 STATIC INLINE VOID OsInsertTCBToFreeList(LosTaskCB *taskCB)
 {
     UINT32 taskID = taskCB->taskID;
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+    UINT16 poolIndex = taskCB->poolIndex;
+    UINTPTR topOfStack = taskCB->topOfStack;
+#endif
     (VOID)memset_s(taskCB, sizeof(LosTaskCB), 0, sizeof(LosTaskCB));
     taskCB->taskID = taskID;
     taskCB->taskStatus = OS_TASK_STATUS_UNUSED;
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+    /* A pool task keeps its stack and goes back to the pool it was reserved for. */
+    if (poolIndex != 0) {
+        TaskPoolCB *pool = &g_taskPool[poolIndex - 1];
+        taskCB->poolIndex = poolIndex;
+        taskCB->topOfStack = topOfStack;
+        LOS_ListAdd(&pool->freeList, &taskCB->pendList);
+        pool->freeNum++;
+        return;
+    }
+#endif
     LOS_ListAdd(&g_losFreeTask, &taskCB->pendList);
 }
 
@@ -224,6 +268,10 @@ LITE_OS_SEC_TEXT VOID OsIdleTask(VOID)
     while (1) {
         // 回收执行完毕的task
         OsRecyleFinishedTask();
+#if (LOSCFG_MEM_HANDLE == 1) && (LOSCFG_MEM_HANDLE_IDLE_COMPACT > 0)
+        // 空闲时在后台整理系统堆中的可移动内存块
+        (VOID)LOS_MemHandleCompact(OS_SYS_MEM_ADDR, LOSCFG_MEM_HANDLE_IDLE_COMPACT);
+#endif
         
         // 如果PmEnter非空，则执行PmEnter，否则sleep
         if (PmEnter != NULL) {
@@ -263,24 +311,60 @@ LITE_OS_SEC_TEXT_MINOR UINT8 *OsConvertTskStatus(UINT16 taskStatus)
     return (UINT8 *)"Impossible";
 }
 
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+LITE_OS_SEC_TEXT_MINOR VOID OsTaskStackWarn(LosTaskCB *taskCB)
+{
+    UINT32 peakUsed = taskCB->topOfStack + taskCB->stackSize - taskCB->stackLowest;
+
+    taskCB->stackWarnMark = 0;
+    PRINT_WARN("task %s:%u stack usage %u of %u bytes is above %u%%\n", taskCB->taskName, taskCB->taskID,
+               peakUsed, taskCB->stackSize, LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT);
+    OsHookCall(LOS_HOOK_TYPE_TASK_STACK_WARN, taskCB, peakUsed);
+}
+#endif
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1) && (LOSCFG_BASE_CORE_TSK_STACK_TRACK_PRECISE == 0)
+UINT32 OsGetTaskWaterLine(UINT32 taskID)
+{
+    LosTaskCB *taskCB = OS_TCB_FROM_TID(taskID);
+
+    if (*(UINT32 *)(UINTPTR)taskCB->topOfStack != OS_TASK_MAGIC_WORD) {
+        PRINT_ERR("CURRENT task %s stack overflow!\n", taskCB->taskName);
+        return OS_NULL_INT;
+    }
+    return taskCB->topOfStack + taskCB->stackSize - taskCB->stackLowest;
+}
+#else
 UINT32 OsGetTaskWaterLine(UINT32 taskID)
 {
     UINT32 *stackPtr = NULL;
     UINT32 peakUsed;
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+    UINT32 intSave;
+    UINT32 *stackEnd = (UINT32 *)(UINTPTR)OS_TCB_FROM_TID(taskID)->stackLowest;
+#else
+    UINT32 *stackEnd = (UINT32 *)(OS_TCB_FROM_TID(taskID)->stackPointer);
+#endif
 
     if (*(UINT32 *)(UINTPTR)OS_TCB_FROM_TID(taskID)->topOfStack == OS_TASK_MAGIC_WORD) {
         stackPtr = (UINT32 *)(UINTPTR)(OS_TCB_FROM_TID(taskID)->topOfStack + OS_TASK_STACK_TOP_OFFSET);
-        while ((stackPtr < (UINT32 *)(OS_TCB_FROM_TID(taskID)->stackPointer)) && (*stackPtr == OS_TASK_STACK_INIT)) {
+        while ((stackPtr < stackEnd) && (*stackPtr == OS_TASK_STACK_INIT)) {
             stackPtr += 1;
         }
         peakUsed = OS_TCB_FROM_TID(taskID)->stackSize -
             ((UINT32)(UINTPTR)stackPtr - OS_TCB_FROM_TID(taskID)->topOfStack);
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+        intSave = LOS_IntLock();
+        OsTaskStackTrack(OS_TCB_FROM_TID(taskID), (UINT32)(UINTPTR)stackPtr);
+        LOS_IntRestore(intSave);
+#endif
     } else {
         PRINT_ERR("CURRENT task %s stack overflow!\n", OS_TCB_FROM_TID(taskID)->taskName);
         peakUsed = OS_NULL_INT;
     }
     return peakUsed;
 }
+#endif
 
 #if (LOSCFG_BASE_CORE_CPUP == 1)
 LITE_OS_SEC_TEXT_MINOR UINT32 OsGetAllTskCpupInfo(CPUP_INFO_S **cpuLessOneSec,
@@ -421,6 +505,13 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsTaskInit(VOID)
     // g_taskMaxNum = LOSCFG_BASE_CORE_TSK_LIMIT + 1 = 21
     // kernel/src/los_init.c   OsRegister(VOID)
     size = (g_taskMaxNum + 1) * sizeof(LosTaskCB);  
+#if (LOSCFG_KERNEL_STATIC_CB == 1)
+    if (size > sizeof(g_taskCBTable)) {
+        return LOS_ERRNO_TSK_NO_MEMORY;
+    }
+    /* The static table is zeroed by the startup code. */
+    g_taskCBArray = g_taskCBTable;
+#else
     g_taskCBArray = (LosTaskCB *)LOS_MemAlloc(m_aucSysMem0, size);
     if (g_taskCBArray == NULL) {
         return LOS_ERRNO_TSK_NO_MEMORY;
@@ -429,6 +520,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 OsTaskInit(VOID)
     // Ignore the return code when matching CSEC rule 6.6(1).
     // 初始化 g_taskCBArray 空间为 0 值
     (VOID)memset_s(g_taskCBArray, size, 0, size);
+#endif
 
     // 初始化g_losFreeTask 和 g_taskRecycleList
     LOS_ListInit(&g_losFreeTask);  // 未使用的taskCB
@@ -731,6 +823,12 @@ LITE_OS_SEC_TEXT_INIT STATIC_INLINE UINT32 OsTaskInitParamCheck(TSK_INIT_PARAM_S
     if (taskInitParam->uwStackSize < LOSCFG_BASE_CORE_TSK_MIN_STACK_SIZE) {
         return LOS_ERRNO_TSK_STKSZ_TOO_SMALL;
     }
+
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+    if ((taskInitParam->timeSliceUs != 0) && (taskInitParam->timeSliceUs < LOS_TASK_TIMESLICE_MIN_US)) {
+        return LOS_ERRNO_TSK_TIMESLICE_INVALID;
+    }
+#endif
     return LOS_OK;
 }
 
@@ -747,6 +845,11 @@ STATIC UINT32 OsNewTaskInit(LosTaskCB *taskCB, TSK_INIT_PARAM_S *taskInitParam)
     taskCB->taskStatus      = OS_TASK_STATUS_SUSPEND;
     taskCB->priority        = taskInitParam->usTaskPrio;
     taskCB->timeSlice       = 0;
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+    taskCB->sliceLen        = OsSchedTimeSliceUsToCycle(taskInitParam->timeSliceUs);
+    taskCB->sliceExpired    = 0;
+    taskCB->sliceYields     = 0;
+#endif
     taskCB->waitTimes       = 0;
     taskCB->taskEntry       = taskInitParam->pfnTaskEntry;
     taskCB->event.uwEventID = OS_NULL_INT;
@@ -759,6 +862,17 @@ STATIC UINT32 OsNewTaskInit(LosTaskCB *taskCB, TSK_INIT_PARAM_S *taskInitParam)
 
     // 设置 (&taskCB->sortList))->responseTime = (((UINT64)-1)))
     SET_SORTLIST_VALUE(&taskCB->sortList, OS_SORT_LINK_INVALID_TIME);
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+    taskCB->sortList.slack = OsSchedSlackUsToCycle(LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US);
+#endif
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+    taskCB->readyTime = 0;
+    (VOID)memset_s(&taskCB->latency, sizeof(taskCB->latency), 0, sizeof(taskCB->latency));
+#endif
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+    (VOID)memset_s(&taskCB->edf, sizeof(taskCB->edf), 0, sizeof(taskCB->edf));
+    SET_SORTLIST_VALUE(&taskCB->edf.readyList, OS_SORT_LINK_INVALID_TIME);
+#endif
     // eventCB->uwEventID = 0; 初始化 eventCB->stEventList
     LOS_EventInit(&(taskCB->event));
 
@@ -801,9 +915,51 @@ STATIC UINT32 OsNewTaskInit(LosTaskCB *taskCB, TSK_INIT_PARAM_S *taskInitParam)
     *((UINT32 *)taskCB->topOfStack) = OS_TASK_MAGIC_WORD;
     // 初始化task 上下文context，context是寄存器的值
     taskCB->stackPointer = ArchTskStackInit(taskCB->taskID, taskCB->stackSize, (VOID *)taskCB->topOfStack);
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+    taskCB->stackLowest = (UINT32)(UINTPTR)taskCB->stackPointer;
+    taskCB->stackWarnMark = 0;
+    if (LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT != 0) {
+        taskCB->stackWarnMark = taskCB->topOfStack + taskCB->stackSize -
+            (UINT32)(((UINT64)taskCB->stackSize * LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT) / 100); /* 100, percent */
+    }
+#endif
     return LOS_OK;
 }
 
+/// @brief 初始化从空闲链表或任务池中取出的taskCB，失败时将其放回
+/// @param taskCB 
+/// @param taskInitParam 
+/// @param taskID 
+/// @return 
+STATIC UINT32 OsTaskCBCreate(LosTaskCB *taskCB, TSK_INIT_PARAM_S *taskInitParam, UINT32 *taskID)
+{
+    UINT32 intSave;
+    UINT32 retVal;
+
+    // 这个函数比较重要，给task成员赋初值，设置栈等
+    retVal = OsNewTaskInit(taskCB, taskInitParam);
+    if (retVal != LOS_OK) {
+        // 如果失败，把task加入g_losFreeTask链表，释放task
+        intSave = LOS_IntLock();
+        OsInsertTCBToFreeList(taskCB);
+        LOS_IntRestore(intSave);
+        return retVal;
+    }
+
+    LOSCFG_TASK_CREATE_EXTENSION_HOOK(taskCB);
+
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+    intSave = LOS_IntLock();
+    g_cpup[taskCB->taskID].cpupID = taskCB->taskID;
+    g_cpup[taskCB->taskID].status = taskCB->taskStatus;
+    LOS_IntRestore(intSave);
+#endif
+    // 传入的taskID会被taskCB->taskID赋值
+    *taskID = taskCB->taskID;
+    OsHookCall(LOS_HOOK_TYPE_TASK_CREATE, taskCB);
+    return retVal;
+}
+
 /*****************************************************************************
  Function    : LOS_TaskCreateOnly
  Description : Create a task and suspend
@@ -843,28 +999,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *taskID, TSK_INIT_PARAM_S
     // 解锁
     LOS_IntRestore(intSave);
 
-    // 这个函数比较重要，给task成员赋初值，设置栈等
-    retVal = OsNewTaskInit(taskCB, taskInitParam);
-    if (retVal != LOS_OK) {
-        // 如果失败，把task加入g_losFreeTask链表，释放task
-        intSave = LOS_IntLock();
-        OsInsertTCBToFreeList(taskCB);
-        LOS_IntRestore(intSave);
-        return retVal;
-    }
-
-    LOSCFG_TASK_CREATE_EXTENSION_HOOK(taskCB);
-
-#if (LOSCFG_BASE_CORE_CPUP == 1)
-    intSave = LOS_IntLock();
-    g_cpup[taskCB->taskID].cpupID = taskCB->taskID;
-    g_cpup[taskCB->taskID].status = taskCB->taskStatus;
-    LOS_IntRestore(intSave);
-#endif
-    // 传入的taskID会被taskCB->taskID赋值
-    *taskID = taskCB->taskID;
-    OsHookCall(LOS_HOOK_TYPE_TASK_CREATE, taskCB);
-    return retVal;
+    return OsTaskCBCreate(taskCB, taskInitParam, taskID);
 }
 
 /*****************************************************************************
@@ -900,6 +1035,236 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreate(UINT32 *taskID, TSK_INIT_PARAM_S *ta
     return LOS_OK;
 }
 
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+STATIC VOID OsTaskPoolRelease(TaskPoolCB *pool)
+{
+    LosTaskCB *taskCB = NULL;
+
+    while (!LOS_ListEmpty(&pool->freeList)) {
+        taskCB = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&pool->freeList));
+        LOS_ListDelete(&taskCB->pendList);
+        taskCB->poolIndex = 0;
+        taskCB->topOfStack = 0;
+        LOS_ListAdd(&g_losFreeTask, &taskCB->pendList);
+    }
+    pool->taskNum = 0;
+    pool->freeNum = 0;
+}
+
+/*****************************************************************************
+ Function    : LOS_TaskPoolCreate
+ Description : Reserve task control blocks and stacks for short-lived workers
+ Input       : name      --- Name of the workers
+               taskNum   --- Number of the workers
+               stackSize --- Stack size of each worker
+               priority  --- Priority of the workers
+ Output      : poolID    --- Save pool ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskPoolCreate(CHAR *name, UINT16 taskNum, UINT32 stackSize, UINT16 priority,
+                                                UINT32 *poolID)
+{
+    UINT32 intSave;
+    UINT32 index;
+    UINT32 slotSize;
+    UINTPTR stackBase;
+    TaskPoolCB *pool = NULL;
+    LosTaskCB *taskCB = NULL;
+
+    if ((poolID == NULL) || (taskNum == 0)) {
+        return LOS_ERRNO_TSK_POOL_PARAM_INVALID;
+    }
+
+    if (name == NULL) {
+        return LOS_ERRNO_TSK_NAME_EMPTY;
+    }
+
+    /* The lowest priority is reserved for the idle task. */
+    if (priority >= OS_TASK_PRIORITY_LOWEST) {
+        return LOS_ERRNO_TSK_PRIOR_ERROR;
+    }
+
+    if (stackSize == 0) {
+        stackSize = LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE;
+    }
+
+    if (stackSize < LOSCFG_BASE_CORE_TSK_MIN_STACK_SIZE) {
+        return LOS_ERRNO_TSK_STKSZ_TOO_SMALL;
+    }
+
+    if (stackSize > LOSCFG_SYS_HEAP_SIZE) {
+        return LOS_ERRNO_TSK_STKSZ_TOO_LARGE;
+    }
+
+    stackSize = ALIGN(ALIGN(stackSize, OS_TASK_STACK_ADDR_ALIGN), OS_TASK_POOL_STACK_ALIGN);
+    slotSize = stackSize + OS_TASK_POOL_STACK_OFFSET;
+    if (((UINT64)slotSize * taskNum) > LOSCFG_SYS_HEAP_SIZE) {
+        return LOS_ERRNO_TSK_NO_MEMORY;
+    }
+
+    /* All the stacks are taken in one allocation, so spawning a worker never touches the heap. */
+    stackBase = (UINTPTR)LOS_MemAllocAlign(OS_TASK_STACK_ADDR, slotSize * taskNum, OS_TASK_POOL_STACK_ALIGN);
+    if (stackBase == (UINTPTR)NULL) {
+        return LOS_ERRNO_TSK_NO_MEMORY;
+    }
+
+    OsRecyleFinishedTask();
+
+    intSave = LOS_IntLock();
+    for (index = 0; index < LOSCFG_BASE_CORE_TSK_POOL_LIMIT; index++) {
+        if (g_taskPool[index].taskNum == 0) {
+            pool = &g_taskPool[index];
+            break;
+        }
+    }
+    if (pool == NULL) {
+        LOS_IntRestore(intSave);
+        (VOID)LOS_MemFree(OS_TASK_STACK_ADDR, (VOID *)stackBase);
+        return LOS_ERRNO_TSK_POOL_UNAVAILABLE;
+    }
+
+    LOS_ListInit(&pool->freeList);
+    pool->taskNum = taskNum;
+    pool->freeNum = 0;
+    while (pool->freeNum < taskNum) {
+        if (LOS_ListEmpty(&g_losFreeTask)) {
+            OsTaskPoolRelease(pool);
+            LOS_IntRestore(intSave);
+            (VOID)LOS_MemFree(OS_TASK_STACK_ADDR, (VOID *)stackBase);
+            return LOS_ERRNO_TSK_TCB_UNAVAILABLE;
+        }
+        taskCB = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&g_losFreeTask));
+        LOS_ListDelete(&taskCB->pendList);
+        taskCB->poolIndex = (UINT16)(index + 1);
+        taskCB->topOfStack = stackBase + (pool->freeNum * slotSize) + OS_TASK_POOL_STACK_OFFSET;
+        LOS_ListTailInsert(&pool->freeList, &taskCB->pendList);
+        pool->freeNum++;
+    }
+    pool->stackBase = stackBase;
+    pool->stackSize = stackSize;
+    pool->name = name;
+    pool->priority = priority;
+    LOS_IntRestore(intSave);
+
+    *poolID = index;
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_TaskPoolSpawn
+ Description : Start a worker with a task control block and stack of the pool
+ Input       : poolID --- Pool ID
+               entry  --- Entry of the worker
+               arg    --- Parameter of the worker
+ Output      : taskID --- Save task ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskPoolSpawn(UINT32 poolID, TSK_ENTRY_FUNC entry, UINT32 arg, UINT32 *taskID)
+{
+    UINT32 intSave;
+    UINT32 retVal;
+    TaskPoolCB *pool = NULL;
+    LosTaskCB *taskCB = NULL;
+    TSK_INIT_PARAM_S taskInitParam = {0};
+
+    if (taskID == NULL) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    if (entry == NULL) {
+        return LOS_ERRNO_TSK_ENTRY_NULL;
+    }
+
+    if (poolID >= LOSCFG_BASE_CORE_TSK_POOL_LIMIT) {
+        return LOS_ERRNO_TSK_POOL_ID_INVALID;
+    }
+    pool = &g_taskPool[poolID];
+
+    intSave = LOS_IntLock();
+    if (pool->taskNum == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_POOL_ID_INVALID;
+    }
+
+    /* Finished workers are normally handed back by the idle task, only collect them here when it is needed. */
+    if (LOS_ListEmpty(&pool->freeList)) {
+        LOS_IntRestore(intSave);
+        OsRecyleFinishedTask();
+        intSave = LOS_IntLock();
+        if (LOS_ListEmpty(&pool->freeList)) {
+            LOS_IntRestore(intSave);
+            return LOS_ERRNO_TSK_POOL_EMPTY;
+        }
+    }
+
+    taskCB = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&pool->freeList));
+    LOS_ListDelete(&taskCB->pendList);
+    pool->freeNum--;
+    taskInitParam.stackAddr = taskCB->topOfStack;
+    taskInitParam.uwStackSize = pool->stackSize;
+    taskInitParam.usTaskPrio = pool->priority;
+    taskInitParam.pcName = pool->name;
+    LOS_IntRestore(intSave);
+
+    taskInitParam.pfnTaskEntry = entry;
+    taskInitParam.uwArg = arg;
+    retVal = OsTaskCBCreate(taskCB, &taskInitParam, taskID);
+    if (retVal != LOS_OK) {
+        return retVal;
+    }
+
+    intSave = LOS_IntLock();
+    OsSchedTaskEnQueue(taskCB);
+    LOS_IntRestore(intSave);
+
+    if (g_taskScheduled) {
+        LOS_Schedule();
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_TaskPoolDelete
+ Description : Give the task control blocks of the pool back and free its stacks
+ Input       : poolID --- Pool ID
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskPoolDelete(UINT32 poolID)
+{
+    UINT32 intSave;
+    UINTPTR stackBase;
+    TaskPoolCB *pool = NULL;
+
+    if (poolID >= LOSCFG_BASE_CORE_TSK_POOL_LIMIT) {
+        return LOS_ERRNO_TSK_POOL_ID_INVALID;
+    }
+    pool = &g_taskPool[poolID];
+
+    OsRecyleFinishedTask();
+
+    intSave = LOS_IntLock();
+    if (pool->taskNum == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_POOL_ID_INVALID;
+    }
+
+    if (pool->freeNum != pool->taskNum) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_POOL_BUSY;
+    }
+
+    stackBase = pool->stackBase;
+    OsTaskPoolRelease(pool);
+    pool->stackBase = 0;
+    LOS_IntRestore(intSave);
+
+    (VOID)LOS_MemFree(OS_TASK_STACK_ADDR, (VOID *)stackBase);
+    return LOS_OK;
+}
+#endif
+
 /*****************************************************************************
  Function    : LOS_TaskResume
  Description : Resume suspend task
@@ -1264,13 +1629,14 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 taskID)
 }
 
 /*****************************************************************************
- Function    : LOS_TaskDelay
+ Function    : OsTaskDelay
  Description : delay the current task
- Input       : tick    --- time
+ Input       : cycles  --- delay time in cycles
+               tick    --- delay time in ticks, reported to the hooks
  Output      : None
  Return      : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT UINT32 LOS_TaskDelay(UINT32 tick)
+STATIC UINT32 OsTaskDelay(UINT64 cycles, UINT32 tick)
 {
     UINT32 intSave;
 
@@ -1287,12 +1653,12 @@ LITE_OS_SEC_TEXT UINT32 LOS_TaskDelay(UINT32 tick)
         return LOS_ERRNO_TSK_OPERATE_SYSTEM_TASK;
     }
     OsHookCall(LOS_HOOK_TYPE_TASK_DELAY, tick);
-    if (tick == 0) {
+    if (cycles == 0) {
         // 如果tick==0,则只是让出CPU
         return LOS_TaskYield();
     } else {
         intSave = LOS_IntLock();
-        OsSchedDelay(g_losTask.runTask, tick);
+        OsSchedDelay(g_losTask.runTask, cycles);
         OsHookCall(LOS_HOOK_TYPE_MOVEDTASKTODELAYEDLIST, g_losTask.runTask);
         LOS_IntRestore(intSave);
         LOS_Schedule();
@@ -1301,6 +1667,29 @@ LITE_OS_SEC_TEXT UINT32 LOS_TaskDelay(UINT32 tick)
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function    : LOS_TaskDelay
+ Description : delay the current task
+ Input       : tick    --- time
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskDelay(UINT32 tick)
+{
+    return OsTaskDelay((tick == 0) ? 0 : OS_SYS_TICK_TO_CYCLE(tick), tick);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_TaskDelayNs(UINT64 nanoseconds)
+{
+    UINT64 cycles = OsSchedNsToWaitCycle(nanoseconds);
+
+    /* A delay always ends, even for LOS_WAIT_FOREVER_NS */
+    if (cycles > OS_SCHED_WAIT_CYCLE_MAX) {
+        cycles = OS_SCHED_WAIT_CYCLE_MAX;
+    }
+    return OsTaskDelay(cycles, OsSchedWaitCycleToTick(cycles));
+}
+
 /**
  * @brief 获取task优先级
  * 
@@ -1382,6 +1771,178 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_CurTaskPriSet(UINT16 taskPrio)
     return LOS_TaskPriSet(g_losTask.runTask->taskID, taskPrio);
 }
 
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskSlackSet(UINT32 taskID, UINT32 slackUs)
+{
+    UINT32 intSave;
+    LosTaskCB *taskCB = NULL;
+
+    if (OS_CHECK_TSK_PID_NOIDLE(taskID)) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCB = OS_TCB_FROM_TID(taskID);
+    intSave = LOS_IntLock();
+    if (taskCB->taskStatus & OS_TASK_STATUS_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    taskCB->sortList.slack = OsSchedSlackUsToCycle(slackUs);
+    OsSchedUpdateExpireTime();
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+#endif
+
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskTimeSliceSet(UINT32 taskID, UINT32 sliceUs)
+{
+    UINT32 intSave;
+    LosTaskCB *taskCB = NULL;
+
+    if (OS_CHECK_TSK_PID_NOIDLE(taskID)) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    if ((sliceUs != 0) && (sliceUs < LOS_TASK_TIMESLICE_MIN_US)) {
+        return LOS_ERRNO_TSK_TIMESLICE_INVALID;
+    }
+
+    taskCB = OS_TCB_FROM_TID(taskID);
+    intSave = LOS_IntLock();
+    if (taskCB->taskStatus & OS_TASK_STATUS_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    taskCB->sliceLen = OsSchedTimeSliceUsToCycle(sliceUs);
+    if (taskCB->timeSlice > taskCB->sliceLen) {
+        taskCB->timeSlice = taskCB->sliceLen;
+    }
+    if (taskCB->taskStatus & OS_TASK_STATUS_RUNNING) {
+        OsSchedUpdateExpireTime();
+    }
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskTimeSliceStatGet(UINT32 taskID, LOS_TASK_SLICE_STAT_S *stat)
+{
+    UINT32 intSave;
+    LosTaskCB *taskCB = NULL;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    if (OS_CHECK_TSK_PID_NOIDLE(taskID)) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCB = OS_TCB_FROM_TID(taskID);
+    intSave = LOS_IntLock();
+    if (taskCB->taskStatus & OS_TASK_STATUS_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+    stat->sliceUs = (UINT32)((((UINT64)taskCB->sliceLen * OS_SYS_US_PER_SECOND) + (g_sysClock >> 1)) / g_sysClock);
+    stat->expired = taskCB->sliceExpired;
+    stat->yields = taskCB->sliceYields;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+#endif
+
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskEdfSet(UINT32 taskID, UINT32 periodUs, UINT32 budgetUs)
+{
+    UINT32 intSave;
+    UINT32 ret;
+    BOOL needSched = FALSE;
+    LosTaskCB *taskCB = NULL;
+
+    if (OS_CHECK_TSK_PID_NOIDLE(taskID)) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCB = OS_TCB_FROM_TID(taskID);
+    intSave = LOS_IntLock();
+    if (taskCB->taskStatus & OS_TASK_STATUS_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+    if (taskCB->taskStatus & OS_TASK_FLAG_SYSTEM_TASK) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_OPERATE_SYSTEM_TASK;
+    }
+
+    ret = OsSchedEdfParamSet(taskCB, periodUs, budgetUs, &needSched);
+    LOS_IntRestore(intSave);
+    if (needSched) {
+        LOS_Schedule();
+    }
+
+    return ret;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_TaskEdfWait(VOID)
+{
+    UINT32 intSave;
+    UINT64 cycles;
+    LosTaskCB *runTask = g_losTask.runTask;
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_TSK_DELAY_IN_INT;
+    }
+
+    if (g_losTaskLock != 0) {
+        return LOS_ERRNO_TSK_DELAY_IN_LOCK;
+    }
+
+    intSave = LOS_IntLock();
+    if (runTask->edf.period == 0) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_EDF;
+    }
+
+    cycles = OsSchedEdfJobEnd(runTask);
+    if (cycles == 0) {
+        OsSchedYield();
+    } else {
+        OsSchedDelay(runTask, cycles);
+        OsHookCall(LOS_HOOK_TYPE_MOVEDTASKTODELAYEDLIST, runTask);
+    }
+    LOS_IntRestore(intSave);
+    LOS_Schedule();
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskEdfStatGet(UINT32 taskID, LOS_TASK_EDF_STAT_S *stat)
+{
+    UINT32 intSave;
+    LosTaskCB *taskCB = NULL;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    if (OS_CHECK_TSK_PID_NOIDLE(taskID)) {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    taskCB = OS_TCB_FROM_TID(taskID);
+    intSave = LOS_IntLock();
+    if (taskCB->taskStatus & OS_TASK_STATUS_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+    *stat = taskCB->edf.stat;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+#endif
+
 /*****************************************************************************
  Function    : LOS_TaskYield
  Description : Adjust the procedure order of specified task
@@ -1396,8 +1957,17 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskYield(VOID)
     intSave = LOS_IntLock();
     // 设置当前运行task时间片为0
     OsSchedYield();
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+    g_losTask.runTask->taskStatus |= OS_TASK_FLAG_YIELD;
+#endif
     LOS_IntRestore(intSave);
     LOS_Schedule();
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+    /* No switch happened if nothing else was ready, do not let the flag leak into a later preemption */
+    intSave = LOS_IntLock();
+    g_losTask.runTask->taskStatus &= ~OS_TASK_FLAG_YIELD;
+    LOS_IntRestore(intSave);
+#endif
     return LOS_OK;
 }
 
@@ -1413,6 +1983,11 @@ LITE_OS_SEC_TEXT_MINOR VOID LOS_TaskLock(VOID)
     UINT32 intSave;
 
     intSave = LOS_IntLock();
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+    if (g_losTaskLock == 0) {
+        OsIrqStatSchedLock((UINTPTR)__builtin_return_address(0));
+    }
+#endif
     g_losTaskLock++;
     LOS_IntRestore(intSave);
 }
@@ -1432,7 +2007,11 @@ LITE_OS_SEC_TEXT_MINOR VOID LOS_TaskUnlock(VOID)
     if (g_losTaskLock > 0) {
         g_losTaskLock--;
         if (g_losTaskLock == 0) {
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+            OsIrqStatSchedUnlock(intSave);
+#else
             LOS_IntRestore(intSave);
+#endif
             LOS_Schedule();
             return;
         }
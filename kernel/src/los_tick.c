@@ -36,6 +36,7 @@
 #include "los_swtmr.h"
 #include "los_sched.h"
 #include "los_debug.h"
+#include "los_atomic.h"
 #include "stdint.h"
 
 LITE_OS_SEC_BSS STATIC ArchTickTimer *g_sysTickTimer = NULL;
@@ -47,25 +48,126 @@ LITE_OS_SEC_BSS STATIC BOOL g_sysTimerIsInit = FALSE;
 LITE_OS_SEC_BSS STATIC UINT64 g_tickTimerStartTime;
 
 #if (LOSCFG_BASE_CORE_TICK_WTIMER == 0)
-STATIC UINT64 g_tickTimerBase;
+/*
+ * Ports whose atomics mask interrupts gain nothing from a lock-free read, there LOS_SysCycleGet keeps masking
+ * interrupts and the mark below is raised with a plain store.
+ */
+#ifdef ARCH_ATOMIC_INT_LOCK
+#define OS_TICK_TIMER_LOCK_FREE     0
+#else
+#define OS_TICK_TIMER_LOCK_FREE     1
+#endif
+
+/*
+ * g_tickTimerBase is published through the sequence counter g_tickTimerSeq:
+ * writers update the base with interrupts masked and keep the sequence odd
+ * meanwhile, so LOS_SysCycleGet reads it without locking and retries when a
+ * writer ran in between.
+ */
+STATIC volatile UINT64 g_tickTimerBase;
+STATIC volatile UINT32 g_tickTimerSeq;
 STATIC BOOL g_tickTimerBaseUpdate = FALSE;
+/*
+ * Low 32 bits of the largest cycle count handed out. It is only raised, and
+ * writers refresh it whenever they move the base, so it never lags the counter
+ * by more than one period and a signed 32-bit difference orders it against any
+ * new reading. It is only used for counters that turn over, which report a
+ * non-zero period of at most 32 bits; a free-running 64-bit counter reports
+ * period 0 and is read as is.
+ */
+STATIC volatile UINT32 g_tickTimerMark;
+
+STATIC INLINE BOOL OsTickTimerBehindMark(UINT64 cycle)
+{
+    return (INT32)((UINT32)cycle - g_tickTimerMark) < 0;
+}
+
+STATIC INLINE VOID OsTickTimerMarkRaise(UINT64 cycle)
+{
+#if (OS_TICK_TIMER_LOCK_FREE == 1)
+    UINT32 old;
+
+    do {
+        old = g_tickTimerMark;
+        if ((INT32)((UINT32)cycle - old) <= 0) {
+            return;
+        }
+    } while (LOS_AtomicCmpXchg32bits((volatile INT32 *)&g_tickTimerMark, (INT32)(UINT32)cycle, (INT32)old));
+#else
+    /* Called with interrupts masked */
+    if ((INT32)((UINT32)cycle - g_tickTimerMark) > 0) {
+        g_tickTimerMark = (UINT32)cycle;
+    }
+#endif
+}
+
+STATIC INLINE VOID OsTickTimerWriteBegin(VOID)
+{
+    g_tickTimerSeq++;
+}
+
+STATIC INLINE VOID OsTickTimerWriteEnd(VOID)
+{
+    g_tickTimerSeq++;
+}
 
 LITE_OS_SEC_TEXT STATIC VOID OsUpdateSysTimeBase(VOID)
 {
     UINT32 period = 0;
+    UINT64 time;
+    UINT32 intSave = LOS_IntLock();
 
+    time = g_sysTickTimer->getCycle(&period);
     if (g_tickTimerBaseUpdate == FALSE) {
-        (VOID)g_sysTickTimer->getCycle(&period);
+        OsTickTimerWriteBegin();
         g_tickTimerBase += period;
+        OsTickTimerWriteEnd();
     }
     g_tickTimerBaseUpdate = FALSE;
+    OsTickTimerMarkRaise(g_tickTimerBase + time);
+    LOS_IntRestore(intSave);
 }
 
 LITE_OS_SEC_TEXT VOID OsTickTimerBaseReset(UINT64 currTime)
 {
+    UINT32 period = 0;
+    UINT32 intSave = LOS_IntLock();
+
     LOS_ASSERT(currTime > g_tickTimerBase);
 
+    OsTickTimerWriteBegin();
     g_tickTimerBase = currTime;
+    OsTickTimerWriteEnd();
+    g_tickTimerMark = (UINT32)(currTime + g_sysTickTimer->getCycle(&period));
+    LOS_IntRestore(intSave);
+}
+
+/*
+ * Slow path of LOS_SysCycleGet: the counter turned over but the tick interrupt
+ * has not advanced the base yet, because interrupts are masked or it is still
+ * pending.
+ */
+LITE_OS_SEC_TEXT STATIC UINT64 OsSysCycleTurnGet(VOID)
+{
+    UINT32 period = 0;
+    UINT32 intSave = LOS_IntLock();
+    UINT64 time = g_sysTickTimer->getCycle(&period);
+    UINT64 schedTime = g_tickTimerBase + time;
+
+    if (OsTickTimerBehindMark(schedTime)) {
+        /* Turn the timer count */
+        OsTickTimerWriteBegin();
+        g_tickTimerBase += period;
+        OsTickTimerWriteEnd();
+        g_tickTimerBaseUpdate = TRUE;
+        schedTime = g_tickTimerBase + time;
+    }
+
+    LOS_ASSERT(!OsTickTimerBehindMark(schedTime));
+
+    g_tickTimerMark = (UINT32)schedTime;
+    LOS_IntRestore(intSave);
+    return schedTime;
 }
 #endif
 
@@ -81,9 +183,20 @@ LITE_OS_SEC_TEXT VOID OsTickHandler(VOID)
 LITE_OS_SEC_TEXT UINT64 OsTickTimerReload(UINT64 period)
 {
 #if (LOSCFG_BASE_CORE_TICK_WTIMER == 0)
-    g_tickTimerBase = LOS_SysCycleGet();
-#endif
+    UINT32 intSave = LOS_IntLock();
+    UINT64 base = LOS_SysCycleGet();
+
+    /* The counter restarts from zero, so the base and the reload form one update */
+    OsTickTimerWriteBegin();
+    g_tickTimerBase = base;
+    period = g_sysTickTimer->reload(period);
+    OsTickTimerWriteEnd();
+    g_tickTimerMark = (UINT32)base;
+    LOS_IntRestore(intSave);
+    return period;
+#else
     return g_sysTickTimer->reload(period);
+#endif
 }
 
 LITE_OS_SEC_TEXT UINT64 LOS_SysCycleGet(VOID)
@@ -91,22 +204,30 @@ LITE_OS_SEC_TEXT UINT64 LOS_SysCycleGet(VOID)
 #if (LOSCFG_BASE_CORE_TICK_WTIMER == 1)
     return g_sysTickTimer->getCycle(NULL);
 #else
-    STATIC UINT64 oldSchedTime = 0;
     UINT32 period = 0;
+    UINT32 seq;
+    UINT64 schedTime;
+#if (OS_TICK_TIMER_LOCK_FREE == 0)
     UINT32 intSave = LOS_IntLock();
-    UINT64 time = g_sysTickTimer->getCycle(&period);
-    UINT64 schedTime = g_tickTimerBase + time;
-    if (schedTime < oldSchedTime) {
-        /* Turn the timer count */
-        g_tickTimerBase += period;
-        schedTime = g_tickTimerBase + time;
-        g_tickTimerBaseUpdate = TRUE;
-    }
+#endif
 
-    LOS_ASSERT(schedTime >= oldSchedTime);
+    do {
+        seq = g_tickTimerSeq;
+        schedTime = g_tickTimerBase + g_sysTickTimer->getCycle(&period);
+    } while ((seq & 1U) || (seq != g_tickTimerSeq));
+
+    if (period != 0) {
+        /* Behind a value already handed out: the counter turned over and the tick interrupt has not run yet */
+        if (OsTickTimerBehindMark(schedTime)) {
+            schedTime = OsSysCycleTurnGet();
+        } else {
+            OsTickTimerMarkRaise(schedTime);
+        }
+    }
 
-    oldSchedTime = schedTime;
+#if (OS_TICK_TIMER_LOCK_FREE == 0)
     LOS_IntRestore(intSave);
+#endif
     return schedTime;
 #endif
 }
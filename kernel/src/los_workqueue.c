@@ -0,0 +1,609 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ *    conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ *    of conditions and the following disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ *    to endorse or promote products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "los_workqueue.h"
+#include "securec.h"
+#include "los_interrupt.h"
+#include "los_task.h"
+#include "los_sched.h"
+#include "los_debug.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+
+#define OS_WORKQUEUE_UNUSED         0
+#define OS_WORKQUEUE_USED           1
+#define OS_WORKQUEUE_DELETING       2
+
+#define OS_WORKQUEUE_EVENT_RUN      0x1U
+#define OS_WORKQUEUE_EVENT_EXIT     0x2U
+
+#define OS_WORKQUEUE_INVALID_ID     0xFFFFFFFF
+
+#define OS_WORKQUEUE_CYCLE_TO_US(cycle) (OS_SYS_CYCLE_TO_NS(cycle, g_sysClock) / OS_SYS_NS_PER_US)
+
+typedef struct {
+    LOS_DL_LIST             pendList;       /* Works waiting to run, in submission order */
+    EVENT_CB_S              event;          /* Wakes the work queue task */
+    UINT32                  taskID;
+    UINT32                  pendingNum;
+    UINT16                  state;
+    LOS_WORKQUEUE_STAT_S    stat;
+} WorkQueueCB;
+
+LITE_OS_SEC_BSS STATIC WorkQueueCB g_workQueueCB[LOSCFG_BASE_CORE_WORKQUEUE_LIMIT];
+
+#define OS_WORKQUEUE_CHECK(queueID) do {                                    \
+    if ((queueID) >= LOSCFG_BASE_CORE_WORKQUEUE_LIMIT) {                    \
+        return LOS_ERRNO_WORKQUEUE_ID_INVALID;                              \
+    }                                                                       \
+} while (0)
+
+/* Called with interrupts locked, returns TRUE if the work queue task must be woken */
+STATIC BOOL OsWorkEnqueue(WorkQueueCB *queue, LOS_WORK_S *work, UINT64 currTime)
+{
+    BOOL wake = LOS_ListEmpty(&queue->pendList);
+
+    work->state = OS_WORK_PENDING;
+    work->queueTime = currTime;
+    LOS_ListTailInsert(&queue->pendList, &work->pendList);
+    queue->pendingNum++;
+    if (queue->pendingNum > queue->stat.pendingMax) {
+        queue->stat.pendingMax = queue->pendingNum;
+    }
+    return wake;
+}
+
+STATIC VOID OsWorkQueueTask(UINT32 queueID)
+{
+    UINT32 intSave;
+    WorkQueueCB *queue = &g_workQueueCB[queueID];
+
+    for (;;) {
+        (VOID)LOS_EventRead(&queue->event, OS_WORKQUEUE_EVENT_RUN | OS_WORKQUEUE_EVENT_EXIT,
+                            LOS_WAITMODE_OR | LOS_WAITMODE_CLR, LOS_WAIT_FOREVER);
+
+        intSave = LOS_IntLock();
+        while ((queue->state == OS_WORKQUEUE_USED) && !LOS_ListEmpty(&queue->pendList)) {
+            LOS_WORK_S *work = LOS_DL_LIST_ENTRY(queue->pendList.pstNext, LOS_WORK_S, pendList);
+            LOS_ListDelete(&work->pendList);
+            queue->pendingNum--;
+            work->state = OS_WORK_IDLE;
+
+            WORK_PROC_FUNC handler = work->handler;
+            VOID *arg = work->arg;
+            UINT64 latency = OsGetCurrSchedTimeCycle() - work->queueTime;
+            LOS_IntRestore(intSave);
+
+            handler(arg);
+
+            UINT32 latencyUs = (UINT32)OS_WORKQUEUE_CYCLE_TO_US(latency);
+            intSave = LOS_IntLock();
+            queue->stat.executed++;
+            queue->stat.latencySumUs += latencyUs;
+            if (latencyUs > queue->stat.latencyMaxUs) {
+                queue->stat.latencyMaxUs = latencyUs;
+            }
+        }
+
+        if (queue->state == OS_WORKQUEUE_DELETING) {
+            queue->state = OS_WORKQUEUE_UNUSED;
+            LOS_IntRestore(intSave);
+            return;
+        }
+        LOS_IntRestore(intSave);
+    }
+}
+
+/* Moves the delayed works whose delay has expired to their work queues, called from the tick interrupt */
+STATIC BOOL OsWorkScan(VOID)
+{
+    BOOL needSchedule = FALSE;
+    LOS_DL_LIST *listObject = &g_workSortLink.sortLink;
+    UINT64 currTime = OsGetCurrSchedTimeCycle();
+
+    while (!LOS_ListEmpty(listObject)) {
+        SortLinkList *sortList = LOS_DL_LIST_ENTRY(listObject->pstNext, SortLinkList, sortLinkNode);
+        if (sortList->responseTime > currTime) {
+            break;
+        }
+
+        LOS_WORK_S *work = LOS_DL_LIST_ENTRY(sortList, LOS_WORK_S, sortList);
+        WorkQueueCB *queue = &g_workQueueCB[work->queueID];
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+        OsSchedSlackExpired(sortList);
+#endif
+        OsDeleteNodeSortLink(sortList);
+        if (OsWorkEnqueue(queue, work, currTime)) {
+            (VOID)LOS_EventWrite(&queue->event, OS_WORKQUEUE_EVENT_RUN);
+        }
+        needSchedule = TRUE;
+    }
+
+    return needSchedule;
+}
+
+/*
+ * Called with interrupts locked. Delayed works must not outlive their queue: once the slot is reused they
+ * would be queued to the new work queue, and the caller may free a work it believes idle.
+ */
+STATIC VOID OsWorkDelayedCancel(UINT32 queueID)
+{
+    LOS_DL_LIST *listHead = &g_workSortLink.sortLink;
+    LOS_DL_LIST *listObject = listHead->pstNext;
+
+    while (listObject != listHead) {
+        SortLinkList *sortList = LOS_DL_LIST_ENTRY(listObject, SortLinkList, sortLinkNode);
+        LOS_WORK_S *work = LOS_DL_LIST_ENTRY(sortList, LOS_WORK_S, sortList);
+        listObject = listObject->pstNext;
+        if (work->queueID == queueID) {
+            OsDeleteSortLink(sortList);
+            work->state = OS_WORK_IDLE;
+        }
+    }
+}
+
+UINT32 OsWorkQueueInit(VOID)
+{
+    UINT32 ret;
+
+    (VOID)memset_s(g_workQueueCB, sizeof(g_workQueueCB), 0, sizeof(g_workQueueCB));
+
+    ret = OsSortLinkInit(&g_workSortLink);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    return OsSchedWorkScanRegister((SchedScan)OsWorkScan);
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_WorkQueueCreate(const CHAR *name, UINT16 priority, UINT32 stackSize, UINT32 *queueID)
+{
+    UINT32 intSave;
+    UINT32 index;
+    UINT32 ret;
+    TSK_INIT_PARAM_S taskParam;
+    WorkQueueCB *queue = NULL;
+
+    if (queueID == NULL) {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_WORKQUEUE_IN_INTERRUPT;
+    }
+
+    intSave = LOS_IntLock();
+    for (index = 0; index < LOSCFG_BASE_CORE_WORKQUEUE_LIMIT; index++) {
+        if (g_workQueueCB[index].state == OS_WORKQUEUE_UNUSED) {
+            queue = &g_workQueueCB[index];
+            queue->state = OS_WORKQUEUE_USED;
+            break;
+        }
+    }
+    LOS_IntRestore(intSave);
+
+    if (queue == NULL) {
+        return LOS_ERRNO_WORKQUEUE_UNAVAILABLE;
+    }
+
+    LOS_ListInit(&queue->pendList);
+    (VOID)LOS_EventInit(&queue->event);
+    queue->pendingNum = 0;
+    (VOID)memset_s(&queue->stat, sizeof(LOS_WORKQUEUE_STAT_S), 0, sizeof(LOS_WORKQUEUE_STAT_S));
+
+    (VOID)memset_s(&taskParam, sizeof(TSK_INIT_PARAM_S), 0, sizeof(TSK_INIT_PARAM_S));
+    taskParam.pfnTaskEntry = (TSK_ENTRY_FUNC)OsWorkQueueTask;
+    taskParam.uwStackSize = stackSize;
+    taskParam.pcName = (CHAR *)name;
+    taskParam.usTaskPrio = priority;
+    taskParam.uwArg = index;
+    ret = LOS_TaskCreate(&queue->taskID, &taskParam);
+    if (ret != LOS_OK) {
+        queue->state = OS_WORKQUEUE_UNUSED;
+        return ret;
+    }
+
+    *queueID = index;
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_WorkQueueDelete(UINT32 queueID)
+{
+    UINT32 intSave;
+    WorkQueueCB *queue = NULL;
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_WORKQUEUE_IN_INTERRUPT;
+    }
+    OS_WORKQUEUE_CHECK(queueID);
+
+    queue = &g_workQueueCB[queueID];
+    intSave = LOS_IntLock();
+    if (queue->state != OS_WORKQUEUE_USED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_WORKQUEUE_NOT_CREATED;
+    }
+
+    while (!LOS_ListEmpty(&queue->pendList)) {
+        LOS_WORK_S *work = LOS_DL_LIST_ENTRY(queue->pendList.pstNext, LOS_WORK_S, pendList);
+        LOS_ListDelete(&work->pendList);
+        work->state = OS_WORK_IDLE;
+    }
+    queue->pendingNum = 0;
+    OsWorkDelayedCancel(queueID);
+    queue->state = OS_WORKQUEUE_DELETING;
+    LOS_IntRestore(intSave);
+
+    (VOID)LOS_EventWrite(&queue->event, OS_WORKQUEUE_EVENT_EXIT);
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_WorkInit(LOS_WORK_S *work, WORK_PROC_FUNC handler, VOID *arg)
+{
+    if ((work == NULL) || (handler == NULL)) {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    (VOID)memset_s(work, sizeof(LOS_WORK_S), 0, sizeof(LOS_WORK_S));
+    work->handler = handler;
+    work->arg = arg;
+    work->state = OS_WORK_IDLE;
+    SET_SORTLIST_VALUE(&work->sortList, OS_SORT_LINK_INVALID_TIME);
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+    work->sortList.slack = OsSchedSlackUsToCycle(LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US);
+#endif
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_WorkSubmitDelayed(UINT32 queueID, LOS_WORK_S *work, UINT32 delayTicks)
+{
+    UINT32 intSave;
+    BOOL wake = FALSE;
+    WorkQueueCB *queue = NULL;
+
+    if (work == NULL) {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+    OS_WORKQUEUE_CHECK(queueID);
+
+    queue = &g_workQueueCB[queueID];
+    intSave = LOS_IntLock();
+    if (queue->state != OS_WORKQUEUE_USED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_WORKQUEUE_NOT_CREATED;
+    }
+
+    if (work->state != OS_WORK_IDLE) {
+        if (work->queueID != queueID) {
+            LOS_IntRestore(intSave);
+            return LOS_ERRNO_WORKQUEUE_WORK_BUSY;
+        }
+        /* An immediate submission brings a delayed work forward, anything else is already queued */
+        if ((delayTicks != 0) || (work->state == OS_WORK_PENDING)) {
+            LOS_IntRestore(intSave);
+            return LOS_OK;
+        }
+        OsDeleteSortLink(&work->sortList);
+    }
+
+    work->queueID = (UINT16)queueID;
+    if (delayTicks == 0) {
+        wake = OsWorkEnqueue(queue, work, OsGetCurrSchedTimeCycle());
+    } else {
+        work->state = OS_WORK_DELAYED;
+        OsAdd2SortLink(&work->sortList, OsGetCurrSchedTimeCycle(), delayTicks, OS_SORT_LINK_WORK);
+        OsSchedUpdateExpireTime();
+    }
+    LOS_IntRestore(intSave);
+
+    if (wake) {
+        (VOID)LOS_EventWrite(&queue->event, OS_WORKQUEUE_EVENT_RUN);
+    }
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_WorkSubmit(UINT32 queueID, LOS_WORK_S *work)
+{
+    return LOS_WorkSubmitDelayed(queueID, work, 0);
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_WorkCancel(LOS_WORK_S *work)
+{
+    UINT32 intSave;
+
+    if (work == NULL) {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    intSave = LOS_IntLock();
+    if (work->state == OS_WORK_PENDING) {
+        LOS_ListDelete(&work->pendList);
+        g_workQueueCB[work->queueID].pendingNum--;
+    } else if (work->state == OS_WORK_DELAYED) {
+        OsDeleteSortLink(&work->sortList);
+    } else {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_WORKQUEUE_WORK_NOT_PENDING;
+    }
+    work->state = OS_WORK_IDLE;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+LITE_OS_SEC_TEXT UINT32 LOS_WorkQueueStatGet(UINT32 queueID, LOS_WORKQUEUE_STAT_S *stat)
+{
+    UINT32 intSave;
+
+    if (stat == NULL) {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+    OS_WORKQUEUE_CHECK(queueID);
+
+    intSave = LOS_IntLock();
+    if (g_workQueueCB[queueID].state == OS_WORKQUEUE_UNUSED) {
+        LOS_IntRestore(intSave);
+        return LOS_ERRNO_WORKQUEUE_NOT_CREATED;
+    }
+    *stat = g_workQueueCB[queueID].stat;
+    LOS_IntRestore(intSave);
+    return LOS_OK;
+}
+
+/*
+ * Threaded interrupts: the interrupt is registered with a trampoline which masks it and submits a work, the
+ * handler then runs in the threaded interrupt work queue and unmasks the interrupt when it returns.
+ */
+#if (LOSCFG_PLATFORM_HWI_WITH_ARG == 1)
+#define OS_HWI_THREAD_UNUSED        0
+#define OS_HWI_THREAD_USED          1
+#define OS_HWI_THREAD_DELETING      2
+
+#define OS_HWI_THREAD_EVENT_DONE    0x1U
+
+typedef struct {
+    HWI_HANDLE_T    hwiNum;
+    HWI_PROC_FUNC   handler;
+    VOID            *devID;
+    LOS_WORK_S      work;
+    EVENT_CB_S      event;          /* Wakes the task deleting the interrupt once the handler returns */
+    UINT16          state;
+    BOOL            busy;           /* From the submission of the work until the handler returns */
+} HwiThread;
+
+LITE_OS_SEC_BSS STATIC HwiThread g_hwiThread[LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT];
+LITE_OS_SEC_DATA_INIT STATIC UINT32 g_hwiWorkQueueID = OS_WORKQUEUE_INVALID_ID;
+
+STATIC VOID OsHwiThreadIsr(VOID *arg)
+{
+    HwiThread *thread = (HwiThread *)arg;
+
+    (VOID)LOS_HwiDisable(thread->hwiNum);
+    thread->busy = TRUE;
+    (VOID)LOS_WorkSubmit(g_hwiWorkQueueID, &thread->work);
+}
+
+STATIC VOID OsHwiThreadWork(VOID *arg)
+{
+    UINT32 intSave;
+    UINT16 state;
+    HwiThread *thread = (HwiThread *)arg;
+
+    /* The work may have been taken by the work queue task just before the interrupt was deleted */
+    intSave = LOS_IntLock();
+    state = thread->state;
+    LOS_IntRestore(intSave);
+    if (state == OS_HWI_THREAD_USED) {
+        thread->handler(thread->devID);
+    }
+
+    intSave = LOS_IntLock();
+    thread->busy = FALSE;
+    state = thread->state;
+    if (state == OS_HWI_THREAD_USED) {
+        (VOID)LOS_HwiEnable(thread->hwiNum);
+    }
+    LOS_IntRestore(intSave);
+
+    if (state == OS_HWI_THREAD_DELETING) {
+        (VOID)LOS_EventWrite(&thread->event, OS_HWI_THREAD_EVENT_DONE);
+    }
+}
+
+STATIC INLINE BOOL OsHwiThreadSelf(VOID)
+{
+    return (LOS_CurTaskIDGet() == g_workQueueCB[g_hwiWorkQueueID].taskID);
+}
+
+STATIC HwiThread *OsHwiThreadFind(HWI_HANDLE_T hwiNum)
+{
+    UINT32 intSave = LOS_IntLock();
+    for (UINT32 index = 0; index < LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT; index++) {
+        HwiThread *thread = &g_hwiThread[index];
+        if ((thread->state == OS_HWI_THREAD_USED) && (thread->hwiNum == hwiNum)) {
+            LOS_IntRestore(intSave);
+            return thread;
+        }
+    }
+    LOS_IntRestore(intSave);
+    return NULL;
+}
+
+/*
+ * Called once the interrupt is deleted, the slot is released after the handler returns so that the caller can free
+ * the handler context. A handler deleting its own interrupt can not wait for itself, the slot is released at once.
+ */
+STATIC VOID OsHwiThreadRelease(HwiThread *thread)
+{
+    UINT32 intSave = LOS_IntLock();
+    if (LOS_WorkCancel(&thread->work) == LOS_OK) {
+        thread->busy = FALSE;
+    }
+    if (!thread->busy || OsHwiThreadSelf()) {
+        thread->state = OS_HWI_THREAD_UNUSED;
+        LOS_IntRestore(intSave);
+        return;
+    }
+    thread->state = OS_HWI_THREAD_DELETING;
+    LOS_IntRestore(intSave);
+
+    (VOID)LOS_EventRead(&thread->event, OS_HWI_THREAD_EVENT_DONE, LOS_WAITMODE_OR | LOS_WAITMODE_CLR,
+                        LOS_WAIT_FOREVER);
+    thread->state = OS_HWI_THREAD_UNUSED;
+}
+
+STATIC UINT32 OsHwiThreadQueueCreate(VOID)
+{
+    UINT32 ret = LOS_OK;
+
+    LOS_TaskLock();
+    if (g_hwiWorkQueueID == OS_WORKQUEUE_INVALID_ID) {
+        ret = LOS_WorkQueueCreate("HwiThread", LOSCFG_BASE_CORE_WORKQUEUE_HWI_PRIO,
+                                  LOSCFG_BASE_CORE_WORKQUEUE_HWI_STACK_SIZE, &g_hwiWorkQueueID);
+    }
+    LOS_TaskUnlock();
+    return ret;
+}
+#endif
+
+UINT32 OsHwiCreate(HWI_HANDLE_T hwiNum, HWI_PRIOR_T hwiPrio, HWI_MODE_T mode,
+                   HWI_PROC_FUNC handler, HwiIrqParam *irqParam)
+{
+    if (!(mode & LOS_HWI_MODE_THREADED)) {
+        return ArchHwiCreate(hwiNum, hwiPrio, mode, handler, irqParam);
+    }
+
+#if (LOSCFG_PLATFORM_HWI_WITH_ARG == 1)
+    UINT32 intSave;
+    UINT32 index;
+    UINT32 ret;
+    HwiIrqParam param = { 0 };
+    HwiThread *thread = NULL;
+
+    if (handler == NULL) {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    /* A direct handler is entered from the vector table, the trampoline could not run it */
+    if (mode & LOS_HWI_MODE_DIRECT) {
+        return LOS_ERRNO_WORKQUEUE_HWI_MODE_INVALID;
+    }
+
+    if (OS_INT_ACTIVE) {
+        return LOS_ERRNO_WORKQUEUE_IN_INTERRUPT;
+    }
+
+    ret = OsHwiThreadQueueCreate();
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+    intSave = LOS_IntLock();
+    for (index = 0; index < LOSCFG_BASE_CORE_WORKQUEUE_HWI_LIMIT; index++) {
+        if (g_hwiThread[index].state == OS_HWI_THREAD_UNUSED) {
+            thread = &g_hwiThread[index];
+            thread->state = OS_HWI_THREAD_USED;
+            thread->busy = FALSE;
+            break;
+        }
+    }
+    LOS_IntRestore(intSave);
+
+    if (thread == NULL) {
+        return LOS_ERRNO_WORKQUEUE_HWI_UNAVAILABLE;
+    }
+
+    thread->hwiNum = hwiNum;
+    thread->handler = handler;
+    thread->devID = (irqParam != NULL) ? irqParam->pDevId : NULL;
+    (VOID)LOS_WorkInit(&thread->work, OsHwiThreadWork, thread);
+    (VOID)LOS_EventInit(&thread->event);
+
+    if (irqParam != NULL) {
+        param = *irqParam;
+    }
+    param.pDevId = thread;
+    ret = ArchHwiCreate(hwiNum, hwiPrio, mode & ~LOS_HWI_MODE_THREADED, (HWI_PROC_FUNC)OsHwiThreadIsr, &param);
+    if (ret != LOS_OK) {
+        thread->state = OS_HWI_THREAD_UNUSED;
+    }
+    return ret;
+#else
+    (VOID)hwiNum;
+    (VOID)hwiPrio;
+    (VOID)handler;
+    (VOID)irqParam;
+    return LOS_ERRNO_WORKQUEUE_HWI_UNSUPPORTED;
+#endif
+}
+
+UINT32 OsHwiDelete(HWI_HANDLE_T hwiNum, HwiIrqParam *irqParam)
+{
+    UINT32 ret;
+
+#if (LOSCFG_PLATFORM_HWI_WITH_ARG == 1)
+    /* Deleting a threaded interrupt may have to wait for its handler */
+    HwiThread *thread = OsHwiThreadFind(hwiNum);
+    if ((thread != NULL) && !OsHwiThreadSelf()) {
+        if (OS_INT_ACTIVE) {
+            return LOS_ERRNO_WORKQUEUE_IN_INTERRUPT;
+        }
+        if (g_losTaskLock != 0) {
+            return LOS_ERRNO_WORKQUEUE_PEND_IN_LOCK;
+        }
+    }
+#endif
+
+    ret = ArchHwiDelete(hwiNum, irqParam);
+    if (ret != LOS_OK) {
+        return ret;
+    }
+
+#if (LOSCFG_PLATFORM_HWI_WITH_ARG == 1)
+    if (thread != NULL) {
+        OsHwiThreadRelease(thread);
+    }
+#endif
+    return LOS_OK;
+}
+
+#endif /* LOSCFG_BASE_CORE_WORKQUEUE */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
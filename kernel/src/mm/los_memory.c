@@ -163,6 +163,13 @@ struct OsMemPoolInfo {
 #if (LOSCFG_MEM_MUL_REGIONS == 1)
     UINT32 totalGapSize;
 #endif
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+    UINT32 freeSize;    /* Current total size of free nodes */
+    UINT32 freeNodeNum; /* Current number of free nodes */
+#endif
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    LOS_MEM_REALLOC_STAT reallocStat;
+#endif
 };
 
 struct OsMemPoolHead {
@@ -204,6 +211,11 @@ struct OsMemPoolHead {
 #else
 #define OS_MEM_NODE_LAST_FLAG      0
 #endif
+#if (LOSCFG_MEM_HANDLE == 1)
+#define OS_MEM_NODE_HANDLE_FLAG    (1U << 21)  /* Movable node owned by a handle */
+#else
+#define OS_MEM_NODE_HANDLE_FLAG    0
+#endif
 #else
 #define OS_MEM_NODE_USED_FLAG      (1U << 31)
 #define OS_MEM_NODE_ALIGNED_FLAG   (1U << 30)
@@ -217,10 +229,23 @@ struct OsMemPoolHead {
 #else
 #define OS_MEM_NODE_LAST_FLAG      0
 #endif
+#if (LOSCFG_MEM_HANDLE == 1)
+#define OS_MEM_NODE_HANDLE_FLAG    (1U << 27)  /* Movable node owned by a handle */
+#else
+#define OS_MEM_NODE_HANDLE_FLAG    0
+#endif
 #endif
 
 #define OS_MEM_NODE_ALIGNED_AND_USED_FLAG \
-    (OS_MEM_NODE_USED_FLAG | OS_MEM_NODE_ALIGNED_FLAG | OS_MEM_NODE_LEAK_FLAG | OS_MEM_NODE_LAST_FLAG)
+    (OS_MEM_NODE_USED_FLAG | OS_MEM_NODE_ALIGNED_FLAG | OS_MEM_NODE_LEAK_FLAG | OS_MEM_NODE_LAST_FLAG | \
+     OS_MEM_NODE_HANDLE_FLAG)
+
+/*
+ * The flags share the word with the node size, so a node must stay below the lowest flag in use. With
+ * LOSCFG_MEM_FREE_BY_TASKID and LOSCFG_MEM_HANDLE this is 2MB.
+ */
+#define OS_MEM_NODE_SIZE_MAX \
+    ((OS_MEM_NODE_ALIGNED_AND_USED_FLAG & (~OS_MEM_NODE_ALIGNED_AND_USED_FLAG + 1U)) - 1U)
 
 #define OS_MEM_NODE_GET_ALIGNED_FLAG(sizeAndFlag) \
             ((sizeAndFlag) & OS_MEM_NODE_ALIGNED_FLAG)
@@ -253,6 +278,10 @@ struct OsMemPoolHead {
             ((sizeAndFlag) & OS_MEM_NODE_LAST_FLAG)
 #define OS_MEM_NODE_GET_LEAK_FLAG(sizeAndFlag) \
             ((sizeAndFlag) & OS_MEM_NODE_LEAK_FLAG)
+#define OS_MEM_NODE_GET_HANDLE_FLAG(sizeAndFlag) \
+            ((sizeAndFlag) & OS_MEM_NODE_HANDLE_FLAG)
+#define OS_MEM_NODE_SET_HANDLE_FLAG(sizeAndFlag) \
+            (sizeAndFlag) = ((sizeAndFlag) | OS_MEM_NODE_HANDLE_FLAG)
 #define OS_MEM_NODE_SET_LEAK_FLAG(sizeAndFlag) \
             (sizeAndFlag) = ((sizeAndFlag) | OS_MEM_NODE_LEAK_FLAG)
 
@@ -303,6 +332,9 @@ STATIC INLINE UINT32 OsMemAllocCheck(struct OsMemPoolHead *pool, UINT32 intSave)
 STATIC INLINE VOID OsMemFreeNodeAdd(VOID *pool, struct OsMemFreeNodeHead *node);
 STATIC INLINE UINT32 OsMemFree(struct OsMemPoolHead *pool, struct OsMemNodeHead *node);
 STATIC VOID OsMemInfoPrint(VOID *pool);
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+STATIC VOID OsMemFragInfoPrint(VOID *pool);
+#endif
 
 #if (LOSCFG_MEM_FREE_BY_TASKID == 1 || LOSCFG_TASK_MEM_USED == 1)
 STATIC INLINE VOID OsMemNodeSetTaskID(struct OsMemUsedNodeHead *node)
@@ -849,6 +881,32 @@ STATIC INLINE VOID OsMemClearFreeListBit(struct OsMemPoolHead *head, UINT32 inde
     head->freeListBitmap[index >> 5] &= ~(1U << (index & 0x1f));
 }
 
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+STATIC INLINE VOID OsMemFragStatAdd(struct OsMemPoolHead *pool, const struct OsMemFreeNodeHead *node)
+{
+    pool->info.freeSize += OS_MEM_NODE_GET_SIZE(node->header.sizeAndFlag);
+    pool->info.freeNodeNum++;
+}
+
+STATIC INLINE VOID OsMemFragStatDelete(struct OsMemPoolHead *pool, const struct OsMemFreeNodeHead *node)
+{
+    pool->info.freeSize -= OS_MEM_NODE_GET_SIZE(node->header.sizeAndFlag);
+    pool->info.freeNodeNum--;
+}
+#else
+STATIC INLINE VOID OsMemFragStatAdd(struct OsMemPoolHead *pool, const struct OsMemFreeNodeHead *node)
+{
+    (VOID)pool;
+    (VOID)node;
+}
+
+STATIC INLINE VOID OsMemFragStatDelete(struct OsMemPoolHead *pool, const struct OsMemFreeNodeHead *node)
+{
+    (VOID)pool;
+    (VOID)node;
+}
+#endif
+
 /**
  * @brief 使用头插法，将node插入双向链表中，并更新bitmap
  * 
@@ -869,6 +927,7 @@ STATIC INLINE VOID OsMemListAdd(struct OsMemPoolHead *pool, UINT32 listIndex, st
     pool->freeList[listIndex] = node;
     // 更新bitmap
     OsMemSetFreeListBit(pool, listIndex);
+    OsMemFragStatAdd(pool, node);
     OS_MEM_SET_MAGIC(&node->header);
 }
 
@@ -895,6 +954,7 @@ STATIC INLINE VOID OsMemListDelete(struct OsMemPoolHead *pool, UINT32 listIndex,
             node->next->prev = node->prev;
         }
     }
+    OsMemFragStatDelete(pool, node);
     OS_MEM_SET_MAGIC(&node->header);
 }
 
@@ -1141,6 +1201,11 @@ UINT32 LOS_MemInit(VOID *pool, UINT32 size)
         return LOS_NOK;
     }
 
+    if (size > OS_MEM_NODE_SIZE_MAX) {
+        PRINT_ERR("LiteOS heap memory size 0x%x is above the node size limit 0x%x\n", size, OS_MEM_NODE_SIZE_MAX);
+        return LOS_NOK;
+    }
+
     // 起始地没有按4字节对齐 或 size没有按4字节对齐
     if (((UINTPTR)pool & (OS_MEM_ALIGN_SIZE - 1)) || \
         (size & (OS_MEM_ALIGN_SIZE - 1))) {
@@ -1198,6 +1263,25 @@ UINT32 LOS_MemPoolList(VOID)
 }
 #endif
 
+STATIC INLINE VOID *OsMemUsedNodeSet(struct OsMemPoolHead *pool, struct OsMemNodeHead *allocNode, UINT32 allocSize)
+{
+    // 如果申请到的内存块大小大于等于 所需大小，对内存块进行切分
+    if ((allocSize + OS_MEM_MIN_LEFT_SIZE) <= allocNode->sizeAndFlag) {
+        OsMemSplitNode(pool, allocNode, allocSize);
+    }
+
+    // 设置被使用flag
+    OS_MEM_NODE_SET_USED_FLAG(allocNode->sizeAndFlag);
+    // 更新内存使用情况
+    OsMemWaterUsedRecord(pool, OS_MEM_NODE_GET_SIZE(allocNode->sizeAndFlag));
+
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+    OsMemLinkRegisterRecord(allocNode);
+#endif
+    // 返回用户真正可用的起始地址，即head下一个字节的地址
+    return OsMemCreateUsedNode((VOID *)allocNode);
+}
+
 STATIC INLINE VOID *OsMemAlloc(struct OsMemPoolHead *pool, UINT32 size, UINT32 intSave)
 {
     struct OsMemNodeHead *allocNode = NULL;
@@ -1210,6 +1294,10 @@ STATIC INLINE VOID *OsMemAlloc(struct OsMemPoolHead *pool, UINT32 size, UINT32 i
 
     // 申请的内存大小需要加上头结点的大小，并以4字节对齐
     UINT32 allocSize = OS_MEM_ALIGN(size + OS_MEM_NODE_HEAD_SIZE, OS_MEM_ALIGN_SIZE);
+    if (allocSize > OS_MEM_NODE_SIZE_MAX) {
+        PRINT_ERR("[%s] Size 0x%x is above the node size limit 0x%x\n", __FUNCTION__, size, OS_MEM_NODE_SIZE_MAX);
+        return NULL;
+    }
 #if OS_MEM_EXPAND_ENABLE || (LOSCFG_KERNEL_LMK == 1)
 retry:
 #endif
@@ -1236,6 +1324,9 @@ retry:
                   "--------------------------------------------------------\n");
         MEM_UNLOCK(pool, intSave);
         OsMemInfoPrint(pool);
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+        OsMemFragInfoPrint(pool);
+#endif
         MEM_LOCK(pool, intSave);
         PRINT_ERR("[%s] No suitable free block, require free node size: 0x%x\n", __FUNCTION__, allocSize);
         PRINT_ERR("----------------------------------------------------"
@@ -1243,21 +1334,7 @@ retry:
         return NULL;
     }
 
-    // 如果申请到的内存块大小大于等于 所需大小，对内存块进行切分
-    if ((allocSize + OS_MEM_MIN_LEFT_SIZE) <= allocNode->sizeAndFlag) {
-        OsMemSplitNode(pool, allocNode, allocSize);
-    }
-
-    // 设置被使用flag
-    OS_MEM_NODE_SET_USED_FLAG(allocNode->sizeAndFlag);
-    // 更新内存使用情况
-    OsMemWaterUsedRecord(pool, OS_MEM_NODE_GET_SIZE(allocNode->sizeAndFlag));
-
-#if (LOSCFG_MEM_LEAKCHECK == 1)
-    OsMemLinkRegisterRecord(allocNode);
-#endif
-    // 返回用户真正可用的起始地址，即head下一个字节的地址
-    return OsMemCreateUsedNode((VOID *)allocNode);
+    return OsMemUsedNodeSet(pool, allocNode, allocSize);
 }
 
 VOID *LOS_MemAlloc(VOID *pool, UINT32 size)
@@ -1559,6 +1636,11 @@ UINT32 LOS_MemFree(VOID *pool, VOID *ptr)
         }
         // 获取内存头结点地址
         node = (struct OsMemNodeHead *)((UINTPTR)ptr - OS_MEM_NODE_HEAD_SIZE);
+        // 由句柄管理的可移动内存块只能通过 LOS_MemHandleFree 释放
+        if (OS_MEM_NODE_GET_HANDLE_FLAG(node->sizeAndFlag)) {
+            PRINT_ERR("[%s] the node is owned by a memory handle\n", __FUNCTION__);
+            break;
+        }
         // 释放内存
         ret = OsMemFree(poolHead, node);
     } while (0);
@@ -1614,42 +1696,137 @@ STATIC INLINE VOID OsMemMergeNodeForReAllocBigger(VOID *pool, UINT32 allocSize,
 #endif
 }
 
+/*
+ * Grow the node into the free node in front of it (and the free node behind it, if any), the data is moved down:
+ * | free(preNode) | used(node) | free(nextNode) |  ===>  | used(preNode)         | free |
+ */
+STATIC INLINE VOID *OsMemMergeNodeForReAllocBackward(VOID *pool, UINT32 allocSize, struct OsMemNodeHead *node,
+                                                     UINT32 nodeSize, struct OsMemNodeHead *preNode)
+{
+    struct OsMemNodeHead *nextNode = OS_MEM_NEXT_NODE(node);
+    UINT32 preSize = OS_MEM_NODE_GET_SIZE(preNode->sizeAndFlag);
+#if (LOSCFG_MEM_FREE_BY_TASKID == 1 || LOSCFG_TASK_MEM_USED == 1)
+    UINT32 taskID = node->taskID;
+#endif
+
+    node->sizeAndFlag = nodeSize;
+    if (!OS_MEM_NODE_GET_USED_FLAG(nextNode->sizeAndFlag)) {
+        OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)nextNode);
+        OsMemMergeNode(nextNode);
+    }
+    OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)preNode);
+    OsMemMergeNode(node);
+
+    /* The head of the node may be overwritten by the move, all the information needed is saved above. */
+    (VOID)memmove_s((UINT8 *)preNode + OS_MEM_NODE_HEAD_SIZE, preSize + nodeSize - OS_MEM_NODE_HEAD_SIZE,
+                    (UINT8 *)node + OS_MEM_NODE_HEAD_SIZE, nodeSize - OS_MEM_NODE_HEAD_SIZE);
+#if (LOSCFG_MEM_FREE_BY_TASKID == 1 || LOSCFG_TASK_MEM_USED == 1)
+    preNode->taskID = taskID;
+#endif
+#ifdef LOSCFG_KERNEL_LMS
+    OsLmsReallocMergeNodeMark(preNode);
+#endif
+    if ((allocSize + OS_MEM_MIN_LEFT_SIZE) <= preNode->sizeAndFlag) {
+        OsMemSplitNode(pool, preNode, allocSize);
+#ifdef LOSCFG_KERNEL_LMS
+        OsLmsReallocSplitNodeMark(preNode);
+    } else {
+        OsLmsReallocResizeMark(preNode, allocSize);
+#endif
+    }
+    OS_MEM_NODE_SET_USED_FLAG(preNode->sizeAndFlag);
+    OsMemWaterUsedRecord((struct OsMemPoolHead *)pool, OS_MEM_NODE_GET_SIZE(preNode->sizeAndFlag) - nodeSize);
+#if (LOSCFG_MEM_LEAKCHECK == 1)
+    OsMemLinkRegisterRecord(preNode);
+#endif
+    return (VOID *)((UINTPTR)preNode + OS_MEM_NODE_HEAD_SIZE);
+}
+
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+#define OS_MEM_REALLOC_STAT_INC(pool, member)   ((pool)->info.reallocStat.member++)
+#else
+#define OS_MEM_REALLOC_STAT_INC(pool, member)
+#endif
+
+/* The size to keep when the node can grow to availSize in place, the reserved size is kept if possible. */
+#define OS_MEM_REALLOC_KEEP_SIZE(availSize, reserveSize) \
+    (((availSize) < (reserveSize)) ? (availSize) : (reserveSize))
+
 STATIC INLINE VOID *OsMemRealloc(struct OsMemPoolHead *pool, const VOID *ptr,
-                struct OsMemNodeHead *node, UINT32 size, UINT32 intSave)
+                struct OsMemNodeHead *node, UINT32 size, UINT32 reserve, UINT32 intSave)
 {
     struct OsMemNodeHead *nextNode = NULL;
+    struct OsMemNodeHead *preNode = NULL;
+    struct OsMemNodeHead *allocNode = NULL;
     UINT32 allocSize = OS_MEM_ALIGN(size + OS_MEM_NODE_HEAD_SIZE, OS_MEM_ALIGN_SIZE);
     UINT32 nodeSize = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    UINT32 reserveSize = allocSize;
+    UINT32 availSize;
     VOID *tmpPtr = NULL;
 
+    if (reserve > size) {
+        reserveSize = OS_MEM_ALIGN(reserve + OS_MEM_NODE_HEAD_SIZE, OS_MEM_ALIGN_SIZE);
+    }
+
     if (nodeSize >= allocSize) {
-        OsMemReAllocSmaller(pool, allocSize, node, nodeSize);
+        OsMemReAllocSmaller(pool, OS_MEM_REALLOC_KEEP_SIZE(nodeSize, reserveSize), node, nodeSize);
+        OS_MEM_REALLOC_STAT_INC(pool, inPlaceCount);
         return (VOID *)ptr;
     }
 
+    availSize = nodeSize;
     nextNode = OS_MEM_NEXT_NODE(node);
-    if (!OS_MEM_NODE_GET_USED_FLAG(nextNode->sizeAndFlag) &&
-        ((nextNode->sizeAndFlag + nodeSize) >= allocSize)) {
-        OsMemMergeNodeForReAllocBigger(pool, allocSize, node, nodeSize, nextNode);
-        return (VOID *)ptr;
+    if (!OS_MEM_NODE_GET_USED_FLAG(nextNode->sizeAndFlag)) {
+        availSize += nextNode->sizeAndFlag;
+        if (availSize >= allocSize) {
+            OsMemMergeNodeForReAllocBigger(pool, OS_MEM_REALLOC_KEEP_SIZE(availSize, reserveSize), node, nodeSize,
+                                           nextNode);
+            OS_MEM_REALLOC_STAT_INC(pool, inPlaceCount);
+            return (VOID *)ptr;
+        }
     }
 
-    tmpPtr = OsMemAlloc(pool, size, intSave);
+    /* The gap size of the aligned node is stored in front of the aligned address, so it can not be moved. */
+    preNode = node->ptr.prev;
+    if (!OS_MEM_NODE_GET_ALIGNED_FLAG(node->sizeAndFlag) && (preNode != NULL) &&
+        !OS_MEM_NODE_GET_USED_FLAG(preNode->sizeAndFlag)) {
+        availSize += preNode->sizeAndFlag;
+        if (availSize >= allocSize) {
+            OS_MEM_REALLOC_STAT_INC(pool, backwardCount);
+            return OsMemMergeNodeForReAllocBackward(pool, OS_MEM_REALLOC_KEEP_SIZE(availSize, reserveSize), node,
+                                                    nodeSize, preNode);
+        }
+    }
+
+    if (reserveSize > allocSize) {
+        allocNode = OsMemFreeNodeGet(pool, reserveSize);
+        if (allocNode != NULL) {
+            tmpPtr = OsMemUsedNodeSet(pool, allocNode, reserveSize);
+        }
+    }
+    if (tmpPtr == NULL) {
+        tmpPtr = OsMemAlloc(pool, size, intSave);
+    }
     if (tmpPtr != NULL) {
         if (memcpy_s(tmpPtr, size, ptr, (nodeSize - OS_MEM_NODE_HEAD_SIZE)) != EOK) {
             MEM_UNLOCK(pool, intSave);
             (VOID)LOS_MemFree((VOID *)pool, (VOID *)tmpPtr);
             MEM_LOCK(pool, intSave);
+            OS_MEM_REALLOC_STAT_INC(pool, failCount);
             return NULL;
         }
         (VOID)OsMemFree(pool, node);
+        OS_MEM_REALLOC_STAT_INC(pool, copyCount);
+    } else {
+        OS_MEM_REALLOC_STAT_INC(pool, failCount);
     }
     return tmpPtr;
 }
 
-VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size)
+STATIC VOID *OsMemReallocReserve(VOID *pool, VOID *ptr, UINT32 size, UINT32 reserve)
 {
-    if ((pool == NULL) || OS_MEM_NODE_GET_USED_FLAG(size) || OS_MEM_NODE_GET_ALIGNED_FLAG(size)) {
+    if ((pool == NULL) || OS_MEM_NODE_GET_USED_FLAG(size) || OS_MEM_NODE_GET_ALIGNED_FLAG(size) ||
+        OS_MEM_NODE_GET_USED_FLAG(reserve) || OS_MEM_NODE_GET_ALIGNED_FLAG(reserve)) {
         return NULL;
     }
 
@@ -1685,13 +1862,336 @@ VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size)
             break;
         }
 
-        newPtr = OsMemRealloc(pool, ptr, node, size, intSave);
+        if (OS_MEM_NODE_GET_HANDLE_FLAG(node->sizeAndFlag)) {
+            PRINT_ERR("[%s] the node is owned by a memory handle\n", __FUNCTION__);
+            break;
+        }
+
+        newPtr = OsMemRealloc(pool, ptr, node, size, reserve, intSave);
     } while (0);
     MEM_UNLOCK(poolHead, intSave);
 
     return newPtr;
 }
 
+VOID *LOS_MemRealloc(VOID *pool, VOID *ptr, UINT32 size)
+{
+    return OsMemReallocReserve(pool, ptr, size, 0);
+}
+
+VOID *LOS_MemReallocHint(VOID *pool, VOID *ptr, UINT32 size, UINT32 reserve)
+{
+    return OsMemReallocReserve(pool, ptr, size, reserve);
+}
+
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+UINT32 LOS_MemReallocStatGet(VOID *pool, LOS_MEM_REALLOC_STAT *reallocStat)
+{
+    struct OsMemPoolHead *poolInfo = (struct OsMemPoolHead *)pool;
+    UINT32 intSave = 0;
+
+    if (reallocStat == NULL) {
+        PRINT_ERR("can't use NULL addr to save info\n");
+        return LOS_NOK;
+    }
+
+    if ((poolInfo == NULL) || ((UINTPTR)pool != (UINTPTR)poolInfo->info.pool)) {
+        PRINT_ERR("wrong mem pool addr: 0x%x, line: %d\n", (UINTPTR)poolInfo, __LINE__);
+        return LOS_NOK;
+    }
+
+    MEM_LOCK(poolInfo, intSave);
+    *reallocStat = poolInfo->info.reallocStat;
+    MEM_UNLOCK(poolInfo, intSave);
+
+    return LOS_OK;
+}
+#endif
+
+#if (LOSCFG_MEM_HANDLE == 1)
+/* The handle consists of the sequence number of the entry (high 16 bits) and the entry index (low 16 bits). */
+#define OS_MEM_HANDLE_INDEX_BITS        16
+#define OS_MEM_HANDLE_INDEX_MASK        0xFFFFU
+#define OS_MEM_HANDLE_INDEX(handle)     ((handle) & OS_MEM_HANDLE_INDEX_MASK)
+#define OS_MEM_HANDLE_SEQ(handle)       ((UINT16)((handle) >> OS_MEM_HANDLE_INDEX_BITS))
+#define OS_MEM_HANDLE_MAKE(seq, index)  (((UINT32)(seq) << OS_MEM_HANDLE_INDEX_BITS) | (index))
+#define OS_MEM_HANDLE_LOCK_MAX          0xFFFFU
+
+struct OsMemHandleEntry {
+    VOID *pool;         /* The pool which the block belongs to, NULL means the entry is unused */
+    VOID *ptr;          /* Current address of the block */
+    UINT16 lockCount;   /* The block can be moved only when lockCount is 0 */
+    UINT16 seq;         /* Increased on free, used to detect stale handles */
+};
+
+STATIC struct OsMemHandleEntry g_memHandleTable[LOSCFG_MEM_HANDLE_LIMIT];
+
+/* The pool of the handle, read before the pool is locked and checked again by OsMemHandleEntryGet afterwards. */
+STATIC INLINE struct OsMemPoolHead *OsMemHandlePoolGet(UINT32 handle)
+{
+    UINT32 index = OS_MEM_HANDLE_INDEX(handle);
+    struct OsMemPoolHead *pool = NULL;
+
+    if (index >= LOSCFG_MEM_HANDLE_LIMIT) {
+        return NULL;
+    }
+
+    pool = (struct OsMemPoolHead *)g_memHandleTable[index].pool;
+    if ((pool == NULL) || (pool->info.pool != pool)) {
+        return NULL;
+    }
+    return pool;
+}
+
+STATIC INLINE struct OsMemHandleEntry *OsMemHandleEntryGet(const struct OsMemPoolHead *pool, UINT32 handle)
+{
+    UINT32 index = OS_MEM_HANDLE_INDEX(handle);
+    struct OsMemHandleEntry *entry = NULL;
+
+    if (index >= LOSCFG_MEM_HANDLE_LIMIT) {
+        return NULL;
+    }
+
+    entry = &g_memHandleTable[index];
+    if ((entry->pool != pool) || (entry->ptr == NULL) || (entry->seq != OS_MEM_HANDLE_SEQ(handle))) {
+        return NULL;
+    }
+    return entry;
+}
+
+/* The table is shared by all pools, so a free entry is claimed with the interrupt locked. */
+STATIC struct OsMemHandleEntry *OsMemHandleEntryClaim(VOID *pool, UINT32 *index)
+{
+    struct OsMemHandleEntry *entry = NULL;
+    UINT32 intSave;
+    UINT32 i;
+
+    intSave = LOS_IntLock();
+    for (i = 0; i < LOSCFG_MEM_HANDLE_LIMIT; i++) {
+        if (g_memHandleTable[i].pool == NULL) {
+            entry = &g_memHandleTable[i];
+            entry->pool = pool;
+            entry->ptr = NULL;
+            entry->lockCount = 0;
+            *index = i;
+            break;
+        }
+    }
+    LOS_IntRestore(intSave);
+
+    return entry;
+}
+
+UINT32 LOS_MemHandleAlloc(VOID *pool, UINT32 size, UINT32 *handle)
+{
+    struct OsMemPoolHead *poolHead = (struct OsMemPoolHead *)pool;
+    struct OsMemHandleEntry *entry = NULL;
+    struct OsMemNodeHead *node = NULL;
+    VOID *ptr = NULL;
+    UINT32 index = 0;
+    UINT32 intSave = 0;
+
+    if ((poolHead == NULL) || (size == 0) || (handle == NULL)) {
+        return LOS_NOK;
+    }
+    *handle = LOS_MEM_HANDLE_INVALID;
+
+    if (poolHead->info.pool != pool) {
+        PRINT_ERR("wrong mem pool addr: 0x%x, line: %d\n", (UINTPTR)pool, __LINE__);
+        return LOS_NOK;
+    }
+
+    if (size < OS_MEM_MIN_ALLOC_SIZE) {
+        size = OS_MEM_MIN_ALLOC_SIZE;
+    }
+
+    if (OS_MEM_NODE_GET_USED_FLAG(size) || OS_MEM_NODE_GET_ALIGNED_FLAG(size)) {
+        return LOS_NOK;
+    }
+
+    entry = OsMemHandleEntryClaim(pool, &index);
+    if (entry == NULL) {
+        return LOS_NOK;
+    }
+
+    MEM_LOCK(poolHead, intSave);
+    ptr = OsMemAlloc(poolHead, size, intSave);
+    if (ptr != NULL) {
+        node = (struct OsMemNodeHead *)((UINTPTR)ptr - OS_MEM_NODE_HEAD_SIZE);
+        OS_MEM_NODE_SET_HANDLE_FLAG(node->sizeAndFlag);
+        entry->ptr = ptr;
+        *handle = OS_MEM_HANDLE_MAKE(entry->seq, index);
+    } else {
+        entry->pool = NULL;
+    }
+    MEM_UNLOCK(poolHead, intSave);
+
+    if (ptr == NULL) {
+        return LOS_NOK;
+    }
+
+    OsHookCall(LOS_HOOK_TYPE_MEM_ALLOC, pool, ptr, size);
+    return LOS_OK;
+}
+
+VOID *LOS_MemHandleLock(UINT32 handle)
+{
+    struct OsMemPoolHead *pool = OsMemHandlePoolGet(handle);
+    struct OsMemHandleEntry *entry = NULL;
+    VOID *ptr = NULL;
+    UINT32 intSave = 0;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    MEM_LOCK(pool, intSave);
+    entry = OsMemHandleEntryGet(pool, handle);
+    if ((entry != NULL) && (entry->lockCount < OS_MEM_HANDLE_LOCK_MAX)) {
+        entry->lockCount++;
+        ptr = entry->ptr;
+    }
+    MEM_UNLOCK(pool, intSave);
+
+    return ptr;
+}
+
+UINT32 LOS_MemHandleUnlock(UINT32 handle)
+{
+    struct OsMemPoolHead *pool = OsMemHandlePoolGet(handle);
+    struct OsMemHandleEntry *entry = NULL;
+    UINT32 ret = LOS_NOK;
+    UINT32 intSave = 0;
+
+    if (pool == NULL) {
+        return LOS_NOK;
+    }
+
+    MEM_LOCK(pool, intSave);
+    entry = OsMemHandleEntryGet(pool, handle);
+    if ((entry != NULL) && (entry->lockCount > 0)) {
+        entry->lockCount--;
+        ret = LOS_OK;
+    }
+    MEM_UNLOCK(pool, intSave);
+
+    return ret;
+}
+
+UINT32 LOS_MemHandleFree(UINT32 handle)
+{
+    struct OsMemPoolHead *pool = OsMemHandlePoolGet(handle);
+    struct OsMemHandleEntry *entry = NULL;
+    struct OsMemNodeHead *node = NULL;
+    VOID *ptr = NULL;
+    UINT32 ret = LOS_NOK;
+    UINT32 intSave = 0;
+
+    if (pool == NULL) {
+        return LOS_NOK;
+    }
+
+    MEM_LOCK(pool, intSave);
+    entry = OsMemHandleEntryGet(pool, handle);
+    if ((entry != NULL) && (entry->lockCount == 0)) {
+        ptr = entry->ptr;
+        node = (struct OsMemNodeHead *)((UINTPTR)ptr - OS_MEM_NODE_HEAD_SIZE);
+        ret = OsMemFree(pool, node);
+        /* The sequence number changes before the entry can be claimed again, so stale handles are rejected. */
+        entry->seq++;
+        entry->ptr = NULL;
+        entry->pool = NULL;
+    }
+    MEM_UNLOCK(pool, intSave);
+
+    if (ret == LOS_OK) {
+        OsHookCall(LOS_HOOK_TYPE_MEM_FREE, pool, ptr);
+    }
+    return ret;
+}
+
+/*
+ * Slide the block of the entry down into the free node in front of it:
+ * | free(preNode) | used(node) | next |  ===>  | used(newNode) | free(freeNode) + next if it is free |
+ */
+STATIC BOOL OsMemHandleMove(struct OsMemPoolHead *pool, struct OsMemHandleEntry *entry)
+{
+    struct OsMemNodeHead *node = (struct OsMemNodeHead *)((UINTPTR)entry->ptr - OS_MEM_NODE_HEAD_SIZE);
+    struct OsMemNodeHead *preNode = node->ptr.prev;
+    struct OsMemNodeHead *prePrevNode = NULL;
+    struct OsMemNodeHead *newNode = NULL;
+    struct OsMemNodeHead *nextNode = NULL;
+    struct OsMemFreeNodeHead *freeNode = NULL;
+    UINT32 nodeSize = OS_MEM_NODE_GET_SIZE(node->sizeAndFlag);
+    UINT32 freeSize;
+
+    if ((node == OS_MEM_FIRST_NODE(pool)) || OS_MEM_NODE_GET_USED_FLAG(preNode->sizeAndFlag)) {
+        return FALSE;
+    }
+
+    freeSize = OS_MEM_NODE_GET_SIZE(preNode->sizeAndFlag);
+    prePrevNode = preNode->ptr.prev;
+    OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)preNode);
+
+    /* The header is moved together with the data, so the flags, magic and task ID are kept. */
+    newNode = preNode;
+    (VOID)memmove_s(newNode, freeSize + nodeSize, node, nodeSize);
+    newNode->ptr.prev = prePrevNode;
+
+    freeNode = (struct OsMemFreeNodeHead *)(VOID *)((UINT8 *)newNode + nodeSize);
+    freeNode->header.sizeAndFlag = freeSize;
+    freeNode->header.ptr.prev = newNode;
+    OS_MEM_SET_MAGIC(&freeNode->header);
+
+    nextNode = OS_MEM_NEXT_NODE(&freeNode->header);
+    if (!OS_MEM_NODE_GET_LAST_FLAG(nextNode->sizeAndFlag) && !OS_MEM_IS_GAP_NODE(nextNode)) {
+        nextNode->ptr.prev = &freeNode->header;
+        if (!OS_MEM_NODE_GET_USED_FLAG(nextNode->sizeAndFlag)) {
+            OsMemFreeNodeDelete(pool, (struct OsMemFreeNodeHead *)nextNode);
+            OsMemMergeNode(nextNode);
+        }
+    }
+    OsMemFreeNodeAdd(pool, freeNode);
+
+    entry->ptr = (VOID *)((UINTPTR)newNode + OS_MEM_NODE_HEAD_SIZE);
+    return TRUE;
+}
+
+UINT32 LOS_MemHandleCompact(VOID *pool, UINT32 maxMoves)
+{
+    struct OsMemPoolHead *poolHead = (struct OsMemPoolHead *)pool;
+    struct OsMemHandleEntry *entry = NULL;
+    UINT32 moves = 0;
+    UINT32 index;
+    UINT32 intSave = 0;
+
+    if ((poolHead == NULL) || (poolHead->info.pool != pool)) {
+        return 0;
+    }
+
+#ifdef LOSCFG_KERNEL_LMS
+    /* The shadow memory is not moved with the blocks. */
+    if (g_lms != NULL) {
+        return 0;
+    }
+#endif
+
+    for (index = 0; (index < LOSCFG_MEM_HANDLE_LIMIT) && (moves < maxMoves); index++) {
+        /* Only one block is moved with the pool locked, so the interrupt latency is bounded by one block. */
+        MEM_LOCK(poolHead, intSave);
+        entry = &g_memHandleTable[index];
+        if ((entry->pool == pool) && (entry->ptr != NULL) && (entry->lockCount == 0)) {
+            if (OsMemHandleMove(poolHead, entry)) {
+                moves++;
+            }
+        }
+        MEM_UNLOCK(poolHead, intSave);
+    }
+
+    return moves;
+}
+#endif
+
 #if (LOSCFG_MEM_FREE_BY_TASKID == 1)
 STATIC VOID MemNodeFreeByTaskIDHandle(struct OsMemNodeHead *curNode, VOID *arg)
 {
@@ -2226,11 +2726,94 @@ UINT32 LOS_MemFreeNodeShow(VOID *pool)
                    countNum[index]);
         }
     }
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+    PRINTK("\n   ************************ fragmentation *****************************\n");
+    OsMemFragInfoPrint(pool);
+#endif
     PRINTK("\n   ********************************************************************\n\n");
 #endif
     return LOS_OK;
 }
 
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+STATIC INLINE UINT32 OsMemFragHistIndexGet(UINT32 size)
+{
+    if (size < OS_MEM_SMALL_BUCKET_MAX_SIZE) {
+        return 0;
+    }
+    return (OsMemLog2(size) - OS_MEM_LARGE_START_BUCKET + 1);
+}
+
+UINT32 LOS_MemFragInfoGet(VOID *pool, LOS_MEM_FRAG_INFO *fragInfo)
+{
+    struct OsMemPoolHead *poolInfo = (struct OsMemPoolHead *)pool;
+    struct OsMemFreeNodeHead *node = NULL;
+    UINT32 index;
+    UINT32 size;
+    UINT32 intSave = 0;
+
+    if (fragInfo == NULL) {
+        PRINT_ERR("can't use NULL addr to save info\n");
+        return LOS_NOK;
+    }
+
+    if ((poolInfo == NULL) || ((UINTPTR)pool != (UINTPTR)poolInfo->info.pool)) {
+        PRINT_ERR("wrong mem pool addr: 0x%x, line: %d\n", (UINTPTR)poolInfo, __LINE__);
+        return LOS_NOK;
+    }
+
+    (VOID)memset(fragInfo, 0, sizeof(LOS_MEM_FRAG_INFO));
+
+    MEM_LOCK(poolInfo, intSave);
+    fragInfo->totalFreeSize = poolInfo->info.freeSize;
+    fragInfo->freeNodeNum = poolInfo->info.freeNodeNum;
+    for (index = 0; index < OS_MEM_FREE_LIST_COUNT; index++) {
+        for (node = poolInfo->freeList[index]; node != NULL; node = node->next) {
+            size = OS_MEM_NODE_GET_SIZE(node->header.sizeAndFlag);
+            fragInfo->freeNodeHist[OsMemFragHistIndexGet(size)]++;
+            if (fragInfo->maxFreeNodeSize < size) {
+                fragInfo->maxFreeNodeSize = size;
+            }
+        }
+    }
+    MEM_UNLOCK(poolInfo, intSave);
+
+    if (fragInfo->totalFreeSize != 0) {
+        fragInfo->fragPercent = 100 - (UINT32)(((UINT64)fragInfo->maxFreeNodeSize * 100) / /* 100: percent */
+                                               fragInfo->totalFreeSize);
+    }
+    return LOS_OK;
+}
+
+STATIC VOID OsMemFragInfoPrint(VOID *pool)
+{
+#if (LOSCFG_KERNEL_PRINTF != 0)
+    LOS_MEM_FRAG_INFO fragInfo;
+    UINT32 index;
+
+    if (LOS_MemFragInfoGet(pool, &fragInfo) != LOS_OK) {
+        return;
+    }
+
+    PRINTK("total free size: 0x%x, max free node size: 0x%x, free node num: %u, fragmentation: %u%%\n",
+           fragInfo.totalFreeSize, fragInfo.maxFreeNodeSize, fragInfo.freeNodeNum, fragInfo.fragPercent);
+    for (index = 0; index < LOS_MEM_FRAG_HIST_NUM; index++) {
+        if (fragInfo.freeNodeHist[index] == 0) {
+            continue;
+        }
+        if (index == 0) {
+            PRINTK("size: [0x0, 0x%x), num: %u\n", OS_MEM_SMALL_BUCKET_MAX_SIZE, fragInfo.freeNodeHist[index]);
+        } else {
+            PRINTK("size: [0x%x, 0x%x), num: %u\n", 1U << (index + OS_MEM_LARGE_START_BUCKET - 1),
+                   1U << (index + OS_MEM_LARGE_START_BUCKET), fragInfo.freeNodeHist[index]);
+        }
+    }
+#else
+    (VOID)pool;
+#endif
+}
+#endif
+
 VOID LOS_MemUnlockEnable(VOID *pool)
 {
     if (pool == NULL) {
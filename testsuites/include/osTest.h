@@ -44,6 +44,7 @@
 #include "los_interrupt.h"
 #include "los_arch_interrupt.h"
 #include "los_task.h"
+#include "los_init.h"
 #include "los_sem.h"
 #include "los_event.h"
 #include "los_memory.h"
@@ -62,6 +62,10 @@ VOID ItSuiteLosHwi()
     ItLosHwi038();
     ItLosHwi039();
     ItLosHwi040();
+    ItLosHwi041();
+    ItLosHwi042();
+    ItLosHwi043();
+    ItLosHwi044();
 #if (LOS_KERNEL_MULTI_HWI_TEST == 1)
     ItLosHwi003();
     ItLosHwi005();
@@ -78,6 +78,10 @@ extern VOID ItLosHwi037(VOID);
 extern VOID ItLosHwi038(VOID);
 extern VOID ItLosHwi039(VOID);
 extern VOID ItLosHwi040(VOID);
+extern VOID ItLosHwi041(VOID);
+extern VOID ItLosHwi042(VOID);
+extern VOID ItLosHwi043(VOID);
+extern VOID ItLosHwi044(VOID);
 
 
 #if (LOS_KERNEL_MULTI_HWI_TEST == 1)
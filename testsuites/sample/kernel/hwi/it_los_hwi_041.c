@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "it_los_hwi.h"
+#include "los_workqueue.h"
+
+#define HWI_BENCH_LOOP 32
+
+static volatile UINT64 g_hwiEntryCycle;
+static volatile UINT32 g_hwiActive;
+
+static VOID HwiF01(VOID)
+{
+    g_hwiEntryCycle = LOS_SysCycleGet();
+    g_hwiActive += OS_INT_ACTIVE;
+    g_testCount++;
+}
+
+LOS_HWI_DIRECT_HANDLER(HwiDirectF01)
+{
+    g_hwiEntryCycle = LOS_SysCycleGet();
+    g_hwiActive += OS_INT_ACTIVE;
+    g_testCount++;
+}
+
+static UINT64 HwiBench(HWI_MODE_T mode, HWI_PROC_FUNC handler)
+{
+    UINT32 ret;
+    UINT32 loop;
+    UINT64 total = 0;
+    HwiIrqParam irqParam;
+    (void)memset_s(&irqParam, sizeof(HwiIrqParam), 0, sizeof(HwiIrqParam));
+
+    g_testCount = 0;
+    g_hwiActive = 0;
+    ret = LOS_HwiCreate(HWI_NUM_TEST, 1, mode, handler, &irqParam);
+    if (ret != LOS_OK) {
+        return 0;
+    }
+
+    for (loop = 0; loop < HWI_BENCH_LOOP; loop++) {
+        UINT64 start = LOS_SysCycleGet();
+        TestHwiTrigger(HWI_NUM_TEST);
+        total += g_hwiEntryCycle - start;
+    }
+
+    TestHwiDelete(HWI_NUM_TEST);
+    return total / HWI_BENCH_LOOP;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT64 common;
+    UINT64 direct;
+
+    common = HwiBench(0, (HWI_PROC_FUNC)HwiF01);
+    ICUNIT_ASSERT_EQUAL(g_testCount, HWI_BENCH_LOOP, g_testCount);
+    ICUNIT_ASSERT_EQUAL(g_hwiActive, HWI_BENCH_LOOP, g_hwiActive);
+
+    direct = HwiBench(LOS_HWI_MODE_DIRECT, (HWI_PROC_FUNC)HwiDirectF01);
+    ICUNIT_ASSERT_EQUAL(g_testCount, HWI_BENCH_LOOP, g_testCount);
+    ICUNIT_ASSERT_EQUAL(g_hwiActive, HWI_BENCH_LOOP, g_hwiActive);
+
+    printf("hwi entry to handler: common %u cycles, direct %u cycles\n", (UINT32)common, (UINT32)direct);
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+    UINT32 ret = LOS_HwiCreate(HWI_NUM_TEST, 1, LOS_HWI_MODE_DIRECT | LOS_HWI_MODE_THREADED,
+                               (HWI_PROC_FUNC)HwiDirectF01, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_HWI_MODE_INVALID, ret);
+#endif
+    return LOS_OK;
+}
+
+VOID ItLosHwi041(VOID) // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosHwi041", Testcase, TEST_LOS, TEST_HWI, TEST_LEVEL1, TEST_PERFORMANCE);
+}
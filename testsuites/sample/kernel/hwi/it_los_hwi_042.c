@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "it_los_hwi.h"
+
+#if (LOSCFG_KERNEL_IRQSTAT == 1)
+#include "los_irqstat.h"
+
+#define HWI_STAT_LOOP 4
+
+static UINT32 g_hwiIndex;
+
+static VOID HwiF01(VOID)
+{
+    g_hwiIndex = LOS_HwiCurIrqNum();
+    g_testCount++;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 loop;
+    UINT32 bucket;
+    UINT32 histSum = 0;
+    UINT32 intSave;
+    LOS_IRQSTAT_S stat;
+    HwiIrqParam irqParam;
+    (void)memset_s(&irqParam, sizeof(HwiIrqParam), 0, sizeof(HwiIrqParam));
+
+    ret = LOS_IrqStatGet(LOSCFG_KERNEL_IRQSTAT_VECTOR_LIMIT, &stat);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_IRQSTAT_INDEX_INVALID, ret);
+    ret = LOS_IrqStatMaskGet(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_IRQSTAT_PTR_NULL, ret);
+
+    g_testCount = 0;
+    ret = LOS_HwiCreate(HWI_NUM_TEST, 1, 0, (HWI_PROC_FUNC)HwiF01, &irqParam);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    LOS_IrqStatReset();
+    for (loop = 0; loop < HWI_STAT_LOOP; loop++) {
+        TestHwiTrigger(HWI_NUM_TEST);
+    }
+    ICUNIT_GOTO_EQUAL(g_testCount, HWI_STAT_LOOP, g_testCount, EXIT);
+
+    ret = LOS_IrqStatGet(g_hwiIndex, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.count, HWI_STAT_LOOP, stat.count, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.totalCycles >= stat.maxCycles, TRUE, stat.maxCycles, EXIT);
+    for (bucket = 0; bucket < LOS_IRQSTAT_HIST_NUM; bucket++) {
+        histSum += stat.hist[bucket];
+    }
+    ICUNIT_GOTO_EQUAL(histSum, HWI_STAT_LOOP, histSum, EXIT);
+
+    intSave = LOS_IntLock();
+    LOS_IntRestore(intSave);
+    ret = LOS_IrqStatMaskGet(&stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.count > 0, TRUE, stat.count, EXIT);
+
+    LOS_IrqStatShow();
+
+EXIT:
+    TestHwiDelete(HWI_NUM_TEST);
+    return LOS_OK;
+}
+#else
+static UINT32 Testcase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosHwi042(VOID) // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosHwi042", Testcase, TEST_LOS, TEST_HWI, TEST_LEVEL1, TEST_FUNCTION);
+}
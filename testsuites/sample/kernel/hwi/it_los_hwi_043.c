@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "osTest.h"
+#include "it_los_hwi.h"
+
+#if (LOSCFG_KERNEL_IRQSTAT_CRITICAL == 1)
+#include "los_irqstat.h"
+#include "los_hook.h"
+
+#define CRITICAL_BUSY_CYCLES 2000
+
+static UINT32 g_hookCount;
+
+static VOID CriticalHook(UINT32 type, UINT32 cycles, UINTPTR callSite)
+{
+    (VOID)type;
+    (VOID)cycles;
+    (VOID)callSite;
+    g_hookCount++;
+}
+
+static VOID CriticalBusy(VOID)
+{
+    UINT64 start = LOS_SysCycleGet();
+
+    while ((LOS_SysCycleGet() - start) < CRITICAL_BUSY_CYCLES) {
+    }
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 num;
+    UINT32 intSave;
+    LOS_IRQSTAT_CRITICAL_S table[LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM];
+
+    num = LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM;
+    ret = LOS_IrqStatCriticalGet(LOS_IRQSTAT_CRITICAL_TYPE_NUM, table, &num);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_IRQSTAT_TYPE_INVALID, ret);
+    ret = LOS_IrqStatCriticalGet(LOS_IRQSTAT_CRITICAL_IRQ, NULL, &num);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_IRQSTAT_PTR_NULL, ret);
+
+    g_hookCount = 0;
+    ret = LOS_HookReg(LOS_HOOK_TYPE_CRITICAL_SECTION, CriticalHook);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    LOS_IrqStatReset();
+    LOS_IrqStatCriticalThresholdSet(OS_NULL_INT);
+
+    intSave = LOS_IntLock();
+    CriticalBusy();
+    LOS_IntRestore(intSave);
+
+    num = LOSCFG_KERNEL_IRQSTAT_CRITICAL_TOP_NUM;
+    ret = LOS_IrqStatCriticalGet(LOS_IRQSTAT_CRITICAL_IRQ, table, &num);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(num > 0, TRUE, num, EXIT);
+    ICUNIT_GOTO_EQUAL(table[0].cycles >= CRITICAL_BUSY_CYCLES, TRUE, table[0].cycles, EXIT);
+    ICUNIT_GOTO_EQUAL(table[0].taskID, LOS_CurTaskIDGet(), table[0].taskID, EXIT);
+    ICUNIT_GOTO_EQUAL(g_hookCount, 0, g_hookCount, EXIT);
+
+    LOS_IrqStatCriticalThresholdSet(0);
+    LOS_TaskLock();
+    CriticalBusy();
+    LOS_TaskUnlock();
+
+    num = 1;
+    ret = LOS_IrqStatCriticalGet(LOS_IRQSTAT_CRITICAL_SCHED, table, &num);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(num, 1, num, EXIT);
+    ICUNIT_GOTO_EQUAL(table[0].cycles >= CRITICAL_BUSY_CYCLES, TRUE, table[0].cycles, EXIT);
+    ICUNIT_GOTO_EQUAL(table[0].taskID, LOS_CurTaskIDGet(), table[0].taskID, EXIT);
+    ICUNIT_GOTO_EQUAL(g_hookCount > 0, TRUE, g_hookCount, EXIT);
+
+    LOS_IrqStatShow();
+
+EXIT:
+    LOS_IrqStatCriticalThresholdSet(LOSCFG_KERNEL_IRQSTAT_CRITICAL_THRESHOLD_US);
+    (VOID)LOS_HookUnReg(LOS_HOOK_TYPE_CRITICAL_SECTION, CriticalHook);
+    return LOS_OK;
+}
+#else
+static UINT32 Testcase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosHwi043(VOID) // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosHwi043", Testcase, TEST_LOS, TEST_HWI, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022-2022 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include "osTest.h"
+#include "it_los_hwi.h"
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1) && (LOSCFG_PLATFORM_HWI_WITH_ARG == 1)
+#include "los_workqueue.h"
+
+#define HANDLER_DELAY_TICKS 5
+#define ENTRY_WAIT_TICKS    10
+
+static volatile UINT32 g_handlerEntered;
+static volatile UINT32 g_handlerDone;
+
+static VOID HwiThreadF01(VOID *arg)
+{
+    (VOID)arg;
+    g_handlerEntered++;
+    (VOID)LOS_TaskDelay(HANDLER_DELAY_TICKS);
+    g_handlerDone++;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 loop;
+    HwiIrqParam irqParam;
+    (void)memset_s(&irqParam, sizeof(HwiIrqParam), 0, sizeof(HwiIrqParam));
+
+    g_handlerEntered = 0;
+    g_handlerDone = 0;
+    ret = LOS_HwiCreate(HWI_NUM_TEST, 1, LOS_HWI_MODE_THREADED, (HWI_PROC_FUNC)HwiThreadF01, &irqParam);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    TestHwiTrigger(HWI_NUM_TEST);
+    for (loop = 0; (g_handlerEntered == 0) && (loop < ENTRY_WAIT_TICKS); loop++) {
+        (VOID)LOS_TaskDelay(1);
+    }
+    ICUNIT_GOTO_EQUAL(g_handlerEntered, 1, g_handlerEntered, EXIT);
+    ICUNIT_GOTO_EQUAL(g_handlerDone, 0, g_handlerDone, EXIT);
+
+    /* The deletion would have to wait for the running handler */
+    LOS_TaskLock();
+    ret = LOS_HwiDelete(HWI_NUM_TEST, NULL);
+    LOS_TaskUnlock();
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_WORKQUEUE_PEND_IN_LOCK, ret, EXIT);
+
+    ret = LOS_HwiDelete(HWI_NUM_TEST, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(g_handlerDone, 1, g_handlerDone);
+
+    /* The slot is released, the interrupt can be threaded again */
+    ret = LOS_HwiCreate(HWI_NUM_TEST, 1, LOS_HWI_MODE_THREADED, (HWI_PROC_FUNC)HwiThreadF01, &irqParam);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_HwiDelete(HWI_NUM_TEST, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(g_handlerEntered, 1, g_handlerEntered);
+    return LOS_OK;
+
+EXIT:
+    (VOID)LOS_HwiDelete(HWI_NUM_TEST, NULL);
+    return LOS_OK;
+}
+#else
+static UINT32 Testcase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosHwi044(VOID) // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosHwi044", Testcase, TEST_LOS, TEST_HWI, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -119,6 +119,13 @@ struct TestMemPoolInfo {
     UINT32 waterLine;   /* Maximum usage size in a memory pool */
     UINT32 curUsedSize; /* Current usage size in a memory pool */
 #endif
+#if (LOSCFG_MEM_FRAG_STAT == 1)
+    UINT32 freeSize;
+    UINT32 freeNodeNum;
+#endif
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    LOS_MEM_REALLOC_STAT reallocStat;
+#endif
 };
 
 struct TestMemPoolHead {
@@ -190,6 +197,9 @@ VOID ItLosMem044(void);
 VOID ItLosMem045(void);
 VOID ItLosMem046(void);
 VOID ItLosMem047(void);
+VOID ItLosMem048(void);
+VOID ItLosMem049(void);
+VOID ItLosMem050(void);
 VOID ItLosMem058(void);
 VOID ItLosMem063(void);
 VOID ItLosMem064(void);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#if (LOSCFG_MEM_FRAG_STAT == 1) && (LOSCFG_MEM_HANDLE == 1)
+#define HANDLE_NUM 3
+#define HANDLE_SIZE 0x100
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 handle[HANDLE_NUM];
+    LOS_MEM_FRAG_INFO fragInfo;
+    UINT8 *p = NULL;
+    int i;
+
+    MemInit();
+
+    ret = LOS_MemFragInfoGet(g_memPool, &fragInfo);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.freeNodeNum, 1, fragInfo.freeNodeNum, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.fragPercent, 0, fragInfo.fragPercent, EXIT);
+
+    for (i = 0; i < HANDLE_NUM; i++) {
+        ret = LOS_MemHandleAlloc(g_memPool, HANDLE_SIZE, &handle[i]);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+
+    p = LOS_MemHandleLock(handle[1]);
+    ICUNIT_GOTO_NOT_EQUAL(p, NULL, p, EXIT);
+    (void)memset_s(p, HANDLE_SIZE, 0x5A, HANDLE_SIZE);
+    // a movable block can only be freed through its handle
+    ret = LOS_MemFree(g_memPool, p);
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+    ret = LOS_MemHandleUnlock(handle[1]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    // free the first block to leave a hole in front of the second one
+    ret = LOS_MemHandleFree(handle[0]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemHandleFree(handle[0]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_NOK, ret, EXIT);
+
+    ret = LOS_MemFragInfoGet(g_memPool, &fragInfo);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.freeNodeNum, 2, fragInfo.freeNodeNum, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL(fragInfo.fragPercent, 0, fragInfo.fragPercent, EXIT);
+
+    // a locked block must not be moved
+    p = LOS_MemHandleLock(handle[1]);
+    ICUNIT_GOTO_NOT_EQUAL(p, NULL, p, EXIT);
+    ret = LOS_MemHandleCompact(g_memPool, HANDLE_NUM);
+    ICUNIT_GOTO_EQUAL(ret, 0, ret, EXIT);
+    ret = LOS_MemHandleUnlock(handle[1]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    while (LOS_MemHandleCompact(g_memPool, HANDLE_NUM) != 0) {
+    }
+
+    ret = LOS_MemIntegrityCheck(g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_MemFragInfoGet(g_memPool, &fragInfo);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.freeNodeNum, 1, fragInfo.freeNodeNum, EXIT);
+    ICUNIT_GOTO_EQUAL(fragInfo.fragPercent, 0, fragInfo.fragPercent, EXIT);
+
+    p = LOS_MemHandleLock(handle[1]);
+    ICUNIT_GOTO_NOT_EQUAL(p, NULL, p, EXIT);
+    for (i = 0; i < HANDLE_SIZE; i++) {
+        ICUNIT_GOTO_EQUAL(p[i], 0x5A, p[i], EXIT);
+    }
+    ret = LOS_MemHandleUnlock(handle[1]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_MemHandleFree(handle[1]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_MemHandleFree(handle[2]);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    MemFree();
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosMem048(void)
+{
+    TEST_ADD_CASE("ItLosMem048", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#define FRONT_SIZE 0x100
+#define BUF_SIZE 0x80
+#define GROW_SIZE 0x180
+#define RESERVE_SIZE 0x400
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT8 *front = NULL;
+    UINT8 *p = NULL;
+    UINT8 *newP = NULL;
+    UINT8 *tail = NULL;
+    int i;
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    LOS_MEM_REALLOC_STAT stat;
+#endif
+
+    MemInit();
+
+    front = LOS_MemAlloc(g_memPool, FRONT_SIZE);
+    ICUNIT_GOTO_NOT_EQUAL(front, NULL, front, EXIT);
+    p = LOS_MemAlloc(g_memPool, BUF_SIZE);
+    ICUNIT_GOTO_NOT_EQUAL(p, NULL, p, EXIT);
+    tail = LOS_MemAlloc(g_memPool, BUF_SIZE);
+    ICUNIT_GOTO_NOT_EQUAL(tail, NULL, tail, EXIT);
+    (void)memset_s(p, BUF_SIZE, 0x5A, BUF_SIZE);
+
+    // the block can not grow forward, but the hole in front of it is large enough
+    ret = LOS_MemFree(g_memPool, front);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    newP = LOS_MemRealloc(g_memPool, p, GROW_SIZE);
+    ICUNIT_GOTO_EQUAL(newP, front, newP, EXIT);
+    p = newP;
+    for (i = 0; i < BUF_SIZE; i++) {
+        ICUNIT_GOTO_EQUAL(p[i], 0x5A, p[i], EXIT);
+    }
+
+    ret = LOS_MemIntegrityCheck(g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    // the reserved size is kept, so growing up to it later is done in place
+    newP = LOS_MemReallocHint(g_memPool, p, GROW_SIZE + BUF_SIZE, RESERVE_SIZE);
+    ICUNIT_GOTO_NOT_EQUAL(newP, NULL, newP, EXIT);
+    p = newP;
+    for (i = 0; i < BUF_SIZE; i++) {
+        ICUNIT_GOTO_EQUAL(p[i], 0x5A, p[i], EXIT);
+    }
+    newP = LOS_MemRealloc(g_memPool, p, RESERVE_SIZE);
+    ICUNIT_GOTO_EQUAL(newP, p, newP, EXIT);
+
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    ret = LOS_MemReallocStatGet(g_memPool, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.backwardCount, 1, stat.backwardCount, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.copyCount, 1, stat.copyCount, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.inPlaceCount, 1, stat.inPlaceCount, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.failCount, 0, stat.failCount, EXIT);
+#endif
+
+    ret = LOS_MemIntegrityCheck(g_memPool);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    MemFree();
+    return LOS_OK;
+}
+
+VOID ItLosMem049(void)
+{
+    TEST_ADD_CASE("ItLosMem049", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_mem.h"
+
+#define GROW_START_SIZE 0x20
+#define GROW_END_SIZE 0x4000
+#define GROW_LOOP 10
+#define BLOCKER_SIZE 0x10
+/* The copy path needs the old and the new buffer at the same time, which does not fit in TEST_MEM_SIZE. */
+#define GROW_POOL_SIZE 0x8000
+
+static VOID *g_growPool = NULL;
+
+/*
+ * Grow a buffer by doubling while a small block is allocated behind it after every step, fails unless the buffer
+ * reaches GROW_END_SIZE.
+ */
+static UINT32 GrowCycles(UINT32 reserve, UINT64 *cycles)
+{
+    UINT8 *p = NULL;
+    UINT8 *newP = NULL;
+    UINT8 *blocker[GROW_LOOP] = {NULL};
+    UINT64 start;
+    UINT32 size;
+    UINT32 loop = 0;
+    UINT32 ret = LOS_OK;
+
+    *cycles = 0;
+    p = LOS_MemAlloc(g_growPool, GROW_START_SIZE);
+    if (p == NULL) {
+        return LOS_NOK;
+    }
+
+    for (size = GROW_START_SIZE << 1; size <= GROW_END_SIZE; size <<= 1) {
+        if (loop < GROW_LOOP) {
+            blocker[loop++] = LOS_MemAlloc(g_growPool, BLOCKER_SIZE);
+        }
+        start = LOS_SysCycleGet();
+        newP = LOS_MemReallocHint(g_growPool, p, size, reserve);
+        *cycles += LOS_SysCycleGet() - start;
+        if (newP == NULL) {
+            ret = LOS_NOK;
+            break;
+        }
+        p = newP;
+    }
+
+    (VOID)LOS_MemFree(g_growPool, p);
+    while (loop > 0) {
+        (VOID)LOS_MemFree(g_growPool, blocker[--loop]);
+    }
+    return ret;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT64 cycles;
+    UINT64 hintCycles;
+    UINT32 ret;
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    LOS_MEM_REALLOC_STAT stat;
+    UINT32 copyCount;
+#endif
+
+    g_growPool = LOS_MemAlloc(LOSCFG_SYS_HEAP_ADDR, GROW_POOL_SIZE);
+    ICUNIT_ASSERT_NOT_EQUAL(g_growPool, NULL, g_growPool);
+    (VOID)LOS_MemInit(g_growPool, GROW_POOL_SIZE);
+
+    ret = GrowCycles(0, &cycles);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL(cycles, 0, cycles, EXIT);
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    ret = LOS_MemReallocStatGet(g_growPool, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    PRINTK("realloc: inPlace %u backward %u copy %u fail %u\n",
+           stat.inPlaceCount, stat.backwardCount, stat.copyCount, stat.failCount);
+    ICUNIT_GOTO_EQUAL(stat.failCount, 0, stat.failCount, EXIT);
+    copyCount = stat.copyCount;
+#endif
+
+    ret = GrowCycles(GROW_END_SIZE, &hintCycles);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL(hintCycles, 0, hintCycles, EXIT);
+#if (LOSCFG_MEM_REALLOC_STAT == 1)
+    ret = LOS_MemReallocStatGet(g_growPool, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    PRINTK("realloc with hint (total): inPlace %u backward %u copy %u fail %u\n",
+           stat.inPlaceCount, stat.backwardCount, stat.copyCount, stat.failCount);
+    ICUNIT_GOTO_EQUAL(stat.failCount, 0, stat.failCount, EXIT);
+    /* The statistics are cumulative, the hinted run copies less often than the plain one */
+    ICUNIT_GOTO_EQUAL((stat.copyCount - copyCount) < copyCount, TRUE, stat.copyCount, EXIT);
+#endif
+
+    PRINTK("grow 0x%x to 0x%x: realloc %u cycles, realloc with hint %u cycles\n",
+           GROW_START_SIZE, GROW_END_SIZE, (UINT32)cycles, (UINT32)hintCycles);
+
+EXIT:
+    (VOID)LOS_MemDeInit(g_growPool);
+    (VOID)LOS_MemFree(LOSCFG_SYS_HEAP_ADDR, g_growPool);
+    g_growPool = NULL;
+    return LOS_OK;
+}
+
+VOID ItLosMem050(void)
+{
+    TEST_ADD_CASE("ItLosMem050", TestCase, TEST_LOS, TEST_MEM, TEST_LEVEL1, TEST_PERFORMANCE);
+}
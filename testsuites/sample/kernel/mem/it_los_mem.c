@@ -107,6 +107,9 @@ VOID ItSuiteLosMem(void)
     ItLosMem046();
     ItLosMem047();
 #endif
+    ItLosMem048();
+    ItLosMem049();
+    ItLosMem050();
 
 #if (LOS_KERNEL_TEST_FULL == 1)
     ItLosTick001();
@@ -36,5 +36,7 @@ VOID ItSuiteLosPm(VOID)
     ItLosPm001();
     ItLosPm002();
     ItLosPm003();
+    ItLosPm004();
+    ItLosPm005();
 }
 
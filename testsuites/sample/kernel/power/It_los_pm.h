@@ -49,6 +49,8 @@ extern "C" {
 extern VOID ItLosPm001(VOID);
 extern VOID ItLosPm002(VOID);
 extern VOID ItLosPm003(VOID);
+extern VOID ItLosPm004(VOID);
+extern VOID ItLosPm005(VOID);
 
 #ifdef __cplusplus
 #if __cplusplus
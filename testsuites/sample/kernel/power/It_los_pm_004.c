@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_pm.h"
+
+#if (LOSCFG_KERNEL_PM_GOVERNOR == 1)
+#define TEST_SLEEP_LOOP  5
+#define TEST_SLEEP_TICKS 100
+
+static volatile UINT32 g_lightCount = 0;
+
+static UINT32 DeviceSuspend(UINT32 mode)
+{
+    return LOS_OK;
+}
+
+static VOID DeviceResume(UINT32 mode)
+{
+    return;
+}
+
+static LosPmDevice g_device = {
+    .suspend = DeviceSuspend,
+    .resume = DeviceResume,
+};
+
+static UINT32 SysLightSuspend(VOID)
+{
+    g_lightCount++;
+    return ArchEnterSleep();
+}
+
+static LosPmSysctrl g_sysctrl = {
+    .normalSuspend = ArchEnterSleep,
+    .lightSuspend = SysLightSuspend,
+};
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 loop;
+    LosPmGovernorStat stat = { 0 };
+
+    ret = LOS_PmGovernorStatGet(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret);
+
+    ret = LOS_PmRegister(LOS_PM_TYPE_DEVICE, &g_device);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_PmRegister(LOS_PM_TYPE_SYSCTRL, &g_sysctrl);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_PmModeSet(LOS_SYS_LIGHT_SLEEP);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* Long idle periods: the idle task suspends into light sleep on its own */
+    g_lightCount = 0;
+    for (loop = 0; loop < TEST_SLEEP_LOOP; loop++) {
+        (VOID)LOS_TaskDelay(TEST_SLEEP_TICKS);
+    }
+    ICUNIT_GOTO_NOT_EQUAL(g_lightCount, 0, g_lightCount, EXIT);
+
+    ret = LOS_PmGovernorStatGet(&stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL(stat.mode[LOS_SYS_LIGHT_SLEEP].count, 0, stat.mode[LOS_SYS_LIGHT_SLEEP].count, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.mode[LOS_SYS_DEEP_SLEEP].count, 0, stat.mode[LOS_SYS_DEEP_SLEEP].count, EXIT);
+
+#if (LOSCFG_KERNEL_PM_DEBUG == 1)
+    LOS_PmGovernorInfoShow();
+#endif
+
+EXIT:
+    (VOID)LOS_PmModeSet(LOS_SYS_NORMAL_SLEEP);
+    (VOID)LOS_PmUnregister(LOS_PM_TYPE_SYSCTRL, &g_sysctrl);
+    (VOID)LOS_PmUnregister(LOS_PM_TYPE_DEVICE, &g_device);
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosPm004(VOID)
+{
+    TEST_ADD_CASE("ItLosPm004", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
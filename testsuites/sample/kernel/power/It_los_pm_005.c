@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_pm.h"
+
+#define TEST_HOLD_TICKS 10
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINTPTR handle = 0;
+    UINTPTR newHandle = 0;
+    UINT64 holdTime = 0;
+
+    ret = LOS_PmLockCreate(NULL, &handle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret);
+
+    ret = LOS_PmLockCreate("ItLosPm005", NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret);
+
+    ret = LOS_PmLockAcquire(0);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret);
+
+    ret = LOS_PmLockCreate("ItLosPm005", &handle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_PmLockRelinquish(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_PM_NOT_LOCK, ret, EXIT);
+
+    ret = LOS_PmLockAcquire(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_PmLockAcquire(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_PmLockDelete(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_PM_LOCK_BUSY, ret, EXIT);
+
+    /* The name based API reaches the same lock and does not free it */
+    ret = LOS_PmLockRequest("ItLosPm005");
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_PmLockRelease("ItLosPm005");
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    (VOID)LOS_TaskDelay(TEST_HOLD_TICKS);
+
+    ret = LOS_PmLockRelinquish(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_PmLockRelinquish(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_PmLockHoldTimeGet(handle, NULL);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret, EXIT);
+
+    ret = LOS_PmLockHoldTimeGet(handle, &holdTime);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL((holdTime < (TEST_HOLD_TICKS * OS_US_PER_TICK)), TRUE, holdTime, EXIT);
+
+#if (LOSCFG_KERNEL_PM_DEBUG == 1)
+    LOS_PmLockInfoShow();
+#endif
+
+    ret = LOS_PmLockRelinquish(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_PM_NOT_LOCK, ret, EXIT);
+
+EXIT:
+    (VOID)LOS_PmLockRelinquish(handle);
+    (VOID)LOS_PmLockRelinquish(handle);
+    ret = LOS_PmLockDelete(handle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* A deleted handle stays invalid even when its slot is reused */
+    ret = LOS_PmLockAcquire(handle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret);
+
+    ret = LOS_PmLockCreate("ItLosPm005", &newHandle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_PmLockAcquire(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret, EXIT1);
+
+    ret = LOS_PmLockDelete(handle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_PM_INVALID_PARAM, ret, EXIT1);
+
+EXIT1:
+    ret = LOS_PmLockDelete(newHandle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    return LOS_OK;
+}
+
+VOID ItLosPm005(VOID)
+{
+    TEST_ADD_CASE("ItLosPm005", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
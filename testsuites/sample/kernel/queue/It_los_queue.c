@@ -116,6 +116,7 @@ VOID ItSuiteLosQueue(VOID)
     ItLosQueue106();
     ItLosQueue107();
     ItLosQueue114();
+    ItLosQueue115();
     ItLosQueueHead001();
     ItLosQueueHead002();
     ItLosQueueHead003();
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "It_los_queue.h"
+
+#if (LOSCFG_BASE_IPC_QUEUE_STATIC == 1)
+static UINT8 g_queueMem[LOS_QUEUE_STATIC_MEM_SIZE(QUEUE_BASE_NUM, QUEUE_BASE_MSGSIZE)];
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 readSize = QUEUE_BASE_MSGSIZE;
+    CHAR buff1[QUEUE_SHORT_BUFFER_LENGTH] = "UniDSP";
+    CHAR buff2[QUEUE_SHORT_BUFFER_LENGTH] = "";
+
+    ret = LOS_QueueCreateStatic("Q1", QUEUE_BASE_NUM, &g_testQueueID01, 0, QUEUE_BASE_MSGSIZE, NULL,
+                                sizeof(g_queueMem));
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_QUEUE_CREAT_PTR_NULL, ret);
+
+    ret = LOS_QueueCreateStatic("Q1", QUEUE_BASE_NUM, &g_testQueueID01, 0, QUEUE_BASE_MSGSIZE, g_queueMem,
+                                sizeof(g_queueMem) - 1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_QUEUE_CREATE_NO_MEMORY, ret);
+
+    ret = LOS_QueueCreateStatic("Q1", QUEUE_BASE_NUM, &g_testQueueID01, 0, QUEUE_BASE_MSGSIZE, g_queueMem,
+                                sizeof(g_queueMem));
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_QueueWriteCopy(g_testQueueID01, buff1, QUEUE_BASE_MSGSIZE, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_QueueReadCopy(g_testQueueID01, buff2, &readSize, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = strcmp(buff1, buff2);
+    ICUNIT_GOTO_EQUAL(ret, 0, ret, EXIT);
+
+EXIT:
+    // the message memory is owned by the caller, it must not be freed to the heap
+    ret = LOS_QueueDelete(g_testQueueID01);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    return LOS_OK;
+}
+#else
+static UINT32 Testcase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosQueue115(VOID)
+{
+    TEST_ADD_CASE("ItLosQueue115", Testcase, TEST_LOS, TEST_QUE, TEST_LEVEL1, TEST_FUNCTION);
+}
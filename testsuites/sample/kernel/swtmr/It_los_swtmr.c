@@ -62,11 +62,13 @@ VOID ItSuiteLosSwtmr(void)
     ItLosSwtmr021();
     ItLosSwtmr024();
     ItLosSwtmr027();
+    ItLosSwtmr082();
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
     ItLosSwtmrAlign001();
     ItLosSwtmrAlign002();
     ItLosSwtmrAlign003();
     ItLosSwtmrAlign004();
+    ItLosSwtmrAlign032();
 #endif
 
 #if (LOS_KERNEL_TEST_FULL == 1)
@@ -150,6 +150,7 @@ extern VOID ItLosSwtmr078(VOID);
 extern VOID ItLosSwtmr079(VOID);
 extern VOID ItLosSwtmr080(VOID);
 extern VOID ItLosSwtmr081(VOID);
+extern VOID ItLosSwtmr082(VOID);
 
 extern VOID ItLosSwtmrAlign001(VOID);
 extern VOID ItLosSwtmrAlign002(VOID);
@@ -182,6 +183,7 @@ extern VOID ItLosSwtmrAlign028(VOID);
 extern VOID ItLosSwtmrAlign029(VOID);
 extern VOID ItLosSwtmrAlign030(VOID);
 extern VOID ItLosSwtmrAlign031(VOID);
+extern VOID ItLosSwtmrAlign032(VOID);
 extern VOID ItLosSwtmrDelay001(VOID);
 extern VOID ItLosSwtmrDelay002(VOID);
 extern VOID ItLosSwtmrDelay003(VOID);
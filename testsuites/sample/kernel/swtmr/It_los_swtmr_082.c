@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_swtmr.h"
+
+static UINT32 g_testCount1 = 0;
+static UINT32 g_testCount2 = 0;
+
+static VOID Case1(UINT32 arg)
+{
+    g_testCount1++;
+    return;
+}
+
+static VOID Case2(UINT32 arg)
+{
+    g_testCount2++;
+    return;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    SWTMR_TIER_STAT_S statBefore = { 0 };
+    SWTMR_TIER_STAT_S stat = { 0 };
+    g_testCount1 = 0;
+    g_testCount2 = 0;
+
+    ret = LOS_SwtmrTierStatGet(LOS_SWTMR_TIER_NUM, &stat);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_SWTMR_TIER_INVALID, ret);
+
+    ret = LOS_SwtmrTierStatGet(LOS_SWTMR_TIER_HIGH, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_SWTMR_RET_PTR_NULL, ret);
+
+    ret = LOS_SwtmrTierStatGet(LOS_SWTMR_TIER_BACKGROUND, &statBefore);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    // 2, Timeout interval of a periodic software timer.
+    ret = LOS_SwtmrCreate(2, LOS_SWTMR_MODE_ONCE, Case1, &g_swtmrId1, 0xffff
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
+    , OS_SWTMR_ROUSES_ALLOW, OS_SWTMR_ALIGN_INSENSITIVE
+#endif
+    );
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    // 2, Timeout interval of a periodic software timer.
+    ret = LOS_SwtmrCreate(2, LOS_SWTMR_MODE_ONCE, Case2, &g_swtmrId2, 0xffff
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
+    , OS_SWTMR_ROUSES_ALLOW, OS_SWTMR_ALIGN_INSENSITIVE
+#endif
+    );
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrTierSet(g_swtmrId1, LOS_SWTMR_TIER_NUM);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SWTMR_TIER_INVALID, ret, EXIT);
+
+    ret = LOS_SwtmrTierSet(0xffffffff, LOS_SWTMR_TIER_BACKGROUND);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SWTMR_ID_INVALID, ret, EXIT);
+
+    ret = LOS_SwtmrTierSet(g_swtmrId1, LOS_SWTMR_TIER_BACKGROUND);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrStart(g_swtmrId1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrStart(g_swtmrId2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    // 10, Set task delay time.
+    LOS_TaskDelay(10);
+    ICUNIT_GOTO_EQUAL(g_testCount1, 1, g_testCount1, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount2, 1, g_testCount2, EXIT);
+
+    ret = LOS_SwtmrTierStatGet(LOS_SWTMR_TIER_BACKGROUND, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL(stat.dispatched, statBefore.dispatched, stat.dispatched, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.dropped, statBefore.dropped, stat.dropped, EXIT);
+    ICUNIT_GOTO_NOT_EQUAL(stat.maxBatch, 0, stat.maxBatch, EXIT);
+
+    /* The once timers deleted themselves after the timeout */
+    ret = LOS_SwtmrTierSet(g_swtmrId1, LOS_SWTMR_TIER_HIGH);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SWTMR_NOT_CREATED, ret, EXIT);
+
+    return LOS_OK;
+
+EXIT:
+    LOS_SwtmrDelete(g_swtmrId1);
+    LOS_SwtmrDelete(g_swtmrId2);
+    return LOS_OK;
+}
+
+VOID ItLosSwtmr082() // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosSwtmr082", Testcase, TEST_LOS, TEST_SWTMR, TEST_LEVEL1, TEST_FUNCTION);
+}
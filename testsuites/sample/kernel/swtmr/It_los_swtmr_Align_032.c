@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_swtmr.h"
+
+
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
+static  UINT32 g_swtmrCount1;
+static  UINT32 g_swtmrCount2;
+static  UINT32 g_swtmrCount3;
+static VOID Case1(UINT32 arg)
+{
+    ICUNIT_ASSERT_EQUAL_VOID(arg, 0xffff, arg);
+    g_swtmrCount1++;
+    return;
+}
+
+static VOID Case2(UINT32 arg)
+{
+    ICUNIT_ASSERT_EQUAL_VOID(arg, 0xffff, arg);
+    g_swtmrCount2++;
+    return;
+}
+
+static VOID Case3(UINT32 arg)
+{
+    ICUNIT_ASSERT_EQUAL_VOID(arg, 0xffff, arg);
+    g_swtmrCount3++;
+    return;
+}
+
+static UINT32 Testcase(VOID)
+{
+    UINT32 ret;
+    UINT32 swtmrId1;
+    UINT32 swtmrId2;
+    UINT32 swtmrId3;
+
+    g_swtmrCount1 = 0;
+    g_swtmrCount2 = 0;
+    g_swtmrCount3 = 0;
+
+    // 20, Timeout interval of a periodic software timer.
+    ret = LOS_SwtmrCreate(20, LOS_SWTMR_MODE_PERIOD, Case1, &swtmrId1, 0xffff, OS_SWTMR_ROUSES_ALLOW,
+        OS_SWTMR_ALIGN_INSENSITIVE);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    // 160, Timeout interval of a periodic software timer, 8 times the first one.
+    ret = LOS_SwtmrCreate(160, LOS_SWTMR_MODE_PERIOD, Case2, &swtmrId2, 0xffff, OS_SWTMR_ROUSES_ALLOW,
+        OS_SWTMR_ALIGN_INSENSITIVE);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    // 13, Timeout interval of a periodic software timer, not a multiple of the others.
+    ret = LOS_SwtmrCreate(13, LOS_SWTMR_MODE_PERIOD, Case3, &swtmrId3, 0xffff, OS_SWTMR_ROUSES_ALLOW,
+        OS_SWTMR_ALIGN_INSENSITIVE);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrStart(swtmrId1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_TaskDelay(5); // 5, set delay time.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrStart(swtmrId2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrStart(swtmrId3);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_TaskDelay(15); // 15, set delay time.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ICUNIT_GOTO_EQUAL(g_swtmrCount1, 1, g_swtmrCount1, EXIT); // 1, Here, assert that g_swtmrCount1 is equal to this .
+    ICUNIT_GOTO_EQUAL(g_swtmrCount2, 0, g_swtmrCount2, EXIT); // 0, Here, assert that g_swtmrCount2 is equal to this .
+    ICUNIT_GOTO_EQUAL(g_swtmrCount3, 1, g_swtmrCount3, EXIT); // 1, Here, assert that g_swtmrCount3 is equal to this .
+
+    ret = LOS_TaskDelay(140); // 140, set delay time.
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* The 160 ticks timer expires on the grid of the 20 ticks one rather than 160 ticks after its start */
+    ICUNIT_GOTO_EQUAL(g_swtmrCount1, 8, g_swtmrCount1, EXIT); // 8, Here, assert that g_swtmrCount1 is equal to this .
+    ICUNIT_GOTO_EQUAL(g_swtmrCount2, 1, g_swtmrCount2, EXIT); // 1, Here, assert that g_swtmrCount2 is equal to this .
+    ICUNIT_GOTO_EQUAL(g_swtmrCount3, 11, g_swtmrCount3, EXIT); // 11, Here, assert that g_swtmrCount3 is equal to this .
+
+EXIT:
+    LOS_SwtmrDelete(swtmrId1);
+    LOS_SwtmrDelete(swtmrId2);
+    LOS_SwtmrDelete(swtmrId3);
+
+    return LOS_OK;
+}
+
+VOID ItLosSwtmrAlign032() // IT_Layer_ModuleORFeature_No
+{
+    TEST_ADD_CASE("ItLosSwtmrAlign032", Testcase, TEST_LOS, TEST_SWTMR, TEST_LEVEL1, TEST_FUNCTION);
+}
+#endif
@@ -130,6 +130,18 @@ VOID ItSuiteLosTask()
     ItLosTask128();
     ItLosTask129();
     ItLosTask130();
+    ItLosTask131();
+    ItLosTask132();
+    ItLosTask133();
+    ItLosTask134();
+    ItLosTask135();
+    ItLosTask136();
+    ItLosTask137();
+    ItLosTask138();
+    ItLosTask139();
+    ItLosTask140();
+    ItLosTask141();
+    ItLosTask142();
 
 #if (LOS_KERNEL_TEST_FULL == 1)
     ItLosTask039();
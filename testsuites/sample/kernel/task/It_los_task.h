@@ -185,6 +185,18 @@ extern VOID ItLosTask127(VOID);
 extern VOID ItLosTask128(VOID);
 extern VOID ItLosTask129(VOID);
 extern VOID ItLosTask130(VOID);
+extern VOID ItLosTask131(VOID);
+extern VOID ItLosTask132(VOID);
+extern VOID ItLosTask133(VOID);
+extern VOID ItLosTask134(VOID);
+extern VOID ItLosTask135(VOID);
+extern VOID ItLosTask136(VOID);
+extern VOID ItLosTask137(VOID);
+extern VOID ItLosTask138(VOID);
+extern VOID ItLosTask139(VOID);
+extern VOID ItLosTask140(VOID);
+extern VOID ItLosTask141(VOID);
+extern VOID ItLosTask142(VOID);
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#if (LOSCFG_KERNEL_BOOT_PROFILE == 1)
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT64 prevCycle = 0;
+    LOS_BOOT_STAGE_INFO info;
+
+    ret = LOS_BootStageInfoGet(0, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    // the first stage recorded by LOS_KernelInit is the memory initialization
+    ret = LOS_BootStageInfoGet(0, &info);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = strcmp(info.name, "mem");
+    ICUNIT_ASSERT_EQUAL(ret, 0, ret);
+
+    for (index = 0; LOS_BootStageInfoGet(index, &info) == LOS_OK; index++) {
+        ICUNIT_ASSERT_EQUAL(info.endCycle >= prevCycle, TRUE, index);
+        prevCycle = info.endCycle;
+    }
+    ICUNIT_ASSERT_NOT_EQUAL(index, 0, index);
+
+    if (index < LOSCFG_KERNEL_BOOT_PROFILE_STAGE_NUM) {
+        LOS_BootStageRecord("test");
+        ret = LOS_BootStageInfoGet(index, &info);
+        ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+        ret = strcmp(info.name, "test");
+        ICUNIT_ASSERT_EQUAL(ret, 0, ret);
+        ICUNIT_ASSERT_EQUAL(info.endCycle >= prevCycle, TRUE, info.cycles);
+    }
+
+    LOS_BootStageShow();
+
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask131(VOID)
+{
+    TEST_ADD_CASE("ItLosTask131", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
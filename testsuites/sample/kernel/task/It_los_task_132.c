@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#if (LOSCFG_KERNEL_MODULE_INIT == 1)
+#include "los_init.h"
+
+static UINT32 g_initSeq = 0;
+static UINT32 g_initSeqA = 0;
+static UINT32 g_initSeqB = 0;
+static UINT32 g_initSeqC = 0;
+static UINT32 g_initSeqD = 0;
+
+static UINT32 ItTaskInitA(VOID)
+{
+    g_initSeqA = ++g_initSeq;
+    return LOS_OK;
+}
+
+static UINT32 ItTaskInitB(VOID)
+{
+    g_initSeqB = ++g_initSeq;
+    return LOS_OK;
+}
+
+static UINT32 ItTaskInitC(VOID)
+{
+    g_initSeqC = ++g_initSeq;
+    return LOS_OK;
+}
+
+static UINT32 ItTaskInitD(VOID)
+{
+    g_initSeqD = ++g_initSeq;
+    return LOS_OK;
+}
+
+static UINT32 ItTaskInitFail(VOID)
+{
+    return LOS_NOK;
+}
+
+LOS_MODULE_INIT(itTaskInitA, ItTaskInitA, LOS_INIT_LEVEL_APP);
+LOS_MODULE_INIT_DEPENDS(itTaskInitB, ItTaskInitB, LOS_INIT_LEVEL_APP, LOS_INIT_DEFERRED, "itTaskInitC");
+LOS_MODULE_INIT_DEFERRED(itTaskInitC, ItTaskInitC, LOS_INIT_LEVEL_APP);
+LOS_MODULE_INIT(itTaskInitFail, ItTaskInitFail, LOS_INIT_LEVEL_APP);
+LOS_MODULE_INIT_DEPENDS(itTaskInitD, ItTaskInitD, LOS_INIT_LEVEL_APP, LOS_INIT_DEFERRED, "itTaskInitFail");
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 state;
+
+    ret = LOS_ModuleInitWait(LOS_WAIT_FOREVER);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_ModuleInitStateGet("itTaskInitA", &state);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(state, LOS_INIT_STATE_DONE, state);
+    ret = LOS_ModuleInitStateGet("itTaskInitB", &state);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(state, LOS_INIT_STATE_DONE, state);
+    ret = LOS_ModuleInitStateGet("itTaskInitFail", &state);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(state, LOS_INIT_STATE_FAILED, state);
+    ret = LOS_ModuleInitStateGet("itTaskInitD", &state);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(state, LOS_INIT_STATE_FAILED, state);
+
+    // immediate modules run first, and B waits for C although it is registered before it
+    ICUNIT_ASSERT_NOT_EQUAL(g_initSeqA, 0, g_initSeqA);
+    ICUNIT_ASSERT_EQUAL(g_initSeqA < g_initSeqC, TRUE, g_initSeqC);
+    ICUNIT_ASSERT_EQUAL(g_initSeqC < g_initSeqB, TRUE, g_initSeqB);
+    ICUNIT_ASSERT_EQUAL(g_initSeqD, 0, g_initSeqD);
+
+    ret = LOS_ModuleInitStateGet("itTaskInitNone", &state);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+    ret = LOS_ModuleInitStateGet("itTaskInitA", NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask132(VOID)
+{
+    TEST_ADD_CASE("ItLosTask132", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 semHandle;
+    UINT64 start;
+    UINT64 elapsed;
+    UINT64 delayNs = OS_NS_PER_TICK / 2; // half a tick, rounded to at least one tick by the tick APIs
+    UINT64 delayCycle = OS_CYCLE_PER_TICK / 2;
+
+    start = LOS_SysCycleGet();
+    ret = LOS_TaskDelayNs(delayNs);
+    elapsed = LOS_SysCycleGet() - start;
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(elapsed >= delayCycle, TRUE, (UINT32)elapsed);
+    ICUNIT_ASSERT_EQUAL(elapsed < OS_CYCLE_PER_TICK, TRUE, (UINT32)elapsed);
+
+    ret = LOS_SemCreate(0, &semHandle);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_SemPendNs(semHandle, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_UNAVAILABLE, ret, EXIT);
+
+    start = LOS_SysCycleGet();
+    ret = LOS_SemPendNs(semHandle, delayNs);
+    elapsed = LOS_SysCycleGet() - start;
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_SEM_TIMEOUT, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(elapsed >= delayCycle, TRUE, (UINT32)elapsed, EXIT);
+    ICUNIT_GOTO_EQUAL(elapsed < OS_CYCLE_PER_TICK, TRUE, (UINT32)elapsed, EXIT);
+
+    ret = LOS_SemPost(semHandle);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_SemPendNs(semHandle, LOS_WAIT_FOREVER_NS);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+EXIT:
+    (VOID)LOS_SemDelete(semHandle);
+    return LOS_OK;
+}
+
+VOID ItLosTask133(VOID)
+{
+    TEST_ADD_CASE("ItLosTask133", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#define CLOCK_READ_LOOP 1000
+
+static UINT32 TestCase(VOID)
+{
+    UINT64 start;
+    UINT64 prev;
+    UINT64 curr;
+    UINT64 lockFree;
+    UINT64 locked;
+    UINT32 intSave;
+    UINT32 loop;
+
+    prev = LOS_SysCycleGet();
+    start = prev;
+    for (loop = 0; loop < CLOCK_READ_LOOP; loop++) {
+        curr = LOS_SysCycleGet();
+        ICUNIT_ASSERT_EQUAL((curr >= prev), TRUE, loop);
+        prev = curr;
+    }
+    lockFree = LOS_SysCycleGet() - start;
+
+    /* The read path used to mask interrupts around every clock read */
+    start = LOS_SysCycleGet();
+    for (loop = 0; loop < CLOCK_READ_LOOP; loop++) {
+        intSave = LOS_IntLock();
+        curr = LOS_SysCycleGet();
+        LOS_IntRestore(intSave);
+        ICUNIT_ASSERT_EQUAL((curr >= prev), TRUE, loop);
+        prev = curr;
+    }
+    locked = LOS_SysCycleGet() - start;
+
+    PRINTK("LOS_SysCycleGet x%u: %u cycles, with interrupts masked %u cycles\n",
+           CLOCK_READ_LOOP, (UINT32)lockFree, (UINT32)locked);
+
+    return LOS_OK;
+}
+
+VOID ItLosTask134(VOID)
+{
+    TEST_ADD_CASE("ItLosTask134", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_PERFORMANCE);
+}
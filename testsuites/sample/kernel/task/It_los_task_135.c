@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_task.h"
+#include "los_sched.h"
+
+#if (LOSCFG_KERNEL_SCHED_SLACK == 1)
+#define TEST_SLACK_US   (10 * OS_SYS_US_PER_MS)
+
+static VOID SwtmrF01(UINT32 arg)
+{
+    (VOID)arg;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 swtmrID;
+    LOS_SCHED_SLACK_STAT_S before;
+    LOS_SCHED_SLACK_STAT_S after;
+
+    ret = LOS_SchedSlackStatGet(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_NOK, ret);
+
+    ret = LOS_TaskSlackSet(LOSCFG_BASE_CORE_TSK_LIMIT + 1, TEST_SLACK_US);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_ID_INVALID, ret);
+
+    ret = LOS_TaskSlackSet(g_idleTaskID, TEST_SLACK_US);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_ID_INVALID, ret);
+
+    ret = LOS_SwtmrSlackSet(0xffffffff, TEST_SLACK_US);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_SWTMR_ID_INVALID, ret);
+
+    // 3, timer expires one tick after the task delay below, within the task slack
+    ret = LOS_SwtmrCreate(3, LOS_SWTMR_MODE_NO_SELFDELETE, (SWTMR_PROC_FUNC)SwtmrF01, &swtmrID, 0
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == 1)
+        , OS_SWTMR_ROUSES_ALLOW, OS_SWTMR_ALIGN_SENSITIVE
+#endif
+    );
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_SwtmrSlackSet(swtmrID, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    ret = LOS_TaskSlackSet(LOS_CurTaskIDGet(), TEST_SLACK_US);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    ret = LOS_SchedSlackStatGet(&before);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SwtmrStart(swtmrID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    /* The delay expiry is deferred onto the timer wakeup, one wakeup serves both */
+    ret = LOS_TaskDelay(2); // 2, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+
+    ret = LOS_SchedSlackStatGet(&after);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(after.wakeups > before.wakeups, TRUE, after.wakeups, EXIT);
+    ICUNIT_GOTO_EQUAL(after.expired > before.expired, TRUE, after.expired, EXIT);
+    ICUNIT_GOTO_EQUAL(after.deferred > before.deferred, TRUE, after.deferred, EXIT);
+
+EXIT:
+    (VOID)LOS_TaskSlackSet(LOS_CurTaskIDGet(), LOSCFG_KERNEL_SCHED_SLACK_DEFAULT_US);
+EXIT1:
+    (VOID)LOS_SwtmrDelete(swtmrID);
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask135(VOID)
+{
+    TEST_ADD_CASE("ItLosTask135", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
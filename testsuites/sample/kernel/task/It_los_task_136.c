@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "osTest.h"
+#include "It_los_task.h"
+#include "los_workqueue.h"
+
+#if (LOSCFG_BASE_CORE_WORKQUEUE == 1)
+static UINT32 g_workCount;
+
+static VOID WorkHandler(VOID *arg)
+{
+    UINT32 *count = (UINT32 *)arg;
+    (*count)++;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 queueID;
+    UINT32 count;
+    LOS_WORK_S work1;
+    LOS_WORK_S work2;
+    LOS_WORK_S work3;
+    LOS_WORKQUEUE_STAT_S stat;
+
+    g_workCount = 0;
+
+    ret = LOS_WorkQueueCreate("WorkQueueTest", TASK_PRIO_TEST - 1, TASK_STACK_SIZE_TEST, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_PTR_NULL, ret);
+
+    ret = LOS_WorkInit(&work1, NULL, &g_workCount);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_PTR_NULL, ret);
+
+    ret = LOS_WorkInit(&work1, WorkHandler, &g_workCount);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_WorkInit(&work2, WorkHandler, &g_workCount);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_WorkInit(&work3, WorkHandler, &g_workCount);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_WorkSubmit(LOSCFG_BASE_CORE_WORKQUEUE_LIMIT, &work1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_ID_INVALID, ret);
+
+    ret = LOS_WorkCancel(&work1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_WORK_NOT_PENDING, ret);
+
+    ret = LOS_WorkQueueCreate("WorkQueueTest", TASK_PRIO_TEST - 1, TASK_STACK_SIZE_TEST, &queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    /* A work submitted twice before it runs is run once */
+    LOS_TaskLock();
+    ret = LOS_WorkSubmit(queueID, &work1);
+    ret |= LOS_WorkSubmit(queueID, &work1);
+    LOS_TaskUnlock();
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_workCount, 1, g_workCount, EXIT);
+
+    ret = LOS_WorkSubmitDelayed(queueID, &work2, 2); // 2, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_WorkSubmitDelayed(queueID, &work3, 2); // 2, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_WorkCancel(&work3);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_workCount, 1, g_workCount, EXIT);
+
+    ret = LOS_TaskDelay(5); // 5, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_workCount, 2, g_workCount, EXIT); // 2, work1 and work2
+
+    ret = LOS_WorkQueueStatGet(queueID, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.executed, 2, stat.executed, EXIT); // 2, work1 and work2
+    ICUNIT_GOTO_EQUAL(stat.pendingMax, 1, stat.pendingMax, EXIT);
+    ICUNIT_GOTO_EQUAL(stat.latencySumUs >= stat.latencyMaxUs, TRUE, stat.latencySumUs, EXIT);
+
+EXIT:
+    ret = LOS_WorkQueueDelete(queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_WorkQueueDelete(queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_NOT_CREATED, ret);
+
+    /* A delayed work is cancelled with its queue, a new queue reusing the slot does not run it */
+    ret = LOS_WorkQueueCreate("WorkQueueTest", TASK_PRIO_TEST - 1, TASK_STACK_SIZE_TEST, &queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_WorkSubmitDelayed(queueID, &work2, 2); // 2, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ret = LOS_WorkQueueDelete(queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_WorkCancel(&work2);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_WORKQUEUE_WORK_NOT_PENDING, ret);
+
+    ret = LOS_WorkQueueCreate("WorkQueueTest", TASK_PRIO_TEST - 1, TASK_STACK_SIZE_TEST, &queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    count = g_workCount;
+    ret = LOS_TaskDelay(5); // 5, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_workCount, count, g_workCount, EXIT1);
+
+EXIT1:
+    ret = LOS_WorkQueueDelete(queueID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask136(VOID)
+{
+    TEST_ADD_CASE("ItLosTask136", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_task.h"
+#include "los_sched.h"
+
+#if (LOSCFG_KERNEL_SCHED_LATENCY == 1)
+#define LATENCY_BUSY_CYCLES 5000
+
+static LOS_SCHED_LATENCY_S g_latency;
+static UINT32 g_latencyRet;
+
+static VOID TaskF01(VOID)
+{
+    g_latencyRet = LOS_SchedLatencyGet(LOS_CurTaskIDGet(), &g_latency);
+    g_testCount++;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT64 start;
+    LOS_SCHED_LATENCY_S stat;
+    LOS_SCHED_LATENCY_GLOBAL_S global;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "Tsk137A";
+    task1.usTaskPrio = TASK_PRIO_TEST + 1; // 1, lower than the current task, so it stays ready until we block
+
+    ret = LOS_SchedLatencyGet(LOSCFG_BASE_CORE_TSK_LIMIT + 1, &stat);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_ID_INVALID, ret);
+    ret = LOS_SchedLatencyGlobalGet(NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_PTR_NULL, ret);
+
+    g_testCount = 0;
+    g_latencyRet = LOS_NOK;
+    LOS_SchedLatencyReset();
+
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    start = LOS_SysCycleGet();
+    while ((LOS_SysCycleGet() - start) < LATENCY_BUSY_CYCLES) {
+    }
+    ICUNIT_ASSERT_EQUAL(g_testCount, 0, g_testCount);
+
+    ret = LOS_TaskDelay(2); // 2, delay ticks
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(g_testCount, 1, g_testCount);
+
+    ICUNIT_ASSERT_EQUAL(g_latencyRet, LOS_OK, g_latencyRet);
+    ICUNIT_ASSERT_EQUAL(g_latency.count, 1, g_latency.count);
+    ICUNIT_ASSERT_EQUAL(g_latency.maxCycles >= LATENCY_BUSY_CYCLES, TRUE, g_latency.maxCycles);
+    ICUNIT_ASSERT_EQUAL(g_latency.blockerID, LOS_CurTaskIDGet(), g_latency.blockerID);
+
+    ret = LOS_SchedLatencyGlobalGet(&global);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(global.latency.count >= 1, TRUE, global.latency.count);
+    ICUNIT_ASSERT_EQUAL(global.latency.maxCycles >= g_latency.maxCycles, TRUE, global.latency.maxCycles);
+
+    LOS_SchedLatencyShow();
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask137(VOID)
+{
+    TEST_ADD_CASE("ItLosTask137", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_TRACK == 1)
+#define STACK_TEST_SIZE     0x800
+#define STACK_TEST_BUF_SIZE 512
+
+/* The warning case needs the hook, and room below the mark for the context saved when the task is switched out */
+#define STACK_WARN_TEST     ((LOSCFG_DEBUG_HOOK == 1) && (LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT != 0) && \
+                             (LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT <= 90)) // 90, percent
+#if STACK_WARN_TEST
+#include "los_hook.h"
+
+#define STACK_WARN_SIZE     0x1000
+#define STACK_WARN_BUF_SIZE ((STACK_WARN_SIZE * LOSCFG_BASE_CORE_TSK_STACK_WARN_PERCENT) / 100) // 100, percent
+#define STACK_WARN_NAME     "Tsk138B"
+
+static UINT32 g_warnCount;
+
+static VOID StackWarnHook(const LosTaskCB *taskCB, UINT32 peakUsed)
+{
+    if (strcmp(taskCB->taskName, STACK_WARN_NAME) == 0) {
+        g_warnCount++;
+    }
+    (VOID)peakUsed;
+}
+
+static VOID TaskF02(VOID)
+{
+    volatile UINT8 buf[STACK_WARN_BUF_SIZE];
+    UINT32 index;
+
+    for (index = 0; index < STACK_WARN_BUF_SIZE; index++) {
+        buf[index] = (UINT8)index;
+    }
+
+    /* Each switch back in samples a stack pointer below the warning mark, only the first one warns */
+    (VOID)LOS_TaskDelay(1);
+    (VOID)LOS_TaskDelay(1);
+    g_testCount += buf[1];
+}
+#endif
+
+static VOID TaskF01(VOID)
+{
+    volatile UINT8 buf[STACK_TEST_BUF_SIZE];
+    UINT32 index;
+
+    for (index = 0; index < STACK_TEST_BUF_SIZE; index++) {
+        buf[index] = (UINT8)index;
+    }
+
+    /* Switched out with the buffer still on the stack, the tracked mark is sampled when it is switched back in */
+    (VOID)LOS_TaskDelay(2); // 2, delay ticks
+    g_testCount++;
+    (VOID)LOS_TaskDelay(10); // 10, delay ticks
+    g_testCount += buf[1];
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    TSK_INFO_S info;
+    TSK_INIT_PARAM_S task1 = { 0 };
+#if STACK_WARN_TEST
+    TSK_INIT_PARAM_S task2 = { 0 };
+#endif
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = STACK_TEST_SIZE;
+    task1.pcName = "Tsk138A";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1; // 1, higher than the current task
+
+    g_testCount = 0;
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_TaskDelay(5); // 5, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT);
+
+    ret = LOS_TaskInfoGet(g_testTaskID01, &info);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(info.uwPeakUsed >= STACK_TEST_BUF_SIZE, TRUE, info.uwPeakUsed, EXIT);
+    ICUNIT_GOTO_EQUAL(info.uwPeakUsed < info.uwStackSize, TRUE, info.uwPeakUsed, EXIT);
+    (VOID)LOS_TaskDelete(g_testTaskID01);
+
+#if STACK_WARN_TEST
+    task2.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task2.uwStackSize = STACK_WARN_SIZE;
+    task2.pcName = STACK_WARN_NAME;
+    task2.usTaskPrio = TASK_PRIO_TEST - 1; // 1, higher than the current task
+
+    g_testCount = 0;
+    g_warnCount = 0;
+    ret = LOS_HookReg(LOS_HOOK_TYPE_TASK_STACK_WARN, StackWarnHook);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    ret = LOS_TaskCreate(&g_testTaskID02, &task2);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = LOS_TaskDelay(5); // 5, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_testCount, 1, g_testCount, EXIT1);
+    ICUNIT_GOTO_EQUAL(g_warnCount, 1, g_warnCount, EXIT1);
+
+EXIT1:
+    (VOID)LOS_TaskDelete(g_testTaskID02);
+EXIT2:
+    (VOID)LOS_HookUnReg(LOS_HOOK_TYPE_TASK_STACK_WARN, StackWarnHook);
+#endif
+    return LOS_OK;
+
+EXIT:
+    (VOID)LOS_TaskDelete(g_testTaskID01);
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask138(VOID)
+{
+    TEST_ADD_CASE("ItLosTask138", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#if (LOSCFG_KERNEL_SCHED_EDF == 1)
+#define EDF_JOBS            10
+#define EDF_TEST_TIMEOUT_MS 1000
+#define EDF_PERIOD_A_US     10000
+#define EDF_BUDGET_A_US     3000
+#define EDF_WORK_A_US       1000
+#define EDF_PERIOD_B_US     20000
+#define EDF_BUDGET_B_US     6000
+#define EDF_WORK_B_US       2000
+#define EDF_PERIOD_HOG_US   10000
+#define EDF_BUDGET_HOG_US   1000
+
+static volatile UINT32 g_hogCount;
+
+static VOID EdfBusy(UINT32 us)
+{
+    UINT64 start = LOS_SysCycleGet();
+    UINT64 cycles = ((UINT64)g_sysClock * us) / OS_SYS_US_PER_SECOND;
+
+    while ((LOS_SysCycleGet() - start) < cycles) {
+    }
+}
+
+static VOID TaskF01(UINT32 workUs)
+{
+    UINT32 index;
+
+    for (index = 0; index < EDF_JOBS; index++) {
+        EdfBusy(workUs);
+        (VOID)LOS_TaskEdfWait();
+    }
+    g_testCount++;
+}
+
+/* Never completes a job, it only runs while it has budget left */
+static VOID TaskF02(VOID)
+{
+    while (1) {
+        g_hogCount++;
+    }
+}
+
+static VOID EdfStatShow(const CHAR *name, const LOS_TASK_EDF_STAT_S *stat)
+{
+    UINT32 rate = (stat->jobs == 0) ? 0 : ((stat->misses * 100) / stat->jobs); // 100, percent
+
+    PRINTK("%s: period %u us budget %u us, jobs %u misses %u (%u%%) throttles %u\n", name, stat->periodUs,
+           stat->budgetUs, stat->jobs, stat->misses, rate, stat->throttles);
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT64 start;
+    LOS_TASK_EDF_STAT_S stat;
+    TSK_INFO_S info;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "Tsk139A";
+    task1.usTaskPrio = TASK_PRIO_TEST + 1; // 1, lower than the current task, it only runs as an EDF task
+    task1.uwArg = EDF_WORK_A_US;
+
+    ret = LOS_TaskEdfSet(LOSCFG_BASE_CORE_TSK_LIMIT + 1, EDF_PERIOD_A_US, EDF_BUDGET_A_US);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_ID_INVALID, ret);
+    ret = LOS_TaskEdfSet(LOS_CurTaskIDGet(), EDF_BUDGET_A_US, EDF_PERIOD_A_US);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_EDF_PARAM_INVALID, ret);
+    ret = LOS_TaskEdfSet(LOS_CurTaskIDGet(), EDF_PERIOD_A_US, 0);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_EDF_PARAM_INVALID, ret);
+    ret = LOS_TaskEdfWait();
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_NOT_EDF, ret);
+    ret = LOS_TaskEdfStatGet(LOS_CurTaskIDGet(), NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_PTR_NULL, ret);
+
+    g_testCount = 0;
+    g_hogCount = 0;
+    ret = LOS_TaskCreateOnly(&g_testTaskID01, &task1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    task1.pcName = "Tsk139B";
+    task1.uwArg = EDF_WORK_B_US;
+    ret = LOS_TaskCreateOnly(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task1.pcName = "Tsk139C";
+    ret = LOS_TaskCreateOnly(&g_testTaskID03, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+
+    ret = LOS_TaskEdfSet(g_testTaskID01, EDF_PERIOD_A_US, EDF_BUDGET_A_US);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ret = LOS_TaskEdfSet(g_testTaskID02, EDF_PERIOD_B_US, EDF_BUDGET_B_US);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+
+    /* 30% + 30% admitted, another 40% exceeds LOSCFG_KERNEL_SCHED_EDF_UTIL_MAX */
+    ret = LOS_TaskEdfSet(g_testTaskID03, EDF_PERIOD_HOG_US, EDF_PERIOD_HOG_US * 4 / 10); // 4 / 10, 40%
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_TSK_EDF_OVERLOAD, ret, EXIT3);
+    ret = LOS_TaskEdfSet(g_testTaskID03, EDF_PERIOD_HOG_US, EDF_BUDGET_HOG_US);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+
+    (VOID)LOS_TaskResume(g_testTaskID01);
+    (VOID)LOS_TaskResume(g_testTaskID02);
+    (VOID)LOS_TaskResume(g_testTaskID03);
+
+    /* The EDF tasks preempt this task although their priority is lower, and the hog is held to its budget */
+    start = LOS_SysCycleGet();
+    while ((g_testCount < 2) && /* 2, both periodic tasks are done */
+           ((LOS_SysCycleGet() - start) < ((UINT64)g_sysClock * EDF_TEST_TIMEOUT_MS / OS_SYS_MS_PER_SECOND))) {
+    }
+    ICUNIT_GOTO_EQUAL(g_testCount, 2, g_testCount, EXIT3); // 2, both periodic tasks are done
+
+    ret = LOS_TaskEdfStatGet(g_testTaskID01, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    EdfStatShow("Tsk139A", &stat);
+    ICUNIT_GOTO_EQUAL(stat.jobs, EDF_JOBS, stat.jobs, EXIT3);
+    ICUNIT_GOTO_EQUAL(stat.misses, 0, stat.misses, EXIT3);
+
+    ret = LOS_TaskEdfStatGet(g_testTaskID02, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    EdfStatShow("Tsk139B", &stat);
+    ICUNIT_GOTO_EQUAL(stat.jobs, EDF_JOBS, stat.jobs, EXIT3);
+    ICUNIT_GOTO_EQUAL(stat.misses, 0, stat.misses, EXIT3);
+
+    ret = LOS_TaskEdfStatGet(g_testTaskID03, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    EdfStatShow("Tsk139C", &stat);
+    ICUNIT_GOTO_EQUAL(stat.throttles > 0, TRUE, stat.throttles, EXIT3);
+    ICUNIT_GOTO_EQUAL(g_hogCount > 0, TRUE, g_hogCount, EXIT3);
+
+    /* The hog spends most of each period throttled on the timer list */
+    start = LOS_SysCycleGet();
+    do {
+        ret = LOS_TaskInfoGet(g_testTaskID03, &info);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    } while (!(info.usTaskStatus & OS_TASK_STATUS_DELAY) &&
+             ((LOS_SysCycleGet() - start) < ((UINT64)g_sysClock * EDF_TEST_TIMEOUT_MS / OS_SYS_MS_PER_SECOND)));
+    ICUNIT_GOTO_NOT_EQUAL(info.usTaskStatus & OS_TASK_STATUS_DELAY, 0, info.usTaskStatus, EXIT3);
+
+    /* Back to its fixed priority, below this task, the hog is ready at once but no longer runs */
+    ret = LOS_TaskEdfSet(g_testTaskID03, 0, 0);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ret = LOS_TaskEdfStatGet(g_testTaskID03, &stat);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ICUNIT_GOTO_EQUAL(stat.periodUs, 0, stat.periodUs, EXIT3);
+    ret = LOS_TaskInfoGet(g_testTaskID03, &info);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT3);
+    ICUNIT_GOTO_EQUAL(info.usTaskStatus & (OS_TASK_STATUS_READY | OS_TASK_STATUS_DELAY), OS_TASK_STATUS_READY,
+                      info.usTaskStatus, EXIT3);
+
+EXIT3:
+    (VOID)LOS_TaskDelete(g_testTaskID03);
+EXIT2:
+    (VOID)LOS_TaskDelete(g_testTaskID02);
+EXIT1:
+    (VOID)LOS_TaskDelete(g_testTaskID01);
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask139(VOID)
+{
+    TEST_ADD_CASE("ItLosTask139", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#define PRI_TEST_TASK_NUM 3
+
+static UINT32 g_runOrder[PRI_TEST_TASK_NUM];
+
+static VOID TaskF01(UINT32 index)
+{
+    g_runOrder[g_testCount] = index;
+    g_testCount++;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT32 taskID[PRI_TEST_TASK_NUM];
+    /* The highest and lowest usable priorities below this task and one in between, in different bitmap words
+     * when LOSCFG_BASE_CORE_TSK_PRIORITY_NUM is above 32 */
+    UINT16 prio[PRI_TEST_TASK_NUM] = {
+        TASK_PRIO_TEST + 1,
+        (TASK_PRIO_TEST + OS_TASK_PRIORITY_LOWEST) / 2, // 2, middle of the range
+        OS_TASK_PRIORITY_LOWEST - 1,
+    };
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "Tsk140A";
+
+    g_testCount = 0;
+    for (index = 0; index < PRI_TEST_TASK_NUM; index++) {
+        taskID[index] = OS_INVALID;
+    }
+
+    /* Created lowest priority first, they stay ready until this task blocks */
+    for (index = PRI_TEST_TASK_NUM; index > 0; index--) {
+        task1.usTaskPrio = prio[index - 1];
+        task1.uwArg = index - 1;
+        ret = LOS_TaskCreate(&taskID[index - 1], &task1);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+    ICUNIT_GOTO_EQUAL(LOS_TaskPriGet(taskID[PRI_TEST_TASK_NUM - 1]), OS_TASK_PRIORITY_LOWEST - 1,
+                      LOS_TaskPriGet(taskID[PRI_TEST_TASK_NUM - 1]), EXIT);
+
+    ret = LOS_TaskPriSet(taskID[0], OS_TASK_PRIORITY_LOWEST + 1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_TSK_PRIOR_ERROR, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 0, g_testCount, EXIT);
+
+    ret = LOS_TaskDelay(2); // 2, delay ticks
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, PRI_TEST_TASK_NUM, g_testCount, EXIT);
+    for (index = 0; index < PRI_TEST_TASK_NUM; index++) {
+        ICUNIT_GOTO_EQUAL(g_runOrder[index], index, g_runOrder[index], EXIT);
+    }
+
+EXIT:
+    for (index = 0; index < PRI_TEST_TASK_NUM; index++) {
+        (VOID)LOS_TaskDelete(taskID[index]);
+    }
+    return LOS_OK;
+}
+
+VOID ItLosTask140(VOID)
+{
+    TEST_ADD_CASE("ItLosTask140", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
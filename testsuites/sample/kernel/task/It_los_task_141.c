@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#if (LOSCFG_BASE_CORE_TIMESLICE_PER_TASK == 1)
+#define SLICE_TEST_US       1000
+#define SLICE_TEST_RUN_MS   10
+#define SLICE_TEST_YIELDS   3
+
+static UINT64 g_sliceEnd;
+static LOS_TASK_SLICE_STAT_S g_sliceStat[2]; // 2, tasks sharing a priority
+
+static VOID TaskF01(UINT32 index)
+{
+    /* Busy until the end time, the tasks of the same priority take turns at each slice expiration */
+    while (LOS_SysCycleGet() < g_sliceEnd) {
+    }
+    (VOID)LOS_TaskTimeSliceStatGet(LOS_CurTaskIDGet(), &g_sliceStat[index]);
+    g_testCount++;
+}
+
+static VOID TaskF02(VOID)
+{
+    UINT32 index;
+
+    for (index = 0; index < SLICE_TEST_YIELDS; index++) {
+        (VOID)LOS_TaskYield();
+    }
+    (VOID)LOS_TaskTimeSliceStatGet(LOS_CurTaskIDGet(), &g_sliceStat[0]);
+    g_testCount++;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    LOS_TASK_SLICE_STAT_S stat;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "Tsk141A";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1; // 1, higher than the current task
+    task1.timeSliceUs = LOS_TASK_TIMESLICE_MIN_US - 1;
+
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_TIMESLICE_INVALID, ret);
+    ret = LOS_TaskTimeSliceSet(LOS_CurTaskIDGet(), LOS_TASK_TIMESLICE_MIN_US - 1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_TIMESLICE_INVALID, ret);
+    ret = LOS_TaskTimeSliceStatGet(LOS_CurTaskIDGet(), NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_PTR_NULL, ret);
+
+    ret = LOS_TaskTimeSliceSet(LOS_CurTaskIDGet(), 0);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_TaskTimeSliceStatGet(LOS_CurTaskIDGet(), &stat);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(stat.sliceUs, LOSCFG_BASE_CORE_TIMESLICE_TIMEOUT, stat.sliceUs);
+
+    /* Yields are counted apart from slice expirations */
+    g_testCount = 0;
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF02;
+    task1.timeSliceUs = 0;
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ICUNIT_ASSERT_EQUAL(g_testCount, 1, g_testCount);
+    ICUNIT_ASSERT_EQUAL(g_sliceStat[0].yields, SLICE_TEST_YIELDS, g_sliceStat[0].yields);
+    ICUNIT_ASSERT_EQUAL(g_sliceStat[0].expired, 0, g_sliceStat[0].expired);
+
+    /* Two busy tasks of the same priority with short slices */
+    g_testCount = 0;
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.timeSliceUs = SLICE_TEST_US;
+    g_sliceEnd = LOS_SysCycleGet() + (((UINT64)g_sysClock * SLICE_TEST_RUN_MS) / OS_SYS_MS_PER_SECOND);
+    LOS_TaskLock();
+    task1.uwArg = 0;
+    ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT1);
+    task1.pcName = "Tsk141B";
+    task1.uwArg = 1;
+    ret = LOS_TaskCreate(&g_testTaskID02, &task1);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT2);
+    LOS_TaskUnlock();
+
+    ICUNIT_ASSERT_EQUAL(g_testCount, 2, g_testCount); // 2, both tasks are done
+    ICUNIT_ASSERT_EQUAL(g_sliceStat[0].sliceUs, SLICE_TEST_US, g_sliceStat[0].sliceUs);
+    ICUNIT_ASSERT_EQUAL(g_sliceStat[0].expired > 0, TRUE, g_sliceStat[0].expired);
+    ICUNIT_ASSERT_EQUAL(g_sliceStat[1].expired > 0, TRUE, g_sliceStat[1].expired);
+    ICUNIT_ASSERT_EQUAL(g_sliceStat[0].yields, 0, g_sliceStat[0].yields);
+    return LOS_OK;
+
+EXIT2:
+    (VOID)LOS_TaskDelete(g_testTaskID01);
+EXIT1:
+    LOS_TaskUnlock();
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask141(VOID)
+{
+    TEST_ADD_CASE("ItLosTask141", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_FUNCTION);
+}
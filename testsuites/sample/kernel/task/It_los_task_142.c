@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2013-2019 Huawei Technologies Co., Ltd. All rights reserved.
+ * Copyright (c) 2020-2021 Huawei Device Co., Ltd. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "osTest.h"
+#include "It_los_task.h"
+
+#if (LOSCFG_BASE_CORE_TSK_POOL == 1)
+#define POOL_TEST_TASK_NUM  2
+#define POOL_BENCH_LOOPS    100
+
+static VOID TaskF01(VOID)
+{
+    g_testCount++;
+}
+
+static UINT32 BenchCreate(UINT32 *cycles)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT64 start;
+    TSK_INIT_PARAM_S task1 = { 0 };
+    task1.pfnTaskEntry = (TSK_ENTRY_FUNC)TaskF01;
+    task1.uwStackSize = TASK_STACK_SIZE_TEST;
+    task1.pcName = "Tsk142A";
+    task1.usTaskPrio = TASK_PRIO_TEST - 1; // 1, higher than the current task, so each worker runs to its end
+
+    g_testCount = 0;
+    start = LOS_SysCycleGet();
+    for (index = 0; index < POOL_BENCH_LOOPS; index++) {
+        ret = LOS_TaskCreate(&g_testTaskID01, &task1);
+        ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    }
+    *cycles = (UINT32)((LOS_SysCycleGet() - start) / POOL_BENCH_LOOPS);
+    ICUNIT_ASSERT_EQUAL(g_testCount, POOL_BENCH_LOOPS, g_testCount);
+    return LOS_OK;
+}
+
+static UINT32 BenchSpawn(UINT32 *cycles)
+{
+    UINT32 ret;
+    UINT32 index;
+    UINT32 poolID;
+    UINT64 start;
+
+    ret = LOS_TaskPoolCreate("Tsk142B", POOL_TEST_TASK_NUM, TASK_STACK_SIZE_TEST, TASK_PRIO_TEST - 1, &poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+
+    g_testCount = 0;
+    start = LOS_SysCycleGet();
+    for (index = 0; index < POOL_BENCH_LOOPS; index++) {
+        ret = LOS_TaskPoolSpawn(poolID, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID01);
+        ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    }
+    *cycles = (UINT32)((LOS_SysCycleGet() - start) / POOL_BENCH_LOOPS);
+    ICUNIT_GOTO_EQUAL(g_testCount, POOL_BENCH_LOOPS, g_testCount, EXIT);
+
+EXIT:
+    ret = LOS_TaskPoolDelete(poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    return LOS_OK;
+}
+
+static UINT32 TestCase(VOID)
+{
+    UINT32 ret;
+    UINT32 poolID;
+    UINT32 createCycles = 0;
+    UINT32 spawnCycles = 0;
+
+    ret = LOS_TaskPoolCreate("Tsk142C", 0, TASK_STACK_SIZE_TEST, TASK_PRIO_TEST, &poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_POOL_PARAM_INVALID, ret);
+    ret = LOS_TaskPoolCreate("Tsk142C", POOL_TEST_TASK_NUM, TASK_STACK_SIZE_TEST, TASK_PRIO_TEST, NULL);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_POOL_PARAM_INVALID, ret);
+    ret = LOS_TaskPoolCreate(NULL, POOL_TEST_TASK_NUM, TASK_STACK_SIZE_TEST, TASK_PRIO_TEST, &poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_NAME_EMPTY, ret);
+    ret = LOS_TaskPoolCreate("Tsk142C", POOL_TEST_TASK_NUM, TASK_STACK_SIZE_TEST, OS_TASK_PRIORITY_LOWEST, &poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_PRIOR_ERROR, ret);
+    ret = LOS_TaskPoolCreate("Tsk142C", POOL_TEST_TASK_NUM, LOSCFG_BASE_CORE_TSK_MIN_STACK_SIZE - 1,
+                             TASK_PRIO_TEST, &poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_STKSZ_TOO_SMALL, ret);
+    ret = LOS_TaskPoolSpawn(LOSCFG_BASE_CORE_TSK_POOL_LIMIT, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID01);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_POOL_ID_INVALID, ret);
+    ret = LOS_TaskPoolDelete(LOSCFG_BASE_CORE_TSK_POOL_LIMIT);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_POOL_ID_INVALID, ret);
+
+    /* Workers of a lower priority wait in the ready queue, holding all the tasks of the pool */
+    ret = LOS_TaskPoolCreate("Tsk142C", POOL_TEST_TASK_NUM, TASK_STACK_SIZE_TEST, TASK_PRIO_TEST + 1, &poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_TaskPoolSpawn(poolID, NULL, 0, &g_testTaskID01);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_TSK_ENTRY_NULL, ret, EXIT);
+
+    g_testCount = 0;
+    ret = LOS_TaskPoolSpawn(poolID, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID01);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_TaskPoolSpawn(poolID, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID02);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    ret = LOS_TaskPoolSpawn(poolID, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID03);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_TSK_POOL_EMPTY, ret, EXIT);
+    ret = LOS_TaskPoolDelete(poolID);
+    ICUNIT_GOTO_EQUAL(ret, LOS_ERRNO_TSK_POOL_BUSY, ret, EXIT);
+    ICUNIT_GOTO_EQUAL(g_testCount, 0, g_testCount, EXIT);
+
+    /* Once the workers are done, their task control blocks and stacks can be used again */
+    (VOID)LOS_TaskDelay(1);
+    ICUNIT_GOTO_EQUAL(g_testCount, POOL_TEST_TASK_NUM, g_testCount, EXIT);
+    ret = LOS_TaskPoolSpawn(poolID, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID01);
+    ICUNIT_GOTO_EQUAL(ret, LOS_OK, ret, EXIT);
+    (VOID)LOS_TaskDelay(1);
+    ICUNIT_GOTO_EQUAL(g_testCount, POOL_TEST_TASK_NUM + 1, g_testCount, EXIT);
+
+    ret = LOS_TaskPoolDelete(poolID);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = LOS_TaskPoolSpawn(poolID, (TSK_ENTRY_FUNC)TaskF01, 0, &g_testTaskID01);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_ERRNO_TSK_POOL_ID_INVALID, ret);
+
+    ret = BenchCreate(&createCycles);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    ret = BenchSpawn(&spawnCycles);
+    ICUNIT_ASSERT_EQUAL(ret, LOS_OK, ret);
+    PRINTK("task create and exit x%u: LOS_TaskCreate %u cycles, LOS_TaskPoolSpawn %u cycles per task\n",
+           POOL_BENCH_LOOPS, createCycles, spawnCycles);
+    return LOS_OK;
+
+EXIT:
+    (VOID)LOS_TaskDelay(1);
+    (VOID)LOS_TaskPoolDelete(poolID);
+    return LOS_OK;
+}
+#else
+static UINT32 TestCase(VOID)
+{
+    return LOS_OK;
+}
+#endif
+
+VOID ItLosTask142(VOID)
+{
+    TEST_ADD_CASE("ItLosTask142", TestCase, TEST_LOS, TEST_TASK, TEST_LEVEL1, TEST_PERFORMANCE);
+}
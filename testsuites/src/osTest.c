@@ -107,7 +107,7 @@ UINT32 QueueUsedCountGet(VOID)
     intSave = LOS_IntLock();
     for (UINT32 index = 0; index < LOSCFG_BASE_IPC_QUEUE_LIMIT; index++) {
         LosQueueCB *queueNode = ((LosQueueCB *)g_allQueue) + index;
-        if (queueNode->queueState == OS_QUEUE_INUSED) {
+        if (queueNode->queueState != OS_QUEUE_UNUSED) {
             count++;
         }
     }
@@ -31,6 +31,8 @@
 
 #include <sys/time.h>
 #include <sys/times.h>
+#include <sys/resource.h>
+#include <pthread.h>
 #include <time.h>
 #include <errno.h>
 #include <limits.h>
@@ -543,6 +545,61 @@ LITE_TEST_CASE(PosixTimeFuncTestSuite, testTimes, Function | MediumTest | Level1
     }
 }
 
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+static long TimeSpecDiffMs(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * MILLISECONDS_PER_SECOND +
+        (end->tv_nsec - start->tv_nsec) / NANOSECONDS_PER_MILLISECOND;
+}
+
+/* *
+ * @tc.number SUB_KERNEL_TIME_API_CPUTIME_0100
+ * @tc.name   test thread cpu-time clock and getrusage
+ * @tc.desc   [C- SOFTWARE -0200]
+ */
+LITE_TEST_CASE(PosixTimeFuncTestSuite, testClockCpuTime, Function | MediumTest | Level1)
+{
+    const int runMs = 100;
+    struct timespec start = { 0 };
+    struct timespec end = { 0 };
+    struct timespec byId = { 0 };
+    struct rusage usage = { 0 };
+    clockid_t clockId;
+    int ret;
+
+    ret = pthread_getcpuclockid(pthread_self(), &clockId);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+
+    ret = clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    KeepRun(runMs);
+    ret = clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    LOG("thread cpu time of busy loop: %ld ms", TimeSpecDiffMs(&start, &end));
+    if (!CheckValueClose(runMs, TimeSpecDiffMs(&start, &end), 0.05)) {
+        TEST_FAIL();
+    }
+
+    /* Sleeping must not be charged to the thread */
+    start = end;
+    usleep(runMs * MILLISECONDS_PER_SECOND);
+    ret = clock_gettime(clockId, &end);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_LESS_THAN(runMs / 10, TimeSpecDiffMs(&start, &end));
+
+    ret = clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &byId);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_TRUE(TimeSpecDiffMs(&end, &byId) >= 0);
+
+    ret = getrusage(RUSAGE_THREAD, &usage);
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_GREATER_THAN(0, usage.ru_nvcsw);
+    TEST_ASSERT_GREATER_THAN(0, usage.ru_maxrss);
+    LOG("rusage: utime %ld.%06ld s, nvcsw %ld, nivcsw %ld, maxrss %ld KB", (long)usage.ru_utime.tv_sec,
+        (long)usage.ru_utime.tv_usec, usage.ru_nvcsw, usage.ru_nivcsw, usage.ru_maxrss);
+};
+#endif
+
 RUN_TEST_SUITE(PosixTimeFuncTestSuite);
 
 void PosixTimeFuncTest()
@@ -563,5 +620,8 @@ void PosixTimeFuncTest()
     RUN_ONE_TESTCASE(testTimeStrftime002);
     RUN_ONE_TESTCASE(testTimeStrftime003);
     RUN_ONE_TESTCASE(testTimes);
+#if (LOSCFG_BASE_CORE_CPUP == 1)
+    RUN_ONE_TESTCASE(testClockCpuTime);
+#endif
     return;
 }
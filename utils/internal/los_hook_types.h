@@ -92,6 +92,7 @@ typedef VOID *VOID_PTR;
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_MOVEDTASKTOREADYSTATE, (const LosTaskCB *pstTaskCB))                    \
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_MOVEDTASKTODELAYEDLIST, (const LosTaskCB *pstTaskCB))                   \
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_MOVEDTASKTOSUSPENDEDLIST, (const LosTaskCB *pstTaskCB))                 \
+    LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_TASK_STACK_WARN, (const LosTaskCB *taskCB, UINT32 peakUsed))            \
     /* Hook types supported by interrupt modules */                                                         \
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_ISR_EXITTOSCHEDULER, (VOID))                                            \
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_ISR_ENTER, (UINT32 hwiIndex))                                           \
@@ -101,7 +102,11 @@ typedef VOID *VOID_PTR;
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_SWTMR_DELETE, (const SWTMR_CTRL_S *swtmr))                              \
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_SWTMR_EXPIRED, (const SWTMR_CTRL_S *swtmr))                             \
     LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_SWTMR_START, (const SWTMR_CTRL_S *swtmr))                               \
-    LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_SWTMR_STOP, (const SWTMR_CTRL_S *swtmr))
+    LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_SWTMR_STOP, (const SWTMR_CTRL_S *swtmr))                                \
+    /* Hook types supported by system initialization */                                                     \
+    LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_BOOT_STAGE, (UINT32 stageIndex, UINT32 cycles, UINT32 heapUsed))        \
+    /* Hook types supported by critical section profiling */                                                \
+    LOS_HOOK_TYPE_DEF(LOS_HOOK_TYPE_CRITICAL_SECTION, (UINT32 type, UINT32 cycles, UINTPTR callSite))
 
 /**
  * Defines the types of all hooks.
@@ -50,6 +50,7 @@
 #define ARG_CP_LosQueueCB ADDR(
 #define ARG_CP_SWTMR_CTRL_S ADDR(
 #define ARG_UINT32 ARGS(
+#define ARG_UINTPTR ARGS(
 #define ARG_VOID_PTR ARGS(
 #define ARG_PEVENT_CB_S ARGS(
 #define ARG_void ADDRn(
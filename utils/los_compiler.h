@@ -269,6 +269,15 @@ extern "C" {
 #define LITE_OS_SEC_BSS_INIT
 #endif
 
+/**
+ * @ingroup los_builddef
+ * .bss.kernel.cb section, the static control block tables of the kernel, zeroed by the startup code like .bss.
+ * It can be placed in a fast RAM by the linker script.
+ */
+#ifndef LITE_OS_SEC_BSS_KERNEL_CB
+#define LITE_OS_SEC_BSS_KERNEL_CB   __attribute__((section(".bss.kernel.cb")))
+#endif
+
 #ifndef LITE_OS_SEC_TEXT_DATA
 #define LITE_OS_SEC_TEXT_DATA       // __attribute__((section(".dyn.data")))
 #define LITE_OS_SEC_TEXT_BSS        // __attribute__((section(".dyn.bss")))
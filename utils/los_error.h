@@ -201,6 +201,8 @@ enum LOS_MODULE_ID {
     LOS_MOD_HOOK             = 0x1f,
     LOS_MOD_PM               = 0x20,
     LOS_MOD_LMK              = 0x21,
+    LOS_MOD_WORKQUEUE        = 0x22,
+    LOS_MOD_IRQSTAT          = 0x23,
     LOS_MOD_SHELL            = 0x31,
     LOS_MOD_SIGNAL           = 0x32,
     LOS_MOD_BUTT